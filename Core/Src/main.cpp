@@ -35,8 +35,10 @@
 #include "sensor.h"
 #include "bmacro.h"
 #include "system.h"
+#include "trace.h"
 #include "at24cm01.h"
 #include "hal_defs.h"
+#include "lcd_mirror.h"
 
 #include "App.h"
 #include "SoulGuard.h"
@@ -81,6 +83,33 @@ void SystemClock_Config(void);
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
 
+/*
+ * The work of the main loop is blocked while the device has errors or is loading,
+ * the flag follows the soul events of these statuses
+ */
+static bool soulBlocked = true;
+static unsigned soulLostEvents = 0;
+
+static void soul_blocked_update(const soul_event_t*)
+{
+	soulBlocked = has_errors() || is_status(LOADING);
+}
+
+static uint32_t earliest(uint32_t first_ms, uint32_t second_ms)
+{
+	return (int32_t)(first_ms - second_ms) < 0 ? first_ms : second_ms;
+}
+
+static void soul_blocked_dispatch()
+{
+	soul_dispatch();
+	// A lost event could be the last change of the blocking statuses
+	if (soulLostEvents != soul_lost_events()) {
+		soulLostEvents = soul_lost_events();
+		soul_blocked_update(nullptr);
+	}
+}
+
 /* USER CODE END 0 */
 
 /**
@@ -131,6 +160,8 @@ int main(void)
 
 	SystemInfo();
 
+	trace_init();
+
 	SoulGuard<
 		RestartWatchdog,
 #if !TEST_ERRORS
@@ -143,13 +174,20 @@ int main(void)
 
 	set_status(LOADING);
 
+	soul_mask_t blockedMask = {};
+	soul_mask_add_errors(&blockedMask);
+	soul_mask_add(&blockedMask, LOADING);
+	soul_subscribe(&blockedMask, soul_blocked_update);
+	soul_blocked_update(nullptr);
+
     storage = new StorageAT(
 		eeprom_get_size() / STORAGE_PAGE_SIZE,
 		&storageDriver
 	);
 
-	while (has_errors() || is_status(LOADING)) {
+	while (soulBlocked) {
 		soulGuard.defend();
+		soul_blocked_dispatch();
 		ui.tick();
 	}
 
@@ -174,6 +212,9 @@ int main(void)
 
     bool foundError = false;
     utl::Timer errTimer(30 * SECOND_MS);
+#if SYSTEM_BEDUG
+    utl::Timer idleTimer(10 * SECOND_MS);
+#endif
 
 	set_status(WORKING);
 	while (1)
@@ -195,22 +236,49 @@ int main(void)
 
 		soulGuard.defend();
 
+		soul_blocked_dispatch();
+
+		uint32_t uiStartUs = system_micros();
 		ui.tick();
+		system_loop_tick(system_micros() - uiStartUs);
+
+		if (trace_command_tick() == 'w') {
+			soulGuard.show();
+		}
+
+#if LCD_MIRROR
+		lcd_mirror_tick();
+#endif
+
+#if SYSTEM_BEDUG
+		if (!idleTimer.wait()) {
+			idleTimer.start();
+			system_idle_show();
+			soulGuard.show();
+		}
+#endif
 
 		if (foundError && !errTimer.wait()) {
 			system_error_handler((SOUL_STATUS)get_first_error());
 		}
 
-		if (has_errors() || is_status(LOADING)) {
+		if (soulBlocked) {
 			if (!foundError) {
 				foundError = true;
 				errTimer.start();
 			}
-			continue;
+		} else {
+			foundError = false;
+
+			sensor_tick();
 		}
-		foundError = false;
 
-		sensor_tick();
+		// The sensor is not ticked while blocked
+		uint32_t deadline = earliest(soulGuard.deadline(), UI::deadline());
+		if (!soulBlocked) {
+			deadline = earliest(deadline, sensor_deadline());
+		}
+		system_idle(deadline);
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
@@ -272,7 +340,13 @@ int _write(int, uint8_t *ptr, int len) {
 	(void)ptr;
 	(void)len;
 #ifdef DEBUG
+#if LCD_MIRROR
+    lcd_mirror_wait();
+#endif
     HAL_UART_Transmit(&BEDUG_UART, (uint8_t *)ptr, static_cast<uint16_t>(len), GENERAL_TIMEOUT_MS);
+#if LCD_MIRROR
+    lcd_mirror_resume();
+#endif
     for (int DataIdx = 0; DataIdx < len; DataIdx++) {
         ITM_SendChar(*ptr++);
     }
@@ -7,6 +7,7 @@
 #include "soul.h"
 #include "sensor.h"
 #include "settings.h"
+#include "trace.h"
 #include "hal_defs.h"
 
 
@@ -77,19 +78,43 @@ void App::changeSensorMode(SENSOR_MODE mode)
 }
 
 uint16_t App::getDeadBand()
+{
+	uint8_t snstv = 0, delay = 0;
+	if (!getModeSettings(snstv, delay)) {
+		return 0;
+	}
+	return DEAD_BANDS_MMx10[snstv];
+}
+
+uint16_t App::getPropBand()
+{
+	uint8_t snstv = 0, delay = 0;
+	if (!getModeSettings(snstv, delay)) {
+		return 0;
+	}
+	return PROP_BANDS_MMx10[snstv];
+}
+
+bool App::getModeSettings(uint8_t& snstv, uint8_t& delay)
 {
 	switch(get_sensor_mode()) {
 	case SENSOR_MODE_SURFACE:
-		return DEAD_BANDS_MMx10[settings.surface_snstv];
+		snstv = settings.surface_snstv;
+		delay = settings.surface_delay;
+		return true;
 	case SENSOR_MODE_STRING:
-		return DEAD_BANDS_MMx10[settings.string_snstv];
+		snstv = settings.string_snstv;
+		delay = settings.string_delay;
+		return true;
 	case SENSOR_MODE_BIGSKI:
-		return DEAD_BANDS_MMx10[settings.bigski_snstv];
+		snstv = settings.bigski_snstv;
+		delay = settings.bigski_delay;
+		return true;
 	default:
 		BEDUG_ASSERT(false, "Unknown mode");
 		fsm.push_event(error_e{});
 		Error_Handler();
-		return 0;
+		return false;
 	}
 }
 
@@ -97,6 +122,7 @@ void App::up()
 {
 	HAL_GPIO_WritePin(VALVE_DOWN_GPIO_Port, VALVE_DOWN_Pin, GPIO_PIN_RESET);
 	HAL_GPIO_WritePin(VALVE_UP_GPIO_Port, VALVE_UP_Pin, GPIO_PIN_SET);
+	trace_point(TRACE_VALVE);
 	reset_status(AUTO_NEED_VALVE_DOWN);
 	set_status(AUTO_NEED_VALVE_UP);
 }
@@ -105,6 +131,7 @@ void App::down()
 {
 	HAL_GPIO_WritePin(VALVE_UP_GPIO_Port, VALVE_UP_Pin, GPIO_PIN_RESET);
 	HAL_GPIO_WritePin(VALVE_DOWN_GPIO_Port, VALVE_DOWN_Pin, GPIO_PIN_SET);
+	trace_point(TRACE_VALVE);
 	reset_status(AUTO_NEED_VALVE_UP);
 	set_status(AUTO_NEED_VALVE_DOWN);
 }
@@ -285,32 +312,14 @@ void App::manual_start_a::operator ()()
 
 void App::auto_start_a::operator ()()
 {
-	uint32_t measureCount = 0;
-	switch(get_sensor_mode()) {
-	case SENSOR_MODE_SURFACE:
-		deadBand = DEAD_BANDS_MMx10[settings.surface_snstv];
-		propBand = PROP_BANDS_MMx10[settings.surface_snstv];
-		sensDelayTimer.changeDelay(SENSITIVITY_DELAY_MS[settings.surface_snstv]);
-		measureCount = settings.surface_delay * WORK_DELAY_BUFFER_MS;
-		break;
-	case SENSOR_MODE_STRING:
-		deadBand = DEAD_BANDS_MMx10[settings.string_snstv];
-		propBand = PROP_BANDS_MMx10[settings.string_snstv];
-		sensDelayTimer.changeDelay(SENSITIVITY_DELAY_MS[settings.string_snstv]);
-		measureCount = settings.string_delay * WORK_DELAY_BUFFER_MS;
-		break;
-	case SENSOR_MODE_BIGSKI:
-		deadBand = DEAD_BANDS_MMx10[settings.bigski_snstv];
-		propBand = PROP_BANDS_MMx10[settings.bigski_snstv];
-		sensDelayTimer.changeDelay(SENSITIVITY_DELAY_MS[settings.bigski_snstv]);
-		measureCount = settings.bigski_delay * WORK_DELAY_BUFFER_MS;
-		break;
-	default:
-		BEDUG_ASSERT(false, "Unknown mode");
-		fsm.push_event(error_e{});
-		Error_Handler();
+	uint8_t snstv = 0, delay = 0;
+	if (!getModeSettings(snstv, delay)) {
 		return;
 	}
+	deadBand = DEAD_BANDS_MMx10[snstv];
+	propBand = PROP_BANDS_MMx10[snstv];
+	sensDelayTimer.changeDelay(SENSITIVITY_DELAY_MS[snstv]);
+	uint32_t measureCount = delay * WORK_DELAY_BUFFER_MS;
 
 	if (!measureCount) {
 		measureCount = 1;
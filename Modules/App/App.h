@@ -116,6 +116,9 @@ protected:
 	static bool isOnDeadBand();
 	static bool isOnPropBand();
 
+	// Sensitivity and delay settings of the current sensor mode, false for an unknown mode
+	static bool getModeSettings(uint8_t& snstv, uint8_t& delay);
+
 private:
 	utl::Timer measureTimer;
 
@@ -137,6 +140,7 @@ public:
 	static void changeSensorMode(SENSOR_MODE mode);
 
 	static uint16_t getDeadBand();
+	static uint16_t getPropBand();
 
 };
 
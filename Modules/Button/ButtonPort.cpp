@@ -0,0 +1,115 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#include "ButtonPort.h"
+
+#include "gtime.h"
+
+
+ButtonPort::ButtonPort(GPIO_TypeDef* port, uint16_t mask, bool inverse, uint32_t holdTime):
+	port(port), mask(mask), inverse(inverse), holdTimeMs(holdTime), sampleCycles(0),
+	count0(0xFFFF), count1(0xFFFF), count2(0xFFFF), state(0), holded(0), pressTime(),
+	events(), eventsHead(0), eventsTail(0), eventsLost(0)
+{}
+
+void ButtonPort::tick()
+{
+	// The time of the events and the hold timer only: a late SysTick must not drop the sample
+	uint32_t now = getMillis();
+
+	sampleCycles = DWT->CYCCNT;
+	uint16_t sample = (uint16_t)port->IDR;
+	if (inverse) {
+		sample = (uint16_t)~sample;
+	}
+	sample &= mask;
+
+	// A pressed pin reading released counts 7, 6 ... 0 and is released at the next released sample,
+	// a pressed sample reloads the counter, so the bounce of the release restarts the count
+	static_assert(BUTTON_RELEASE_SAMPLES == 8, "The release counter of count0..count2 is 3 bits wide");
+	uint16_t current      = state;
+	uint16_t pressedPins  = (uint16_t)(sample & ~current);
+	uint16_t releasing    = (uint16_t)(current & ~sample);
+	uint16_t releasedPins = (uint16_t)(releasing & ~(count0 | count1 | count2));
+	count2  = (uint16_t)((count2 ^ (~count0 & ~count1)) | ~releasing);
+	count1  = (uint16_t)((count1 ^ ~count0) | ~releasing);
+	count0  = (uint16_t)(~count0 | ~releasing);
+	current = (uint16_t)((current | pressedPins) & ~releasedPins);
+	state   = current;
+
+	for (uint16_t pins = pressedPins; pins; pins = (uint16_t)(pins & (pins - 1))) {
+		pressTime[__builtin_ctz(pins)] = now;
+	}
+	holded = (uint16_t)(holded & current);
+	push(pressedPins, BUTTON_PRESS, now);
+	push(releasedPins, BUTTON_RELEASE, now);
+
+	uint16_t holdPins = 0;
+	for (uint16_t pins = (uint16_t)(current & ~holded); pins; pins = (uint16_t)(pins & (pins - 1))) {
+		unsigned index = (unsigned)__builtin_ctz(pins);
+		if (now - pressTime[index] > holdTimeMs) {
+			holdPins = (uint16_t)(holdPins | (1 << index));
+		}
+	}
+	holded = (uint16_t)(holded | holdPins);
+	push(holdPins, BUTTON_HOLD, now);
+}
+
+bool ButtonPort::popEvent(button_event_t& event)
+{
+	uint8_t tail = eventsTail;
+	if (tail == eventsHead) {
+		return false;
+	}
+	__DMB();
+	event = events[tail];
+	__DMB();
+	eventsTail = (uint8_t)((tail + 1) & (EVENTS_SIZE - 1));
+	return true;
+}
+
+bool ButtonPort::hasEvents()
+{
+	return eventsTail != eventsHead;
+}
+
+void ButtonPort::clearEvents()
+{
+	eventsTail = eventsHead;
+}
+
+uint32_t ButtonPort::lostEvents()
+{
+	return eventsLost;
+}
+
+uint32_t ButtonPort::lastSampleCycles()
+{
+	return sampleCycles;
+}
+
+bool ButtonPort::pressed(uint16_t pin)
+{
+	return state & pin;
+}
+
+bool ButtonPort::isHolded(uint16_t pin)
+{
+	return state & holded & pin;
+}
+
+void ButtonPort::push(const uint16_t pins, const BUTTON_EVENT type, const uint32_t time)
+{
+	for (uint16_t rest = pins; rest; rest = (uint16_t)(rest & (rest - 1))) {
+		uint8_t head = eventsHead;
+		uint8_t next = (uint8_t)((head + 1) & (EVENTS_SIZE - 1));
+		if (next == eventsTail) {
+			eventsLost = eventsLost + 1;
+			continue;
+		}
+		events[head].pin  = (uint16_t)(rest & (uint16_t)(~rest + 1));
+		events[head].type = (uint8_t)type;
+		events[head].time = time;
+		__DMB();
+		eventsHead = next;
+	}
+}
@@ -0,0 +1,90 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#ifndef _BUTTON_PORT_H_
+#define _BUTTON_PORT_H_
+
+
+#include <stdint.h>
+
+#include "hal_defs.h"
+
+
+// Period of the port samples: tick() is called by every BTN_TIM update
+#define BUTTON_SAMPLE_MS (5)
+// A press is accepted at the first pressed sample, a release after 8 released samples in a row
+#define BUTTON_RELEASE_SAMPLES (8)
+
+
+typedef enum _BUTTON_EVENT {
+	BUTTON_PRESS = 0,
+	BUTTON_RELEASE,
+	BUTTON_HOLD
+} BUTTON_EVENT;
+
+typedef struct _button_event_t {
+	uint16_t pin;
+	uint8_t  type;
+	uint32_t time;
+} button_event_t;
+
+
+/*
+ * Buttons of one GPIO port.
+ * tick() (the timer interrupt) reads the port IDR once per call, the timer is the sample clock.
+ * A released pin is pressed at the first pressed sample (the leading edge),
+ * the release of all the pins of the mask is debounced by the 3 bit vertical counters.
+ * The press, release and hold events are pushed into the single producer
+ * single consumer queue that is read by popEvent() outside the interrupt.
+ */
+class ButtonPort
+{
+private:
+	static constexpr uint32_t DEFAULT_HOLD_TIME_MS = 1500;
+
+	// Power of 2
+	static const uint8_t EVENTS_SIZE = 16;
+	static const uint8_t PINS_COUNT  = 16;
+
+	GPIO_TypeDef* port;
+	uint16_t mask;
+	bool inverse;
+	uint32_t holdTimeMs;
+
+	// DWT cycles of the last port read
+	volatile uint32_t sampleCycles;
+
+	// Release vertical counter bits of every pin
+	uint16_t count0;
+	uint16_t count1;
+	uint16_t count2;
+	volatile uint16_t state;
+	volatile uint16_t holded;
+	uint32_t pressTime[PINS_COUNT];
+
+	button_event_t events[EVENTS_SIZE];
+	volatile uint8_t eventsHead;
+	volatile uint8_t eventsTail;
+	volatile uint32_t eventsLost;
+
+	void push(const uint16_t pins, const BUTTON_EVENT type, const uint32_t time);
+
+public:
+	ButtonPort(GPIO_TypeDef* port, uint16_t mask, bool inverse = false, uint32_t holdTime = DEFAULT_HOLD_TIME_MS);
+
+	void tick();
+
+	// The next event, the consumer side of the queue
+	bool popEvent(button_event_t& event);
+	bool hasEvents();
+	void clearEvents();
+	uint32_t lostEvents();
+	// The DWT cycles of the last sample, the press of this sample is at its first raw edge
+	uint32_t lastSampleCycles();
+
+	bool pressed(uint16_t pin);
+	bool isHolded(uint16_t pin);
+
+};
+
+
+#endif
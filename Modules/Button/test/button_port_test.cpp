@@ -0,0 +1,198 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * ButtonPort tests on a fake port: the press is accepted at the leading edge,
+ * the bouncing press and release give one event each, the release waits
+ * BUTTON_RELEASE_SAMPLES samples, the hold fires once and the full queue counts the lost events.
+ * The benchmark prints the host cycles of one sample.
+ */
+
+#include <cstdio>
+
+#include "test.h"
+#include "bench.h"
+#include "main.h"
+#include "gtime.h"
+#include "ButtonPort.h"
+
+
+static const uint32_t HOLD_MS = 1000;
+static const unsigned BENCH_SAMPLES = 100000;
+
+static GPIO_TypeDef gpio = {};
+
+
+// One sample of the port with the pins pressed
+static void sample(ButtonPort& buttons, uint16_t pins)
+{
+	gpio.IDR = pins;
+	test_millis += BUTTON_SAMPLE_MS;
+	buttons.tick();
+}
+
+static bool popType(ButtonPort& buttons, uint16_t pin, BUTTON_EVENT type, uint32_t* time = nullptr)
+{
+	button_event_t event = {};
+	if (!buttons.popEvent(event) || event.pin != pin || event.type != type) {
+		return false;
+	}
+	if (time) {
+		*time = event.time;
+	}
+	return true;
+}
+
+static void test_press_leading_edge()
+{
+	ButtonPort buttons(&gpio, BTN_UP_Pin | BTN_DOWN_Pin, false, HOLD_MS);
+	sample(buttons, 0);
+	TEST_CHECK(!buttons.hasEvents());
+
+	sample(buttons, BTN_UP_Pin);
+	uint32_t time = 0;
+	TEST_CHECK(buttons.pressed(BTN_UP_Pin));
+	TEST_CHECK(popType(buttons, BTN_UP_Pin, BUTTON_PRESS, &time));
+	TEST_CHECK(time == test_millis);
+	TEST_CHECK(!buttons.pressed(BTN_DOWN_Pin));
+}
+
+static void test_press_bounce()
+{
+	ButtonPort buttons(&gpio, BTN_UP_Pin, false, HOLD_MS);
+	sample(buttons, 0);
+	const uint16_t bounce[] = {BTN_UP_Pin, 0, BTN_UP_Pin, 0, BTN_UP_Pin, BTN_UP_Pin, BTN_UP_Pin};
+	for (uint16_t pins : bounce) {
+		sample(buttons, pins);
+		TEST_CHECK(buttons.pressed(BTN_UP_Pin));
+	}
+	TEST_CHECK(popType(buttons, BTN_UP_Pin, BUTTON_PRESS));
+	TEST_CHECK(!buttons.hasEvents());
+}
+
+static void test_release_bounce()
+{
+	ButtonPort buttons(&gpio, BTN_UP_Pin, false, HOLD_MS);
+	sample(buttons, BTN_UP_Pin);
+	buttons.clearEvents();
+
+	// The pressed samples between the released ones restart the release count
+	const uint16_t bounce[] = {0, BTN_UP_Pin, 0, 0, BTN_UP_Pin, 0};
+	for (uint16_t pins : bounce) {
+		sample(buttons, pins);
+		TEST_CHECK(buttons.pressed(BTN_UP_Pin));
+	}
+	for (unsigned i = 1; i < BUTTON_RELEASE_SAMPLES - 1; i++) {
+		sample(buttons, 0);
+		TEST_CHECK(buttons.pressed(BTN_UP_Pin));
+	}
+	TEST_CHECK(!buttons.hasEvents());
+
+	sample(buttons, 0);
+	TEST_CHECK(!buttons.pressed(BTN_UP_Pin));
+	TEST_CHECK(popType(buttons, BTN_UP_Pin, BUTTON_RELEASE));
+	TEST_CHECK(!buttons.hasEvents());
+
+	// The next press is at the leading edge again
+	sample(buttons, BTN_UP_Pin);
+	TEST_CHECK(popType(buttons, BTN_UP_Pin, BUTTON_PRESS));
+}
+
+/* A late SysTick (the same millisecond in the next timer update) does not drop the sample */
+static void test_stale_millis()
+{
+	ButtonPort buttons(&gpio, BTN_UP_Pin, false, HOLD_MS);
+	sample(buttons, 0);
+
+	gpio.IDR = BTN_UP_Pin;
+	buttons.tick();
+	TEST_CHECK(popType(buttons, BTN_UP_Pin, BUTTON_PRESS));
+
+	gpio.IDR = 0;
+	for (unsigned i = 0; i < BUTTON_RELEASE_SAMPLES - 1; i++) {
+		test_millis += BUTTON_SAMPLE_MS - 1;
+		buttons.tick();
+	}
+	TEST_CHECK(buttons.pressed(BTN_UP_Pin));
+	buttons.tick();
+	TEST_CHECK(popType(buttons, BTN_UP_Pin, BUTTON_RELEASE));
+}
+
+static void test_inverse()
+{
+	ButtonPort buttons(&gpio, BTN_ENTER_Pin, true, HOLD_MS);
+	sample(buttons, 0xFFFF);
+	TEST_CHECK(!buttons.hasEvents());
+	sample(buttons, (uint16_t)~BTN_ENTER_Pin);
+	TEST_CHECK(popType(buttons, BTN_ENTER_Pin, BUTTON_PRESS));
+}
+
+static void test_hold_once()
+{
+	ButtonPort buttons(&gpio, BTN_MODE_Pin, false, HOLD_MS);
+	sample(buttons, BTN_MODE_Pin);
+	TEST_CHECK(popType(buttons, BTN_MODE_Pin, BUTTON_PRESS));
+
+	unsigned holds = 0;
+	for (uint32_t ms = 0; ms < 3 * HOLD_MS; ms += BUTTON_SAMPLE_MS) {
+		sample(buttons, BTN_MODE_Pin);
+		holds += popType(buttons, BTN_MODE_Pin, BUTTON_HOLD);
+	}
+	TEST_CHECK(holds == 1);
+	TEST_CHECK(buttons.isHolded(BTN_MODE_Pin));
+
+	for (unsigned i = 0; i < BUTTON_RELEASE_SAMPLES; i++) {
+		sample(buttons, 0);
+	}
+	TEST_CHECK(popType(buttons, BTN_MODE_Pin, BUTTON_RELEASE));
+	TEST_CHECK(!buttons.isHolded(BTN_MODE_Pin));
+}
+
+static void test_queue_overflow()
+{
+	ButtonPort buttons(&gpio, BTN_F1_Pin, false, HOLD_MS);
+	unsigned events = 0;
+	for (unsigned i = 0; i < 20; i++) {
+		sample(buttons, BTN_F1_Pin);
+		events++;
+		for (unsigned j = 0; j < BUTTON_RELEASE_SAMPLES; j++) {
+			sample(buttons, 0);
+		}
+		events++;
+	}
+	unsigned popped = 0;
+	button_event_t event = {};
+	while (buttons.popEvent(event)) {
+		popped++;
+	}
+	TEST_CHECK(popped + buttons.lostEvents() == events);
+	TEST_CHECK(buttons.lostEvents() > 0);
+}
+
+static void bench_tick()
+{
+	ButtonPort buttons(&gpio, BTN_F1_Pin | BTN_F2_Pin | BTN_F3_Pin | BTN_UP_Pin | BTN_DOWN_Pin);
+	uint16_t pins = 0;
+	uint64_t start = bench_cycles();
+	for (unsigned i = 0; i < BENCH_SAMPLES; i++) {
+		// Every 64th sample toggles the pins, the events are dropped by the full queue
+		if (!(i & 63)) {
+			pins = (uint16_t)(pins ^ (BTN_UP_Pin | BTN_DOWN_Pin));
+		}
+		sample(buttons, pins);
+	}
+	BENCH_RESULT("ButtonPort::tick", bench_cycles() - start, BENCH_SAMPLES);
+}
+
+
+int main()
+{
+	test_press_leading_edge();
+	test_press_bounce();
+	test_release_bounce();
+	test_stale_millis();
+	test_inverse();
+	test_hold_once();
+	test_queue_overflow();
+	bench_tick();
+	return TEST_RESULT();
+}
@@ -104,6 +104,54 @@ const char T_Language[][TRANSLATE_MAX_LEN] = {
 	"Language",
 	""
 };
+const char T_DIAGNOSTICS[][TRANSLATE_MAX_LEN] = {
+	"DIAGNOSTICS",
+	""
+};
+const char T_Main_loop[][TRANSLATE_MAX_LEN] = {
+	"Main loop",
+	" "
+};
+const char T_UI_tick_max[][TRANSLATE_MAX_LEN] = {
+	"UI tick max",
+	".  UI"
+};
+const char T_CAN_frames[][TRANSLATE_MAX_LEN] = {
+	"CAN frames",
+	" CAN"
+};
+const char T_Sample_age[][TRANSLATE_MAX_LEN] = {
+	"Sample age",
+	" "
+};
+const char T_Free_RAM[][TRANSLATE_MAX_LEN] = {
+	"Free RAM",
+	" "
+};
+const char T_EEPROM_errors[][TRANSLATE_MAX_LEN] = {
+	"EEPROM errors",
+	" EEPROM"
+};
+const char T_Uptime[][TRANSLATE_MAX_LEN] = {
+	"Uptime",
+	" "
+};
+const char T_Hz[][TRANSLATE_MAX_LEN] = {
+	"Hz",
+	""
+};
+const char T_us[][TRANSLATE_MAX_LEN] = {
+	"us",
+	""
+};
+const char T_ms[][TRANSLATE_MAX_LEN] = {
+	"ms",
+	""
+};
+const char T_bytes[][TRANSLATE_MAX_LEN] = {
+	"B",
+	""
+};
 const char T_UPDATING_SETTINGS[][TRANSLATE_MAX_LEN] = {
 	"UPDATING SETTINGS",
 	" "
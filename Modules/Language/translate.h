@@ -50,6 +50,18 @@ extern const char T_Version[][TRANSLATE_MAX_LEN];
 extern const char T_Sensitivity[][TRANSLATE_MAX_LEN];
 extern const char T_Delay[][TRANSLATE_MAX_LEN];
 extern const char T_Language[][TRANSLATE_MAX_LEN];
+extern const char T_DIAGNOSTICS[][TRANSLATE_MAX_LEN];
+extern const char T_Main_loop[][TRANSLATE_MAX_LEN];
+extern const char T_UI_tick_max[][TRANSLATE_MAX_LEN];
+extern const char T_CAN_frames[][TRANSLATE_MAX_LEN];
+extern const char T_Sample_age[][TRANSLATE_MAX_LEN];
+extern const char T_Free_RAM[][TRANSLATE_MAX_LEN];
+extern const char T_EEPROM_errors[][TRANSLATE_MAX_LEN];
+extern const char T_Uptime[][TRANSLATE_MAX_LEN];
+extern const char T_Hz[][TRANSLATE_MAX_LEN];
+extern const char T_us[][TRANSLATE_MAX_LEN];
+extern const char T_ms[][TRANSLATE_MAX_LEN];
+extern const char T_bytes[][TRANSLATE_MAX_LEN];
 extern const char T_UPDATING_SETTINGS[][TRANSLATE_MAX_LEN];
 extern const char T_RESETING_CHANGES[][TRANSLATE_MAX_LEN];
 extern const char T_RESET_ERROR[][TRANSLATE_MAX_LEN];
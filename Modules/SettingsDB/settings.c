@@ -105,6 +105,9 @@ void settings_reset(settings_t* other)
 	other->bigski_snstv = 0;
 	other->bigski_delay = SETTNNGS_WORK_DELAY_DEFAULT_S;
 	memset((void*)other->bigski_target, 0, sizeof(other->bigski_target));
+
+	other->display_spi_write = SETTINGS_SPI_DIVIDER_NONE;
+	other->display_spi_read  = SETTINGS_SPI_DIVIDER_NONE;
 }
 
 uint32_t settings_size()
@@ -112,7 +115,6 @@ uint32_t settings_size()
 	return sizeof(settings_t);
 }
 
-// TODO: version updater (if version older than current -> update settings)
 bool settings_check(settings_t* other)
 {
 	if (other->dv_type != DEVICE_TYPE) {
@@ -124,6 +126,9 @@ bool settings_check(settings_t* other)
 	if (other->fw_id != FW_VERSION) {
 		return false;
 	}
+	if (other->cf_id != CF_VERSION) {
+		return false;
+	}
 	if (!IS_LANGUAGE(other->language)) {
 		return false;
 	}
@@ -151,6 +156,14 @@ void settings_repair(settings_t* other)
 		other->fw_id = FW_VERSION;
 	}
 
+	/* The v1 record is loaded with the v2 size: the bytes after it are not the dividers */
+	if (other->cf_id == 0x01) {
+		printTagLog(SETTINGS_TAG, "Update settings v%lu -> v%u", other->cf_id, CF_VERSION);
+		other->cf_id             = CF_VERSION;
+		other->display_spi_write = SETTINGS_SPI_DIVIDER_NONE;
+		other->display_spi_read  = SETTINGS_SPI_DIVIDER_NONE;
+	}
+
 	if (!settings_check(other)) {
 		settings_reset(other);
 	}
@@ -190,5 +203,8 @@ void settings_show()
 	for (unsigned i = 0; i < __arr_len(settings.bigski_target); i++) {
 		printPretty("Last target[%u]: %d\n", i, settings.bigski_target[i]);
 	}
+    printPretty("--------------------DISPLAY---------------------\n");
+	printPretty("SPI write divider: %u\n", settings.display_spi_write);
+	printPretty("SPI read divider: %u\n", settings.display_spi_read);
     printPretty("####################SETTINGS####################\n\n");
 }
@@ -29,13 +29,19 @@ extern "C" {
 #define DEVICE_TYPE ((uint16_t)0x0004)
 #define SW_VERSION  ((uint8_t)0x01)
 #define FW_VERSION  ((uint8_t)0x01)
-#define CF_VERSION  ((uint8_t)0x01)
+/*
+ * Configuration versions:
+ * 0x01 - first settings_t
+ * 0x02 - display_spi_write and display_spi_read are added at the end
+ */
+#define CF_VERSION  ((uint8_t)0x02)
 
 
 #define SETTINGS_BIGSKI_COUNT          (3)
 #define SETTINGS_BANDS_COUNT           (10)
 #define SETTNNGS_WORK_DELAY_DEFAULT_S  (0)
 #define SETTINGS_WORK_DELAY_MAX_S      (40)
+#define SETTINGS_SPI_DIVIDER_NONE      ((uint8_t)0xFF)
 
 
 extern const uint8_t  SENSITIVITY[SETTINGS_BANDS_COUNT];
@@ -83,6 +89,11 @@ typedef struct __attribute__((packed)) _settings_t  {
     uint8_t   bigski_delay;
     // Last BIGSKI target sensor value
     int16_t   bigski_target[SETTINGS_BIGSKI_COUNT];
+
+    // Display SPI write clock divider (SETTINGS_SPI_DIVIDER_NONE - not calibrated)
+    uint8_t   display_spi_write;
+    // Display SPI read clock divider (SETTINGS_SPI_DIVIDER_NONE - not calibrated)
+    uint8_t   display_spi_read;
 } settings_t;
 
 
@@ -0,0 +1,76 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Settings tests: the configuration v1 record is updated to the current version
+ */
+
+#include <string.h>
+
+#include "test.h"
+#include "soul.h"
+#include "settings.h"
+#include "translate.h"
+
+
+/* The v1 record loaded with the current size: the flash bytes after it follow */
+static void test_update_v1()
+{
+	settings_t record;
+	settings_reset(&record);
+	record.cf_id          = 0x01;
+	record.language       = RUSSIAN;
+	record.string_snstv   = 3;
+	record.string_delay   = 7;
+	record.bigski_target[1] = -120;
+	record.display_spi_write = 0x00;
+	record.display_spi_read  = 0x12;
+
+	settings_set(&record);
+
+	TEST_CHECK(settings.cf_id == CF_VERSION);
+	TEST_CHECK(settings.language == RUSSIAN);
+	TEST_CHECK(settings.string_snstv == 3);
+	TEST_CHECK(settings.string_delay == 7);
+	TEST_CHECK(settings.bigski_target[1] == -120);
+	TEST_CHECK(settings.display_spi_write == SETTINGS_SPI_DIVIDER_NONE);
+	TEST_CHECK(settings.display_spi_read == SETTINGS_SPI_DIVIDER_NONE);
+	TEST_CHECK(is_status(NEED_SAVE_SETTINGS));
+	TEST_CHECK(settings_check(&settings));
+}
+
+static void test_reset_unknown()
+{
+	settings_t record;
+	settings_reset(&record);
+	record.cf_id    = 0x7F;
+	record.language = RUSSIAN;
+
+	settings_set(&record);
+
+	TEST_CHECK(settings.cf_id == CF_VERSION);
+	TEST_CHECK(settings.language == ENGLISH);
+}
+
+static void test_current()
+{
+	settings_t record;
+	settings_reset(&record);
+	record.display_spi_write = 2;
+	record.display_spi_read  = 3;
+	reset_status(NEED_SAVE_SETTINGS);
+
+	settings_set(&record);
+
+	TEST_CHECK(settings.display_spi_write == 2);
+	TEST_CHECK(settings.display_spi_read == 3);
+	TEST_CHECK(!is_status(NEED_SAVE_SETTINGS));
+}
+
+
+int main()
+{
+	test_update_v1();
+	test_reset_unknown();
+	test_current();
+	return TEST_RESULT();
+}
@@ -3,11 +3,15 @@
 #pragma once
 
 
-#include <variant>
-#include <unordered_map>
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <type_traits>
 
 #include "glog.h"
 #include "main.h"
+#include "gtime.h"
 #include "soul.h"
 #include "settings.h"
 
@@ -16,6 +20,20 @@
 #include "TypeListBuilder.h"
 
 
+#define SOUL_GUARD_BEDUG (false)
+
+
+struct watchdog_stats_t
+{
+	uint32_t runs;
+	uint32_t late;
+	uint32_t lastRunMs;
+	uint32_t lastDurationMs;
+	uint32_t maxDurationMs;
+	uint32_t maxIntervalMs;
+};
+
+
 template<class... Watchdogs>
 struct SoulGuard
 {
@@ -32,53 +50,177 @@ private:
 
 	static constexpr char TAG[] = "SGRD";
 
-	using watchdog_v = std::variant<Watchdogs...>;
+	static constexpr unsigned WATCHDOGS_COUNT = sizeof...(Watchdogs);
+
+	using check_f = void (*)(SoulGuard&);
+	using ready_f = bool (*)(const SoulGuard&);
+
+	// A watchdog with ready() is checked by its PERIOD_MS only while ready, otherwise by LATENCY_MS
+	template<class Watchdog, class = void>
+	struct has_ready: std::false_type {};
+
+	template<class Watchdog>
+	struct has_ready<Watchdog, std::void_t<decltype(std::declval<const Watchdog&>().ready())>>: std::true_type {};
+
+	static constexpr uint32_t periods[WATCHDOGS_COUNT]   = { Watchdogs::PERIOD_MS... };
+	static constexpr uint32_t latencies[WATCHDOGS_COUNT] = { Watchdogs::LATENCY_MS... };
 
-	void check(watchdog_v watchdog)
+	std::tuple<Watchdogs...> watchdogs;
+	watchdog_stats_t stats[WATCHDOGS_COUNT];
+
+	template<std::size_t I>
+	static void check(SoulGuard& guard)
 	{
-		auto lambda = [](auto& wtchdg) {
-			wtchdg.check();
-		};
+		std::get<I>(guard.watchdogs).check();
+	}
 
-		std::visit(lambda, watchdog);
+	template<std::size_t I>
+	static bool ready(const SoulGuard& guard)
+	{
+		return std::get<I>(guard.watchdogs).ready();
 	}
 
-	using watchdogs_pack = utl::simple_list_t<Watchdogs...>;
+	template<std::size_t... I>
+	static constexpr auto make_checks(std::index_sequence<I...>)
+	{
+		return std::array<check_f, sizeof...(I)>{ &check<I>... };
+	}
 
-	std::unordered_map<unsigned, watchdog_v> watchdogs;
-	unsigned index;
+	template<std::size_t I>
+	static constexpr ready_f ready_of()
+	{
+		if constexpr (has_ready<std::tuple_element_t<I, std::tuple<Watchdogs...>>>::value) {
+			return &ready<I>;
+		} else {
+			return nullptr;
+		}
+	}
 
-	template<class... WList>
-	void set_watchdogs(utl::simple_list_t<WList...>)
+	template<std::size_t... I>
+	static constexpr auto make_readies(std::index_sequence<I...>)
 	{
-		(set_watchdog(utl::getType<WList>{}), ...);
+		return std::array<ready_f, sizeof...(I)>{ ready_of<I>()... };
 	}
 
-	template<class Watchdog>
-	void set_watchdog(utl::getType<Watchdog>)
+	// Index to watchdog dispatch table built at compile time
+	static constexpr std::array<check_f, WATCHDOGS_COUNT> checks =
+		make_checks(std::make_index_sequence<WATCHDOGS_COUNT>{});
+	static constexpr std::array<ready_f, WATCHDOGS_COUNT> readies =
+		make_readies(std::make_index_sequence<WATCHDOGS_COUNT>{});
+
+	template<class Watchdog, std::size_t... I>
+	static constexpr unsigned index_of(std::index_sequence<I...>)
 	{
-		watchdogs.insert({index++, Watchdog{}});
+		static_assert((std::is_same_v<Watchdog, Watchdogs> || ...), "The watchdog is not in the soul guard");
+		unsigned result = 0;
+		((result = std::is_same_v<Watchdog, Watchdogs> ? I : result), ...);
+		return result;
 	}
 
-public:
-	SoulGuard()
+	// The minimal interval to the next check: LATENCY_MS of the not ready watchdog
+	uint32_t limit(unsigned index) const
 	{
-		index = 0;
-		set_watchdogs(watchdogs_pack{});
+		return (readies[index] && !readies[index](*this)) ? latencies[index] : periods[index];
 	}
 
+	/*
+	 * Earliest deadline first: among the watchdogs whose period has elapsed
+	 * returns the one with the least time left to its LATENCY_MS
+	 * Returns WATCHDOGS_COUNT if no watchdog is ready
+	 */
+	unsigned next(uint32_t now) const
+	{
+		unsigned result = WATCHDOGS_COUNT;
+		int32_t minSlack = INT32_MAX;
+		for (unsigned i = 0; i < WATCHDOGS_COUNT; i++) {
+			uint32_t passed = now - stats[i].lastRunMs;
+			if (stats[i].runs && passed < limit(i)) {
+				continue;
+			}
+			int32_t slack = static_cast<int32_t>(latencies[i] - passed);
+			if (!stats[i].runs) {
+				slack = INT32_MIN;
+			}
+			if (slack < minSlack) {
+				minSlack = slack;
+				result   = i;
+			}
+		}
+		return result;
+	}
+
+public:
+	SoulGuard(): watchdogs(), stats() {}
+
 	void defend()
 	{
-		auto it = watchdogs.find(index++);
-		if (it == watchdogs.end()) {
-			index = 0;
+		uint32_t now = getMillis();
+		unsigned index = next(now);
+		if (index >= WATCHDOGS_COUNT) {
 			return;
 		}
 
-		auto lambda = [] (auto& watchdog) {
-			watchdog.check();
-		};
+		watchdog_stats_t& stat = stats[index];
+		if (stat.runs) {
+			uint32_t interval = now - stat.lastRunMs;
+			if (interval > stat.maxIntervalMs) {
+				stat.maxIntervalMs = interval;
+			}
+			if (interval > latencies[index]) {
+				stat.late++;
+#if SOUL_GUARD_BEDUG
+				printTagLog(TAG, "watchdog %u late: %lu ms", index, interval);
+#endif
+			}
+		}
+
+		checks[index](*this);
+
+		stat.runs++;
+		stat.lastRunMs      = now;
+		stat.lastDurationMs = getMillis() - now;
+		if (stat.lastDurationMs > stat.maxDurationMs) {
+			stat.maxDurationMs = stat.lastDurationMs;
+		}
+	}
 
-		std::visit(lambda, it->second);
+	// The nearest time (ms) when one of the watchdogs has to be checked
+	uint32_t deadline() const
+	{
+		uint32_t now = getMillis();
+		uint32_t minWait = UINT32_MAX;
+		for (unsigned i = 0; i < WATCHDOGS_COUNT; i++) {
+			uint32_t passed = now - stats[i].lastRunMs;
+			if (!stats[i].runs || passed >= limit(i)) {
+				return now;
+			}
+			if (limit(i) - passed < minWait) {
+				minWait = limit(i) - passed;
+			}
+		}
+		return now + minWait;
+	}
+
+	template<class Watchdog>
+	const watchdog_stats_t& statistics() const
+	{
+		return stats[index_of<Watchdog>(std::make_index_sequence<WATCHDOGS_COUNT>{})];
+	}
+
+	void show() const
+	{
+		for (unsigned i = 0; i < WATCHDOGS_COUNT; i++) {
+			printTagLog(
+				TAG,
+				"watchdog %u: runs=%lu late=%lu duration=%lu(max %lu)ms interval max=%lu(limit %lu)ms",
+				i,
+				stats[i].runs,
+				stats[i].late,
+				stats[i].lastDurationMs,
+				stats[i].maxDurationMs,
+				stats[i].maxIntervalMs,
+				latencies[i]
+			);
+		}
 	}
 };
@@ -15,16 +15,11 @@
 
 
 MemoryWatchdog::MemoryWatchdog():
-	errorTimer(TIMEOUT_MS), timer(SECOND_MS), errors(0), timerStarted(false)
+	errorTimer(TIMEOUT_MS), errors(0), timerStarted(false)
 	{}
 
 void MemoryWatchdog::check()
 {
-	if (timer.wait()) {
-		return;
-	}
-	timer.start();
-
 	uint8_t data = 0;
 	eeprom_status_t status = EEPROM_OK;
 	if (is_status(MEMORY_READ_FAULT) ||
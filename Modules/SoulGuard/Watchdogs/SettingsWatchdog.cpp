@@ -27,6 +27,11 @@ void SettingsWatchdog::check()
 	fsm.proccess();
 }
 
+bool SettingsWatchdog::ready() const
+{
+	return is_status(LOADING) || is_status(NEED_SAVE_SETTINGS) || is_status(NEED_LOAD_SETTINGS);
+}
+
 void SettingsWatchdog::state_init::operator ()() const
 {
 	SettingsDB settingsDB(reinterpret_cast<uint8_t*>(&settings), settings_size());
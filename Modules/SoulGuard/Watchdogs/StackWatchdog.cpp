@@ -19,7 +19,6 @@
 
 
 unsigned StackWatchdog::lastFree = 0;
-utl::Timer StackWatchdog::timer(WATCHDOG_TIMEOUT_MS);
 
 
 void STACK_WATCHDOG_FILL_RAM(void) {
@@ -37,11 +36,6 @@ void StackWatchdog::check()
 {
 	utl::CodeStopwatch stopwatch("STKw", WATCHDOG_TIMEOUT_MS);
 
-	if (timer.wait()) {
-		return;
-	}
-	timer.start();
-
 	extern unsigned _ebss;
 	unsigned *start, *end;
 	__asm__ volatile ("mov %[end], sp" : [end] "=r" (end) : : );
@@ -95,3 +89,8 @@ void StackWatchdog::check()
 		);
 	}
 }
+
+unsigned StackWatchdog::freeRam()
+{
+	return lastFree;
+}
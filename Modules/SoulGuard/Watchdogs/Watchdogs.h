@@ -27,8 +27,19 @@
 extern "C" void STACK_WATCHDOG_FILL_RAM(void);
 
 
+/*
+ * Every watchdog declares PERIOD_MS (minimal interval between checks)
+ * and LATENCY_MS (maximal allowed interval between checks).
+ * SoulGuard runs the ready watchdog with the nearest latency deadline.
+ * An event driven watchdog also declares ready(): the main loop sleeps
+ * to its LATENCY_MS deadline while it is not ready.
+ */
+
 struct PowerWatchdog
 {
+	static constexpr uint32_t PERIOD_MS  = 10;
+	static constexpr uint32_t LATENCY_MS = 50;
+
 	void check();
 };
 
@@ -37,17 +48,25 @@ struct StackWatchdog
 private:
 	static constexpr char TAG[] = "STCK";
 	static unsigned lastFree;
-	static utl::Timer timer;
 
 public:
+	static constexpr uint32_t PERIOD_MS  = WATCHDOG_TIMEOUT_MS;
+	static constexpr uint32_t LATENCY_MS = 10 * WATCHDOG_TIMEOUT_MS;
+
 	void check();
 
+	// The minimal free RAM bytes by the last check
+	static unsigned freeRam();
+
 };
 
 
 struct RestartWatchdog
 {
 public:
+	static constexpr uint32_t PERIOD_MS  = WATCHDOG_TIMEOUT_MS;
+	static constexpr uint32_t LATENCY_MS = 10 * WATCHDOG_TIMEOUT_MS;
+
 	// TODO: check IWDG or another reboot
 	void check();
 
@@ -68,11 +87,13 @@ private:
 	static constexpr uint32_t TIMEOUT_MS = 15000;
 
 	utl::Timer errorTimer;
-	utl::Timer timer;
 	uint8_t errors;
 	bool timerStarted;
 
 public:
+	static constexpr uint32_t PERIOD_MS  = SECOND_MS;
+	static constexpr uint32_t LATENCY_MS = 5 * SECOND_MS;
+
 	MemoryWatchdog();
 
 	void check();
@@ -113,8 +134,14 @@ private:
 	static constexpr char TAG[] = "STGw";
 
 public:
+	static constexpr uint32_t PERIOD_MS  = 0;
+	static constexpr uint32_t LATENCY_MS = SECOND_MS;
+
 	SettingsWatchdog();
 
 	void check();
 
+	// The settings are loading or have to be saved or loaded
+	bool ready() const;
+
 };
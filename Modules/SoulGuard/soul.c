@@ -5,17 +5,41 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "glog.h"
+#include "main.h"
+
+
+typedef struct _soul_subscription_t {
+	soul_mask_t       mask;
+	soul_subscriber_f subscriber;
+} soul_subscription_t;
+
+
+static const char SOUL_TAG[] = "SOUL";
 
 static soul_t soul = {
 	.last_err = 0,
 	.statuses = { 0 }
 };
 
+static struct {
+	soul_event_t events[SOUL_EVENTS_SIZE];
+	volatile unsigned head;
+	volatile unsigned tail;
+	volatile unsigned lost;
+} soul_queue = { 0 };
+
+static soul_subscription_t soul_subscriptions[SOUL_SUBSCRIBERS_MAX] = { 0 };
+static unsigned soul_subscriptions_count = 0;
+
 
 bool _is_status(SOUL_STATUS status);
 void _set_status(SOUL_STATUS status);
 void _reset_status(SOUL_STATUS status);
 
+static uint32_t _errors_mask(unsigned word);
+static void _push_event(SOUL_STATUS status, bool value);
+
 
 unsigned get_last_error()
 {
@@ -31,8 +55,8 @@ void set_last_error(SOUL_STATUS error)
 
 bool has_errors()
 {
-	for (unsigned i = ERRORS_START + 1; i < ERRORS_END; i++) {
-		if (is_error((SOUL_STATUS)(i))) {
+	for (unsigned i = 0; i < SOUL_WORDS_COUNT; i++) {
+		if (soul.statuses[i] & _errors_mask(i)) {
 			return true;
 		}
 	}
@@ -56,9 +80,10 @@ void set_error(SOUL_STATUS error)
 
 unsigned get_first_error()
 {
-	for (unsigned i = ERRORS_START + 1; i < ERRORS_END; i++) {
-		if (is_error((SOUL_STATUS)(i))) {
-			return i;
+	for (unsigned i = 0; i < SOUL_WORDS_COUNT; i++) {
+		uint32_t errors = soul.statuses[i] & _errors_mask(i);
+		if (errors) {
+			return i * SOUL_WORD_BITS + __CLZ(__RBIT(errors)) + 1;
 		}
 	}
 	return 0;
@@ -95,22 +120,35 @@ void reset_status(SOUL_STATUS status)
 
 bool _is_status(SOUL_STATUS status)
 {
-	uint8_t status_num = (uint8_t)(status) - 1;
+	unsigned status_num = (unsigned)(status) - 1;
 	return (bool)(
 		(
-			soul.statuses[status_num / BITS_IN_BYTE] >>
-			(status_num % BITS_IN_BYTE)
+			soul.statuses[status_num / SOUL_WORD_BITS] >>
+			(status_num % SOUL_WORD_BITS)
 		) & 0x01
 	);
 }
 
+/*
+ * The bit and its event are changed in one IRQs masked section:
+ * the events of a status are queued in the order of its changes
+ */
 void _set_status(SOUL_STATUS status)
 {
 	if (status == 0) {
 		return;
 	}
-	uint8_t status_num = (uint8_t)(status) - 1;
-	soul.statuses[status_num / BITS_IN_BYTE] |= (0x01 << (status_num % BITS_IN_BYTE));
+	unsigned status_num = (unsigned)(status) - 1;
+	uint32_t bit = (uint32_t)0x01 << (status_num % SOUL_WORD_BITS);
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	volatile uint32_t* word = &soul.statuses[status_num / SOUL_WORD_BITS];
+	if (!(*word & bit)) {
+		*word |= bit;
+		_push_event(status, true);
+	}
+	__set_PRIMASK(primask);
 }
 
 void _reset_status(SOUL_STATUS status)
@@ -118,6 +156,108 @@ void _reset_status(SOUL_STATUS status)
 	if (status == 0) {
 		return;
 	}
-	uint8_t status_num = (uint8_t)(status) - 1;
-	soul.statuses[status_num / BITS_IN_BYTE] &= (uint8_t)~(0x01 << (status_num % BITS_IN_BYTE));
+	unsigned status_num = (unsigned)(status) - 1;
+	uint32_t bit = (uint32_t)0x01 << (status_num % SOUL_WORD_BITS);
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	volatile uint32_t* word = &soul.statuses[status_num / SOUL_WORD_BITS];
+	if (*word & bit) {
+		*word &= ~bit;
+		_push_event(status, false);
+	}
+	__set_PRIMASK(primask);
+}
+
+void soul_mask_add(soul_mask_t* mask, SOUL_STATUS status)
+{
+	if (!mask || status == 0 || status >= SOUL_STATUSES_END) {
+		return;
+	}
+	unsigned status_num = (unsigned)(status) - 1;
+	mask->words[status_num / SOUL_WORD_BITS] |= (uint32_t)0x01 << (status_num % SOUL_WORD_BITS);
+}
+
+void soul_mask_add_errors(soul_mask_t* mask)
+{
+	if (!mask) {
+		return;
+	}
+	for (unsigned i = 0; i < SOUL_WORDS_COUNT; i++) {
+		mask->words[i] |= _errors_mask(i);
+	}
+}
+
+bool soul_subscribe(const soul_mask_t* mask, soul_subscriber_f subscriber)
+{
+	if (!mask || !subscriber || soul_subscriptions_count >= SOUL_SUBSCRIBERS_MAX) {
+		return false;
+	}
+	soul_subscriptions[soul_subscriptions_count].mask       = *mask;
+	soul_subscriptions[soul_subscriptions_count].subscriber = subscriber;
+	soul_subscriptions_count++;
+	return true;
+}
+
+void soul_dispatch()
+{
+	while (soul_queue.tail != soul_queue.head) {
+		soul_event_t event = soul_queue.events[soul_queue.tail];
+		soul_queue.tail = (soul_queue.tail + 1) % SOUL_EVENTS_SIZE;
+
+#if SOUL_BEDUG
+		printTagLog(SOUL_TAG, "[%lu ms] status %u -> %u", event.time, event.status, event.value);
+#endif
+
+		unsigned status_num = (unsigned)(event.status) - 1;
+		uint32_t bit = (uint32_t)0x01 << (status_num % SOUL_WORD_BITS);
+		for (unsigned i = 0; i < soul_subscriptions_count; i++) {
+			if (soul_subscriptions[i].mask.words[status_num / SOUL_WORD_BITS] & bit) {
+				soul_subscriptions[i].subscriber(&event);
+			}
+		}
+	}
+
+	static unsigned last_lost = 0;
+	if (last_lost != soul_queue.lost) {
+		last_lost = soul_queue.lost;
+		printTagLog(SOUL_TAG, "status events lost: %u", last_lost);
+	}
+}
+
+unsigned soul_lost_events()
+{
+	return soul_queue.lost;
+}
+
+/* Producers are the main loop and ISRs: called with IRQs masked by _set_status/_reset_status */
+void _push_event(SOUL_STATUS status, bool value)
+{
+	unsigned next = (soul_queue.head + 1) % SOUL_EVENTS_SIZE;
+	if (next == soul_queue.tail) {
+		soul_queue.lost++;
+	} else {
+		soul_queue.events[soul_queue.head].time   = HAL_GetTick();
+		soul_queue.events[soul_queue.head].status = (uint8_t)status;
+		soul_queue.events[soul_queue.head].value  = value;
+		soul_queue.head = next;
+	}
+}
+
+/* Mask of the error bits [ERRORS_START + 1, ERRORS_END - 1] inside the word */
+uint32_t _errors_mask(unsigned word)
+{
+	const unsigned first = ERRORS_START;
+	const unsigned last  = ERRORS_END - 2;
+	const unsigned start = word * SOUL_WORD_BITS;
+	const unsigned end   = start + SOUL_WORD_BITS - 1;
+	if (last < start || end < first) {
+		return 0;
+	}
+	unsigned from = (first > start ? first : start) - start;
+	unsigned to   = (last < end ? last : end) - start;
+	uint32_t mask = (to - from + 1 == SOUL_WORD_BITS) ?
+		0xFFFFFFFF :
+		(((uint32_t)0x01 << (to - from + 1)) - 1);
+	return mask << from;
 }
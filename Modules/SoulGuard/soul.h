@@ -80,12 +80,36 @@ typedef enum _SOUK_STATUS {
 } SOUL_STATUS;
 
 
+#define SOUL_BEDUG           (false)
+
+#define SOUL_WORD_BITS       (32)
+#define SOUL_WORDS_COUNT     (__div_up(SOUL_STATUSES_END - 1, SOUL_WORD_BITS))
+
+#define SOUL_EVENTS_SIZE     (16)
+#define SOUL_SUBSCRIBERS_MAX (8)
+
+
 typedef struct _soul_t {
 	unsigned last_err;
-	uint8_t statuses[__div_up(SOUL_STATUSES_END - 1, BITS_IN_BYTE)];
+	/* Updated with IRQs masked only: the statuses are changed from ISRs */
+	volatile uint32_t statuses[SOUL_WORDS_COUNT];
 } soul_t;
 
 
+/* Status change: the bit really changed its value */
+typedef struct _soul_event_t {
+	uint32_t time;
+	uint8_t  status;
+	bool     value;
+} soul_event_t;
+
+typedef struct _soul_mask_t {
+	uint32_t words[SOUL_WORDS_COUNT];
+} soul_mask_t;
+
+typedef void (*soul_subscriber_f)(const soul_event_t* event);
+
+
 unsigned get_last_error();
 void set_last_error(SOUL_STATUS error);
 
@@ -100,6 +124,16 @@ bool is_status(SOUL_STATUS status);
 void set_status(SOUL_STATUS status);
 void reset_status(SOUL_STATUS status);
 
+void soul_mask_add(soul_mask_t* mask, SOUL_STATUS status);
+void soul_mask_add_errors(soul_mask_t* mask);
+bool soul_subscribe(const soul_mask_t* mask, soul_subscriber_f subscriber);
+/*
+ * Delivers the queued status changes to the subscribers
+ * Must be called from the main loop, not from an ISR
+ */
+void soul_dispatch();
+unsigned soul_lost_events();
+
 
 #ifdef __cplusplus
 }
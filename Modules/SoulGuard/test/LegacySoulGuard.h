@@ -0,0 +1,61 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * SoulGuard before the tuple dispatch table (map/variant storage),
+ * kept for the dispatch benchmark and the size comparison
+ */
+
+#pragma once
+
+
+#include <variant>
+#include <unordered_map>
+
+#include "TypeListBuilder.h"
+
+
+template<class... Watchdogs>
+struct LegacySoulGuard
+{
+private:
+	using watchdog_v = std::variant<Watchdogs...>;
+
+	using watchdogs_pack = utl::simple_list_t<Watchdogs...>;
+
+	std::unordered_map<unsigned, watchdog_v> watchdogs;
+	unsigned index;
+
+	template<class... WList>
+	void set_watchdogs(utl::simple_list_t<WList...>)
+	{
+		(set_watchdog(utl::getType<WList>{}), ...);
+	}
+
+	template<class Watchdog>
+	void set_watchdog(utl::getType<Watchdog>)
+	{
+		watchdogs.insert({index++, Watchdog{}});
+	}
+
+public:
+	LegacySoulGuard()
+	{
+		index = 0;
+		set_watchdogs(watchdogs_pack{});
+	}
+
+	void defend()
+	{
+		auto it = watchdogs.find(index++);
+		if (it == watchdogs.end()) {
+			index = 0;
+			return;
+		}
+
+		auto lambda = [] (auto& watchdog) {
+			watchdog.check();
+		};
+
+		std::visit(lambda, it->second);
+	}
+};
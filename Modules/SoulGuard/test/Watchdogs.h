@@ -0,0 +1,31 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Host watchdogs of the SoulGuard tests: the checks only count the runs
+ */
+
+#pragma once
+
+
+#include <cstdint>
+
+
+template<unsigned N, uint32_t PERIOD, uint32_t LATENCY>
+struct TestWatchdog
+{
+	static constexpr uint32_t PERIOD_MS  = PERIOD;
+	static constexpr uint32_t LATENCY_MS = LATENCY;
+
+	static inline volatile uint32_t runs = 0;
+
+	void check() { runs = runs + 1; }
+};
+
+// Checked by the period while flag is set, by the latency otherwise
+template<uint32_t PERIOD, uint32_t LATENCY>
+struct TestEventWatchdog: TestWatchdog<100, PERIOD, LATENCY>
+{
+	static inline bool flag = false;
+
+	bool ready() const { return flag; }
+};
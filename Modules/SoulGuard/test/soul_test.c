@@ -0,0 +1,239 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Soul statuses in the 32-bit words: the checks of the status and error API,
+ * of the status change events and the cycles of the error scans against the byte array of bits they replaced
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "soul.h"
+#include "test.h"
+#include "gtime.h"
+#include "cmsis_gcc.h"
+#include "bench.h"
+
+
+#define BENCH_CALLS (1000000)
+
+
+/* The byte array scans before the 32-bit words */
+static uint8_t legacy_statuses[__div_up(SOUL_STATUSES_END - 1, 8)] = { 0 };
+
+static bool legacy_is_status(unsigned status)
+{
+	uint8_t status_num = (uint8_t)(status) - 1;
+	return (legacy_statuses[status_num / 8] >> (status_num % 8)) & 0x01;
+}
+
+static void legacy_set_status(unsigned status)
+{
+	uint8_t status_num = (uint8_t)(status) - 1;
+	legacy_statuses[status_num / 8] |= (uint8_t)(0x01 << (status_num % 8));
+}
+
+static void legacy_reset_status(unsigned status)
+{
+	uint8_t status_num = (uint8_t)(status) - 1;
+	legacy_statuses[status_num / 8] &= (uint8_t)~(0x01 << (status_num % 8));
+}
+
+static bool legacy_has_errors(void)
+{
+	for (unsigned i = ERRORS_START + 1; i < ERRORS_END; i++) {
+		if (legacy_is_status(i)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static unsigned legacy_get_first_error(void)
+{
+	for (unsigned i = ERRORS_START + 1; i < ERRORS_END; i++) {
+		if (legacy_is_status(i)) {
+			return i;
+		}
+	}
+	return 0;
+}
+
+
+static void test_statuses(void)
+{
+	for (unsigned i = STATUSES_START + 1; i < STATUSES_END; i++) {
+		TEST_CHECK(!is_status((SOUL_STATUS)i));
+		set_status((SOUL_STATUS)i);
+		TEST_CHECK(is_status((SOUL_STATUS)i));
+		TEST_CHECK(!has_errors());
+		reset_status((SOUL_STATUS)i);
+		TEST_CHECK(!is_status((SOUL_STATUS)i));
+	}
+
+	// The errors are not statuses and the statuses are not errors
+	set_status(MCU_ERROR);
+	TEST_CHECK(!is_error(MCU_ERROR));
+	set_error(LOADING);
+	TEST_CHECK(!is_status(LOADING));
+	TEST_CHECK(!has_errors());
+
+	// The statuses of the neighbour bits stay
+	set_status(NEED_SERVICE_UPDATE);
+	set_status(NEED_SERVICE_SAVE);
+	reset_status(NEED_SERVICE_SAVE);
+	TEST_CHECK(is_status(NEED_SERVICE_UPDATE));
+	reset_status(NEED_SERVICE_UPDATE);
+}
+
+static void test_errors(void)
+{
+	TEST_CHECK(get_first_error() == 0);
+
+	for (unsigned i = ERRORS_START + 1; i < ERRORS_END; i++) {
+		set_error((SOUL_STATUS)i);
+		TEST_CHECK(is_error((SOUL_STATUS)i));
+		TEST_CHECK(has_errors());
+		TEST_CHECK(get_first_error() == i);
+		reset_error((SOUL_STATUS)i);
+		TEST_CHECK(!has_errors());
+	}
+
+	// The first error is the lowest one whatever the order of set
+	set_error(INTERNAL_ERROR);
+	set_error(STACK_ERROR);
+	set_error(HARD_FAULT);
+	TEST_CHECK(get_first_error() == STACK_ERROR);
+	reset_error(STACK_ERROR);
+	TEST_CHECK(get_first_error() == HARD_FAULT);
+	reset_error(HARD_FAULT);
+	reset_error(INTERNAL_ERROR);
+	TEST_CHECK(get_first_error() == 0);
+
+	set_last_error(LOADING);
+	TEST_CHECK(get_last_error() == 0);
+	set_last_error(VALVE_ERROR);
+	TEST_CHECK(get_last_error() == VALVE_ERROR);
+}
+
+static soul_event_t events[SOUL_EVENTS_SIZE * 2];
+static unsigned events_count = 0;
+
+static void subscriber(const soul_event_t* event)
+{
+	if (events_count < __arr_len(events)) {
+		events[events_count++] = *event;
+	}
+}
+
+static void test_events(void)
+{
+	// The changes of the previous tests have no subscribers
+	soul_dispatch();
+
+	soul_mask_t mask = { 0 };
+	soul_mask_add(&mask, LOADING);
+	soul_mask_add_errors(&mask);
+	TEST_CHECK(soul_subscribe(&mask, subscriber));
+	TEST_CHECK(!soul_subscribe(&mask, NULL));
+
+	// Only the real changes of the subscribed statuses are delivered in order
+	test_millis = 100;
+	set_status(LOADING);
+	set_status(LOADING);
+	set_status(WORKING);
+	set_error(POWER_ERROR);
+	reset_status(LOADING);
+	reset_status(LOADING);
+	TEST_CHECK(test_primask == 0);
+	TEST_CHECK(events_count == 0);
+
+	soul_dispatch();
+	TEST_CHECK(events_count == 3);
+	TEST_CHECK(events[0].status == LOADING && events[0].value && events[0].time == 100);
+	TEST_CHECK(events[1].status == POWER_ERROR && events[1].value);
+	TEST_CHECK(events[2].status == LOADING && !events[2].value);
+
+	reset_error(POWER_ERROR);
+	reset_status(WORKING);
+	events_count = 0;
+	soul_dispatch();
+	TEST_CHECK(events_count == 1);
+
+	// The full queue counts the lost changes
+	unsigned lost = soul_lost_events();
+	events_count = 0;
+	for (unsigned i = 0; i < SOUL_EVENTS_SIZE; i++) {
+		set_status(LOADING);
+		reset_status(LOADING);
+	}
+	TEST_CHECK(soul_lost_events() - lost == SOUL_EVENTS_SIZE + 1);
+	soul_dispatch();
+	TEST_CHECK(events_count == SOUL_EVENTS_SIZE - 1);
+	TEST_CHECK(!is_status(LOADING));
+}
+
+static void bench_errors(const char* name, SOUL_STATUS error)
+{
+	char title[64];
+	volatile unsigned sink = 0;
+
+	if (error) {
+		set_error(error);
+		legacy_set_status(error);
+	}
+
+	uint64_t start = bench_cycles();
+	for (unsigned i = 0; i < BENCH_CALLS; i++) {
+		sink += has_errors();
+	}
+	uint64_t words = bench_cycles() - start;
+
+	start = bench_cycles();
+	for (unsigned i = 0; i < BENCH_CALLS; i++) {
+		sink += legacy_has_errors();
+	}
+	uint64_t bytes = bench_cycles() - start;
+
+	snprintf(title, sizeof(title), "has_errors() %s words", name);
+	BENCH_RESULT(title, words, BENCH_CALLS);
+	snprintf(title, sizeof(title), "has_errors() %s bytes", name);
+	BENCH_RESULT(title, bytes, BENCH_CALLS);
+
+	start = bench_cycles();
+	for (unsigned i = 0; i < BENCH_CALLS; i++) {
+		sink += get_first_error();
+	}
+	words = bench_cycles() - start;
+
+	start = bench_cycles();
+	for (unsigned i = 0; i < BENCH_CALLS; i++) {
+		sink += legacy_get_first_error();
+	}
+	bytes = bench_cycles() - start;
+
+	snprintf(title, sizeof(title), "get_first_error() %s words", name);
+	BENCH_RESULT(title, words, BENCH_CALLS);
+	snprintf(title, sizeof(title), "get_first_error() %s bytes", name);
+	BENCH_RESULT(title, bytes, BENCH_CALLS);
+
+	TEST_CHECK(get_first_error() == legacy_get_first_error());
+
+	if (error) {
+		reset_error(error);
+		legacy_reset_status(error);
+	}
+	(void)sink;
+}
+
+int main(void)
+{
+	test_statuses();
+	test_errors();
+	test_events();
+
+	bench_errors("none", (SOUL_STATUS)0);
+	bench_errors("last", INTERNAL_ERROR);
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,135 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * SoulGuard dispatch: the tuple table runs every watchdog and the deadline
+ * follows the periods and the ready() watchdogs,
+ * the benchmark compares one defend() with the map/variant storage it replaced
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "test.h"
+#include "bench.h"
+#include "gtime.h"
+#include "SoulGuard.h"
+#include "LegacySoulGuard.h"
+
+
+static size_t heapBytes = 0;
+
+void* operator new(size_t size)
+{
+	heapBytes += size;
+	void* ptr = malloc(size);
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+
+
+// Always ready watchdogs with the same latency: the table runs them in turn like the map did
+using W0 = TestWatchdog<0, 0, 1000>;
+using W1 = TestWatchdog<1, 0, 1000>;
+using W2 = TestWatchdog<2, 0, 1000>;
+using W3 = TestWatchdog<3, 0, 1000>;
+using W4 = TestWatchdog<4, 0, 1000>;
+
+static constexpr unsigned CALLS = 1000000;
+
+
+template<class Guard>
+static uint64_t bench(Guard& guard)
+{
+	uint64_t start = bench_cycles();
+	for (unsigned i = 0; i < CALLS; i++) {
+		test_millis++;
+		guard.defend();
+	}
+	return bench_cycles() - start;
+}
+
+static uint32_t runs()
+{
+	return W0::runs + W1::runs + W2::runs + W3::runs + W4::runs;
+}
+
+static void test_deadline()
+{
+	using Event = TestEventWatchdog<0, 1000>;
+	SoulGuard<TestWatchdog<10, 100, 1000>, Event> guard;
+
+	test_millis = 5000;
+	TEST_CHECK(guard.deadline() == 5000);
+	guard.defend();
+	guard.defend();
+
+	// The not ready watchdog waits for its latency, the periodic one for its period
+	TEST_CHECK(guard.deadline() == 5100);
+	test_millis = 5100;
+	guard.defend();
+	guard.defend();
+	TEST_CHECK(guard.statistics<Event>().runs == 1);
+	TEST_CHECK(guard.deadline() == 5200);
+	test_millis = 5900;
+	TEST_CHECK(guard.deadline() == 5900);
+	test_millis = 5950;
+	guard.defend();
+	guard.defend();
+	TEST_CHECK(guard.deadline() == 6000);
+
+	// A ready watchdog with the zero period is due at once
+	test_millis = 5960;
+	Event::flag = true;
+	TEST_CHECK(guard.deadline() == 5960);
+	guard.defend();
+	TEST_CHECK(guard.statistics<Event>().runs == 2);
+	Event::flag = false;
+	TEST_CHECK(guard.deadline() == 6050);
+}
+
+int main()
+{
+	test_deadline();
+
+	heapBytes = 0;
+	auto* tuple = new SoulGuard<W0, W1, W2, W3, W4>();
+	size_t tupleHeap = heapBytes;
+
+	heapBytes = 0;
+	auto* legacy = new LegacySoulGuard<W0, W1, W2, W3, W4>();
+	size_t legacyHeap = heapBytes;
+
+	printf("storage: tuple %zu bytes, map/variant %zu bytes (%zu on the heap)\n",
+	       tupleHeap, sizeof(*legacy), legacyHeap);
+
+	uint32_t before = runs();
+	uint64_t tupleCycles = bench(*tuple);
+	uint32_t tupleRuns = runs() - before;
+	bool tupleTurns = tuple->statistics<W0>().runs == CALLS / 5 && tuple->statistics<W4>().runs == CALLS / 5;
+
+	before = runs();
+	uint64_t legacyCycles = bench(*legacy);
+	uint32_t legacyRuns = runs() - before;
+
+	BENCH_RESULT("tuple defend()", tupleCycles, CALLS);
+	BENCH_RESULT("map/variant defend()", legacyCycles, CALLS);
+	BENCH_RESULT("tuple per check", tupleCycles, tupleRuns);
+	BENCH_RESULT("map/variant per check", legacyCycles, legacyRuns);
+
+	printf("checks: tuple %u, map/variant %u of %u calls\n", tupleRuns, legacyRuns, CALLS);
+
+	// Every defend() of the table runs a watchdog, the map round spends a call on the end of the map
+	if (tupleRuns != CALLS || !tupleTurns) {
+		return EXIT_FAILURE;
+	}
+
+	delete tuple;
+	delete legacy;
+	return TEST_RESULT();
+}
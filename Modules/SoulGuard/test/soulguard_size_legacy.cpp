@@ -0,0 +1,17 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#include "LegacySoulGuard.h"
+#include "Watchdogs.h"
+
+
+void soulguard_size_defend()
+{
+	static LegacySoulGuard<
+		TestWatchdog<0, 10, 50>,
+		TestWatchdog<1, 100, 1000>,
+		TestWatchdog<2, 100, 1000>,
+		TestWatchdog<3, 1000, 5000>,
+		TestWatchdog<4, 0, 1000>
+	> guard;
+	guard.defend();
+}
@@ -16,6 +16,9 @@
 bool StorageDriver::hasError = false;
 utl::Timer StorageDriver::timer(ERROR_TIMEOUT_MS);
 
+uint32_t StorageDriver::readErrors = 0;
+uint32_t StorageDriver::writeErrors = 0;
+
 #if STORAGE_DRIVER_USE_BUFFER
 
 bool StorageDriver::hasBuffer = false;
@@ -71,6 +74,9 @@ StorageStatus StorageDriver::read(uint32_t address, uint8_t *data, uint32_t len)
 		printTagLog(TAG, "Read %lu address error=%u", address, status);
     }
 #endif
+    if (status != EEPROM_OK && status != EEPROM_ERROR_BUSY) {
+        readErrors++;
+    }
     if (status == EEPROM_ERROR_BUSY) {
         return STORAGE_BUSY;
     }
@@ -137,6 +143,9 @@ StorageStatus StorageDriver::write(uint32_t address, uint8_t *data, uint32_t len
 		printTagLog(TAG, "Write %lu address error=%u", address, status);
     }
 #endif
+    if (status != EEPROM_OK && status != EEPROM_ERROR_BUSY) {
+        writeErrors++;
+    }
     if (status == EEPROM_ERROR_BUSY) {
         return STORAGE_BUSY;
     }
@@ -155,3 +164,13 @@ StorageStatus StorageDriver::write(uint32_t address, uint8_t *data, uint32_t len
 	reset_status(MEMORY_WRITE_FAULT);
     return STORAGE_OK;
 }
+
+uint32_t StorageDriver::readErrorsCount()
+{
+	return readErrors;
+}
+
+uint32_t StorageDriver::writeErrorsCount()
+{
+	return writeErrors;
+}
@@ -21,6 +21,9 @@ private:
 	static bool hasError;
 	static utl::Timer timer;
 
+	static uint32_t readErrors;
+	static uint32_t writeErrors;
+
 #if STORAGE_DRIVER_USE_BUFFER
     static bool     hasBuffer;
     static uint8_t  bufferPage[STORAGE_PAGE_SIZE];
@@ -30,4 +33,8 @@ private:
 public:
     StorageStatus read(uint32_t address, uint8_t *data, uint32_t len) override;
     StorageStatus write(uint32_t address, uint8_t *data, uint32_t len) override;
+
+    // EEPROM failed operations since the start (the busy EEPROM is not an error)
+    static uint32_t readErrorsCount();
+    static uint32_t writeErrorsCount();
 };
@@ -0,0 +1,167 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#include "MenuTable.h"
+
+#include "main.h"
+#include "soul.h"
+#include "sensor.h"
+#include "system.h"
+#include "bmacro.h"
+#include "gutils.h"
+#include "settings.h"
+#include "hal_defs.h"
+#include "translate.h"
+
+#include "Watchdogs.h"
+#include "StorageDriver.h"
+
+
+constexpr menu_descriptor_t SERVICE_MENU[] = {
+	{T_Version,       MENU_VALUE_VERSION,       nullptr,                 0,       0,                         0, 0},
+	{T_Language,      MENU_VALUE_LANGUAGE,      &settings.language,      ENGLISH, RUSSIAN,                   1, MENU_FLAG_WRAP | MENU_FLAG_UPDATE_ALL},
+	{T_SURFACE_MODE,  MENU_VALUE_NONE,          nullptr,                 0,       0,                         0, 0},
+	{T_Sensitivity,   MENU_VALUE_SENSITIVITY,   &settings.surface_snstv, 0,       SETTINGS_BANDS_COUNT - 1,  1, 0},
+	{T_Delay,         MENU_VALUE_SECONDS,       &settings.surface_delay, 0,       SETTINGS_WORK_DELAY_MAX_S, 1, 0},
+	{T_STRING_MODE,   MENU_VALUE_NONE,          nullptr,                 0,       0,                         0, 0},
+	{T_Sensitivity,   MENU_VALUE_SENSITIVITY,   &settings.string_snstv,  0,       SETTINGS_BANDS_COUNT - 1,  1, 0},
+	{T_Delay,         MENU_VALUE_SECONDS,       &settings.string_delay,  0,       SETTINGS_WORK_DELAY_MAX_S, 1, 0},
+	{T_BIGSKI_MODE,   MENU_VALUE_NONE,          nullptr,                 0,       0,                         0, 0},
+	{T_Sensitivity,   MENU_VALUE_SENSITIVITY,   &settings.bigski_snstv,  0,       SETTINGS_BANDS_COUNT - 1,  1, 0},
+	{T_Delay,         MENU_VALUE_SECONDS,       &settings.bigski_delay,  0,       SETTINGS_WORK_DELAY_MAX_S, 1, 0},
+	{T_DIAGNOSTICS,   MENU_VALUE_NONE,          nullptr,                 0,       0,                         0, 0},
+	{T_Main_loop,     MENU_VALUE_LOOP_RATE,     nullptr,                 0,       0,                         0, MENU_FLAG_LIVE},
+	{T_UI_tick_max,   MENU_VALUE_UI_TICK_MAX,   nullptr,                 0,       0,                         0, MENU_FLAG_LIVE},
+	{T_CAN_frames,    MENU_VALUE_CAN_FRAMES,    nullptr,                 0,       0,                         0, MENU_FLAG_LIVE},
+	{T_Sample_age,    MENU_VALUE_SAMPLE_AGE,    nullptr,                 0,       0,                         0, MENU_FLAG_LIVE},
+	{T_Free_RAM,      MENU_VALUE_FREE_RAM,      nullptr,                 0,       0,                         0, MENU_FLAG_LIVE},
+	{T_EEPROM_errors, MENU_VALUE_EEPROM_ERRORS, nullptr,                 0,       0,                         0, MENU_FLAG_LIVE},
+	{T_Uptime,        MENU_VALUE_UPTIME,        nullptr,                 0,       0,                         0, MENU_FLAG_LIVE},
+};
+const uint16_t SERVICE_MENU_COUNT = __arr_len(SERVICE_MENU);
+
+
+const char* menu_label(const menu_descriptor_t* descriptor)
+{
+	return t(descriptor->label, settings.language);
+}
+
+void menu_value(const menu_descriptor_t* descriptor, format_t* line)
+{
+	switch (descriptor->format) {
+	case MENU_VALUE_VERSION:
+		format_char(line, 'v');
+		format_uint(line, DEVICE_MAJOR);
+		format_char(line, '.');
+		format_uint(line, DEVICE_MINOR);
+		format_char(line, '.');
+		format_uint(line, DEVICE_PATCH);
+		break;
+	case MENU_VALUE_LANGUAGE:
+		format_str(line, *descriptor->field == ENGLISH ? __STR_DEF2__(ENGLISH) : __STR_DEF2__(RUSSIAN));
+		break;
+	case MENU_VALUE_SENSITIVITY:
+		format_uint(line, SENSITIVITY[__min(*descriptor->field, SETTINGS_BANDS_COUNT - 1)]);
+		break;
+	case MENU_VALUE_SECONDS:
+		format_uint(line, *descriptor->field);
+		format_char(line, ' ');
+		format_str(line, t(T_sec, settings.language));
+		break;
+	case MENU_VALUE_LOOP_RATE:
+		format_uint(line, system_loop_stats()->rate);
+		format_char(line, ' ');
+		format_str(line, t(T_Hz, settings.language));
+		break;
+	case MENU_VALUE_UI_TICK_MAX:
+		format_uint(line, system_loop_stats()->ui_worst_us);
+		format_char(line, ' ');
+		format_str(line, t(T_us, settings.language));
+		break;
+	case MENU_VALUE_CAN_FRAMES:
+		for (unsigned i = 0; i < SENSOR_COUNT; i++) {
+			if (i) {
+				format_char(line, '/');
+			}
+			format_uint(line, get_sensor_frame_rate(i));
+		}
+		format_char(line, ' ');
+		format_str(line, t(T_Hz, settings.language));
+		break;
+	case MENU_VALUE_SAMPLE_AGE:
+	{
+		uint32_t age_ms = get_sensor_sample_age_ms();
+		if (age_ms == UINT32_MAX) {
+			format_char(line, '-');
+			break;
+		}
+		format_uint(line, age_ms);
+		format_char(line, ' ');
+		format_str(line, t(T_ms, settings.language));
+		break;
+	}
+	case MENU_VALUE_FREE_RAM:
+		format_uint(line, StackWatchdog::freeRam());
+		format_char(line, ' ');
+		format_str(line, t(T_bytes, settings.language));
+		break;
+	case MENU_VALUE_EEPROM_ERRORS:
+		format_uint(line, StorageDriver::readErrorsCount());
+		format_char(line, '/');
+		format_uint(line, StorageDriver::writeErrorsCount());
+		break;
+	case MENU_VALUE_UPTIME:
+	{
+		uint32_t seconds = HAL_GetTick() / SECOND_MS;
+		format_uint(line, seconds / 3600);
+		format_char(line, ':');
+		format_uint_digits(line, seconds / 60 % 60, 2);
+		format_char(line, ':');
+		format_uint_digits(line, seconds % 60, 2);
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+void menu_click(const menu_descriptor_t* descriptor, uint16_t button)
+{
+	int delta = 0;
+	switch (button) {
+	case BTN_UP_Pin:
+		delta = descriptor->step;
+		break;
+	case BTN_DOWN_Pin:
+		delta = -descriptor->step;
+		break;
+	case BTN_ENTER_Pin:
+	case BTN_MODE_Pin:
+	case BTN_F1_Pin:
+	case BTN_F2_Pin:
+	case BTN_F3_Pin:
+		return;
+	default:
+		/* The unknown button is ignored */
+#ifdef DEBUG
+		BEDUG_ASSERT(false, "Unknown menu button");
+#endif
+		return;
+	}
+
+	if (!descriptor->field || !delta) {
+		return;
+	}
+
+	int value = (int)*descriptor->field + delta;
+	if (value > descriptor->max) {
+		value = (descriptor->flags & MENU_FLAG_WRAP) ? descriptor->min : descriptor->max;
+	}
+	if (value < descriptor->min) {
+		value = (descriptor->flags & MENU_FLAG_WRAP) ? descriptor->max : descriptor->min;
+	}
+	*descriptor->field = (uint8_t)value;
+
+	if (descriptor->flags & MENU_FLAG_UPDATE_ALL) {
+		set_status(NEED_SERVICE_UPDATE);
+	}
+}
@@ -0,0 +1,64 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#ifndef _MENU_TABLE_H_
+#define _MENU_TABLE_H_
+
+
+#include <cstdint>
+
+#include "format.h"
+#include "translate.h"
+
+
+typedef enum _MENU_VALUE {
+	MENU_VALUE_NONE = 0,
+	MENU_VALUE_VERSION,
+	MENU_VALUE_LANGUAGE,
+	MENU_VALUE_SENSITIVITY,
+	MENU_VALUE_SECONDS,
+	MENU_VALUE_LOOP_RATE,
+	MENU_VALUE_UI_TICK_MAX,
+	MENU_VALUE_CAN_FRAMES,
+	MENU_VALUE_SAMPLE_AGE,
+	MENU_VALUE_FREE_RAM,
+	MENU_VALUE_EEPROM_ERRORS,
+	MENU_VALUE_UPTIME
+} MENU_VALUE;
+
+typedef enum _MENU_FLAG {
+	// The field goes from max to min (and back) instead of stopping at the limits
+	MENU_FLAG_WRAP       = 0x01,
+	// The change needs the whole service screen repaint (language)
+	MENU_FLAG_UPDATE_ALL = 0x02,
+	// Read only diagnostics value: the line is focusable to scroll to it and is repainted in place
+	MENU_FLAG_LIVE       = 0x04,
+} MENU_FLAG;
+
+
+/*
+ * Service menu line: the label, the value format and the settings field
+ * that is changed by the UP/DOWN buttons in the [min, max] range.
+ * The line without the field is not selectable if it is not MENU_FLAG_LIVE.
+ */
+typedef struct _menu_descriptor_t {
+	const char (*label)[TRANSLATE_MAX_LEN];
+	MENU_VALUE format;
+	uint8_t*   field;
+	uint8_t    min;
+	uint8_t    max;
+	uint8_t    step;
+	uint8_t    flags;
+} menu_descriptor_t;
+
+
+extern const menu_descriptor_t SERVICE_MENU[];
+extern const uint16_t SERVICE_MENU_COUNT;
+
+
+const char* menu_label(const menu_descriptor_t* descriptor);
+// Appends the field value text to the line
+void menu_value(const menu_descriptor_t* descriptor, format_t* line);
+void menu_click(const menu_descriptor_t* descriptor, uint16_t button);
+
+
+#endif
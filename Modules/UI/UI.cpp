@@ -2,23 +2,23 @@
 
 #include "UI.h"
 
-#include <cstdio>
 #include <cstring>
 
-#include "bmp.h"
 #include "glog.h"
 #include "soul.h"
+#include "gtime.h"
 #include "main.h"
 #include "gutils.h"
 #include "sensor.h"
 #include "bmacro.h"
-#include "gstring.h"
+#include "format.h"
 #include "display.h"
 #include "settings.h"
+#include "trace.h"
 #include "hal_defs.h"
 
 #include "App.h"
-#include "Callbacks.h"
+#include "MenuTable.h"
 #include "CodeStopwatch.h"
 
 
@@ -34,96 +34,139 @@
 
 
 utl::circle_buffer<UI::UI_CLICKS_SIZE, uint16_t> UI::clicks;
-std::unordered_map<uint16_t, Button> UI::buttons = {
-	{BTN_F1_Pin,    {BTN_F1_GPIO_Port,    BTN_F1_Pin,    true}},
-	{BTN_DOWN_Pin,  {BTN_DOWN_GPIO_Port,  BTN_DOWN_Pin,  true}},
-	{BTN_UP_Pin,    {BTN_UP_GPIO_Port,    BTN_UP_Pin,    true}},
-	{BTN_ENTER_Pin, {BTN_ENTER_GPIO_Port, BTN_ENTER_Pin, true}},
-	{BTN_MODE_Pin,  {BTN_MODE_GPIO_Port,  BTN_MODE_Pin,  true}},
-	{BTN_F2_Pin,    {BTN_F2_GPIO_Port,    BTN_F2_Pin,    true}},
-	{BTN_F3_Pin,    {BTN_F3_GPIO_Port,    BTN_F3_Pin,    true}}
-};
+// All the buttons are on the BTN_F1_GPIO_Port
+ButtonPort UI::buttons(
+	BTN_F1_GPIO_Port,
+	BTN_F1_Pin | BTN_DOWN_Pin | BTN_UP_Pin | BTN_ENTER_Pin | BTN_MODE_Pin | BTN_F2_Pin | BTN_F3_Pin,
+	true
+);
 utl::Timer UI::timer(SECOND_MS);
 fsm::FiniteStateMachine<UI::fsm_table> UI::fsm;
-MenuItem menuItems[] =
-{
-	{(new version_callback()),          false},
-	{(new language_callback()),         true},
-	{(new surface_label_callback()),    false},
-	{(new surface_snstv_callback()),    true},
-	{(new surface_delay_callback()),    true},
-	{(new string_label_callback()),     false},
-	{(new string_snstv_callback()),     true},
-	{(new string_delay_callback()),     true},
-	{(new bigski_label_callback()),     false},
-	{(new bigski_snstv_callback()),     true},
-	{(new bigski_delay_callback()),     true},
-};
-std::unique_ptr<Menu> UI::serviceMenu = std::make_unique<Menu>(
+Menu UI::serviceMenu(
 	0,
 	DISPLAY_HEADER_HEIGHT,
 	display_width(),
 	DISPLAY_CONTENT_HEIGHT,
-	menuItems,
-	__arr_len(menuItems)
+	SERVICE_MENU,
+	SERVICE_MENU_COUNT
 );
 SENSOR_MODE UI::manual_f1_mode = SENSOR_MODE_SURFACE;
 SENSOR_MODE UI::manual_f3_mode = SENSOR_MODE_STRING;
 
-uint16_t UI::f1_color = DISPLAY_COLOR_WHITE;
-uint16_t UI::f2_color = DISPLAY_COLOR_WHITE;
-uint16_t UI::f3_color = DISPLAY_COLOR_WHITE;
+UI::footer_button_t UI::footerButtons[3] = {
+	{DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLACK, nullptr, false},
+	{DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLACK, nullptr, false},
+	{DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLACK, nullptr, false},
+};
+
+TextField UI::sensorsField(
+	DISPLAY_WIDTH / 2,
+	(uint16_t)(DISPLAY_HEADER_HEIGHT + u8g2_font_8x13_t_cyrillic.Height),
+	&u8g2_font_8x13_t_cyrillic
+);
+TextField UI::targetField(
+	(uint16_t)(DISPLAY_WIDTH - 2 * DEFAULT_MARGIN - SegmentNumber::width(TARGET_DIGIT_WIDTH, TARGET_THICKNESS)),
+	(uint16_t)(DISPLAY_HEIGHT / 2 - DEFAULT_MARGIN - u8g2_font_8x13_t_cyrillic.Height / 2 - TARGET_DIGIT_HEIGHT / 2),
+	&u8g2_font_8x13_t_cyrillic,
+	DISPLAY_ALIGN_RIGHT
+);
+TextField UI::valueField(
+	(uint16_t)(DISPLAY_WIDTH - 2 * DEFAULT_MARGIN - SegmentNumber::width(VALUE_DIGIT_WIDTH, VALUE_THICKNESS)),
+	(uint16_t)(DISPLAY_HEIGHT / 2 + VALUE_DIGIT_HEIGHT / 2 - u8g2_font_8x13_t_cyrillic.Height / 2),
+	&u8g2_font_8x13_t_cyrillic,
+	DISPLAY_ALIGN_RIGHT
+);
+SegmentNumber UI::targetNumber(
+	DISPLAY_WIDTH - DEFAULT_MARGIN,
+	(uint16_t)(DISPLAY_HEIGHT / 2 - DEFAULT_MARGIN - TARGET_DIGIT_HEIGHT),
+	TARGET_DIGIT_WIDTH,
+	TARGET_DIGIT_HEIGHT,
+	TARGET_THICKNESS,
+	DISPLAY_ALIGN_RIGHT
+);
+SegmentNumber UI::valueNumber(
+	DISPLAY_WIDTH - DEFAULT_MARGIN,
+	DISPLAY_HEIGHT / 2,
+	VALUE_DIGIT_WIDTH,
+	VALUE_DIGIT_HEIGHT,
+	VALUE_THICKNESS,
+	DISPLAY_ALIGN_RIGHT
+);
+TrendGraph UI::trend(TREND_Y, TREND_HEIGHT, 60 * SECOND_MS / TREND_HEIGHT);
+bool UI::displayTuned = false;
+bool UI::displayWaking = false;
+utl::Timer UI::refreshTimer(REFRESH_PERIOD_MS);
+utl::Timer UI::refreshConfigTimer(REFRESH_CONFIG_PERIOD_MS);
+utl::Timer UI::liveTimer(LIVE_PERIOD_MS);
+unsigned UI::refreshRegion = 0;
 
 const char (*UI::loadStr)[TRANSLATE_MAX_LEN] = T_LOADING;
+const char (*UI::titleStr)[TRANSLATE_MAX_LEN] = nullptr;
 
 
 void UI::tick()
 {
 	utl::CodeStopwatch watch("UI2", 300);
+
+	button_event_t event = {};
+	while (buttons.popEvent(event)) {
+#if UI_BEDUG
+		printTagLog(TAG, "button 0x%04X event %u at %lu ms", event.pin, event.type, event.time);
+#endif
+		if (event.type == BUTTON_RELEASE) {
+			clicks.push_back(event.pin);
+		}
+	}
+
 	fsm.proccess();
+
+	if (!display_busy()) {
+		trace_point(TRACE_PIXEL);
+	}
 }
 
 
+uint32_t UI::deadline()
+{
+	uint32_t now = getMillis();
+	if (!clicks.empty() || buttons.hasEvents()) {
+		return now;
+	}
+	if (displayWaking) {
+		return now + DISPLAY_WAKE_MS;
+	}
+	return now + IDLE_PERIOD_MS;
+}
+
 void UI::buttonsTick()
 {
 	utl::CodeStopwatch watch("UI1", 100);
 
-	for (auto& button : buttons) {
-		button.second.tick();
-		if (button.second.oneClick()) {
-			clicks.push_back(button.first);
-		}
+	bool valvePressed = buttons.pressed(BTN_UP_Pin) || buttons.pressed(BTN_DOWN_Pin);
+	buttons.tick();
+	if (!valvePressed && (buttons.pressed(BTN_UP_Pin) || buttons.pressed(BTN_DOWN_Pin))) {
+		trace_start(buttons.lastSampleCycles());
 	}
 }
 
-void UI::showMode()
+void UI::showMode(const bool icon)
 {
-	sFONT* bitmap = NULL;
+	const display_icon_t* mode_icon = nullptr;
 	char sensors[PHRASE_LEN_MAX] = "";
-	util_add_char(
-		sensors,
-		sizeof(sensors),
-		' ',
-		display_width() / u8g2_font_8x13_t_cyrillic.Width,
-		ALIGN_MODE_CENTER
-	);
+	format_t format = {};
+	format_init(&format, sensors, sizeof(sensors));
 	switch (get_sensor_target_mode()) {
 	case SENSOR_MODE_SURFACE:
-		bitmap = &surface_bitmap;
+		mode_icon = &surface_icon;
 		break;
 	case SENSOR_MODE_STRING:
-		bitmap = &string_bitmap;
+		mode_icon = &string_icon;
 		break;
 	case SENSOR_MODE_BIGSKI:
-		bitmap = &bigski_bitmap;
-		snprintf(
-			sensors,
-			sizeof(sensors) - 1,
-			"%c%c%c",
-			sensor2AB_available() ? '1' : '-',
-			sensor2A7_available() ? '2' : '-',
-			sensor2A8_available() ? '3' : '-'
-		);
+		mode_icon = &bigski_icon;
+		format_char(&format, sensor2AB_available() ? '1' : '-');
+		format_char(&format, sensor2A7_available() ? '2' : '-');
+		format_char(&format, sensor2A8_available() ? '3' : '-');
 		break;
 	default:
 #ifdef DEBUG
@@ -134,28 +177,19 @@ void UI::showMode()
 		Error_Handler();
 		return;
 	};
+	format_align(&format, display_width() / u8g2_font_8x13_t_cyrillic.Width, FORMAT_ALIGN_CENTER);
 
-	display_set_color(DISPLAY_COLOR_BLACK);
-	display_text_show(
-		display_width() / 2,
-		(uint16_t)(DISPLAY_HEADER_HEIGHT + u8g2_font_8x13_t_cyrillic.Height),
-		&u8g2_font_8x13_t_cyrillic,
-		DISPLAY_ALIGN_CENTER,
-		sensors,
-		strlen(sensors),
-		DEFAULT_SCALE
-	);
+	sensorsField.show(sensors);
 
-	char line[] = " ";
-	display_set_color(DISPLAY_COLOR_BLACK);
-	display_text_show(
+	if (!icon) {
+		return;
+	}
+	display_draw_icon(
 		display_width() / 2,
-		(uint16_t)(DISPLAY_HEADER_HEIGHT + bitmap->Height),
-		bitmap,
+		(uint16_t)(DISPLAY_HEADER_HEIGHT + mode_icon->height),
 		DISPLAY_ALIGN_CENTER,
-		line,
-		strlen(line),
-		DEFAULT_SCALE
+		mode_icon,
+		nullptr
 	);
 }
 
@@ -166,13 +200,17 @@ void UI::showServiceHeader()
 	uint16_t offset_x = display_width() / 2;
 	uint16_t offset_y = DISPLAY_HEADER_HEIGHT / 2;
 
+	format_t format = {};
+	format_init(&format, line, sizeof(line));
 	if (get_last_error() || is_status(RCC_FAULT)) {
 		font = &u8g2_font_8x13_t_cyrillic;
-		snprintf(line, sizeof(line), "%s", t(T_RESET_ERROR, settings.language));
+		format_str(&format, t(T_RESET_ERROR, settings.language));
 	} else {
-		snprintf(line, sizeof(line), "%s %s", t(T_SERVICE, settings.language), t(T_MODE, settings.language));
+		format_str(&format, t(T_SERVICE, settings.language));
+		format_char(&format, ' ');
+		format_str(&format, t(T_MODE, settings.language));
 	}
-	util_add_char(line, sizeof(line), ' ', display_width() / font->Width, ALIGN_MODE_CENTER);
+	format_align(&format, display_width() / font->Width, FORMAT_ALIGN_CENTER);
 
 	display_set_color(DISPLAY_COLOR_BLACK);
 	display_text_show(
@@ -190,8 +228,9 @@ void UI::showServiceHeader()
 	}
 
 	offset_y += font->Height;
-	snprintf(line, sizeof(line), "%s", get_string_error((SOUL_STATUS)get_last_error(), settings.language));
-	util_add_char(line, sizeof(line), ' ', display_width() / font->Width, ALIGN_MODE_CENTER);
+	format_init(&format, line, sizeof(line));
+	format_str(&format, get_string_error((SOUL_STATUS)get_last_error(), settings.language));
+	format_align(&format, display_width() / font->Width, FORMAT_ALIGN_CENTER);
 
 	display_set_color(DISPLAY_COLOR_RED);
 	display_text_show(
@@ -205,284 +244,313 @@ void UI::showServiceHeader()
 	);
 }
 
-void UI::showAutoFooter()
+void UI::showTitle()
 {
-	uint16_t halfSection = display_width() / 3 / 2;
+	if (!titleStr) {
+		return;
+	}
 
-	uint16_t x = 0;
-	uint16_t y = DISPLAY_HEADER_HEIGHT + DISPLAY_CONTENT_HEIGHT + 1;
-	uint16_t w = display_width() / 3;
-	uint16_t h = display_height() - y;
-	uint16_t curr_color = buttons[BTN_F1_Pin].pressed() ? DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE;
-	SENSOR_MODE mode = get_sensor_target_mode();
-	char line[] = " ";
+	char mode[PHRASE_LEN_MAX] = {};
+	format_t format = {};
+	format_init(&format, mode, sizeof(mode));
+	format_str(&format, t(titleStr, settings.language));
+	format_char(&format, ' ');
+	format_str(&format, t(T_MODE, settings.language));
+	format_align(&format, display_width() / u8g2_font_10x20_t_cyrillic.Width, FORMAT_ALIGN_CENTER);
 
-	if (mode == SENSOR_MODE_SURFACE) {
-		curr_color = DISPLAY_COLOR_LIGHT_GRAY;
-	}
-	if (f1_color != curr_color) {
-		display_fill_rect(x, y, w, h, curr_color);
-		f1_color = curr_color;
-	}
-	display_set_background(curr_color);
-	display_set_color(buttons[BTN_F1_Pin].pressed() ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK);
+	display_set_color(DISPLAY_COLOR_BLACK);
 	display_text_show(
-		x + halfSection,
-		y + (DISPLAY_FOOTER_HEIGHT / 2),
-		&surface_bitmap,
+		display_width() / 2,
+		DISPLAY_HEADER_HEIGHT / 2,
+		&u8g2_font_10x20_t_cyrillic,
 		DISPLAY_ALIGN_CENTER,
-		line,
-		strlen(line),
+		mode,
+		strlen(mode),
 		DEFAULT_SCALE
 	);
+}
 
-
-	w -= 1;
-	x += static_cast<uint16_t>(display_width() / 3 + 1);
-	curr_color = buttons[BTN_F2_Pin].pressed() ? DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE;
-	if (mode == SENSOR_MODE_STRING) {
-		curr_color = DISPLAY_COLOR_LIGHT_GRAY;
-	}
-	if (f2_color != curr_color) {
-		display_fill_rect(x, y, w, h, curr_color);
-		f2_color = curr_color;
-	}
-	display_set_background(curr_color);
-	display_set_color(buttons[BTN_F2_Pin].pressed() ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK);
-	display_text_show(
-		x + halfSection,
-		y + (DISPLAY_FOOTER_HEIGHT / 2),
-		&string_bitmap,
-		DISPLAY_ALIGN_CENTER,
-		line,
-		strlen(line),
-		DEFAULT_SCALE
+void UI::showAutoFooter()
+{
+	SENSOR_MODE mode = get_sensor_target_mode();
+	uint16_t background = buttons.pressed(BTN_F1_Pin) || mode == SENSOR_MODE_SURFACE ?
+		DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE;
+	showFooterButton(
+		0,
+		&surface_icon,
+		background,
+		buttons.pressed(BTN_F1_Pin) ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK
 	);
 
+	background = buttons.pressed(BTN_F2_Pin) || mode == SENSOR_MODE_STRING ?
+		DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE;
+	showFooterButton(
+		1,
+		&string_icon,
+		background,
+		buttons.pressed(BTN_F2_Pin) ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK
+	);
 
-	x += static_cast<uint16_t>(display_width() / 3);
-	curr_color = buttons[BTN_F3_Pin].pressed() ? DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE;
-	if (mode == SENSOR_MODE_BIGSKI) {
-		curr_color = DISPLAY_COLOR_LIGHT_GRAY;
-	}
-	if (f3_color != curr_color) {
-		display_fill_rect(x, y, w, h, curr_color);
-		f3_color = curr_color;
-	}
-	display_set_background(curr_color);
-	display_set_color(buttons[BTN_F3_Pin].pressed() ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK);
-	display_text_show(
-		x + halfSection,
-		y + (DISPLAY_FOOTER_HEIGHT / 2),
-		&bigski_bitmap,
-		DISPLAY_ALIGN_CENTER,
-		line,
-		strlen(line),
-		DEFAULT_SCALE
+	background = buttons.pressed(BTN_F3_Pin) || mode == SENSOR_MODE_BIGSKI ?
+		DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE;
+	showFooterButton(
+		2,
+		&bigski_icon,
+		background,
+		buttons.pressed(BTN_F3_Pin) ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK
 	);
 }
 
 void UI::showManualFooter()
 {
-	uint16_t x = static_cast<uint16_t>(display_width() / 3 + 1);
-	uint16_t y = DISPLAY_HEADER_HEIGHT + DISPLAY_CONTENT_HEIGHT + 1;
-	uint16_t w = display_width() / 3 - 1;
-	uint16_t h = display_height() - y;
-	uint16_t halfSection = display_width() / 3 / 2;
-	uint16_t curr_color = DISPLAY_COLOR_WHITE;
-
-	curr_color = buttons[BTN_F2_Pin].pressed() ? DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE;
-	if (f2_color != curr_color) {
-		display_fill_rect(x, y, w, h, curr_color);
-		f2_color = curr_color;
-	}
-	char linef2[] = " ";
-	display_set_background(curr_color);
-	display_set_color(buttons[BTN_F2_Pin].pressed() ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK);
-	display_text_show(
-		x + halfSection,
-		y + (DISPLAY_FOOTER_HEIGHT / 2),
-		&settings_bitmap,
-		DISPLAY_ALIGN_CENTER,
-		linef2,
-		strlen(linef2),
-		DEFAULT_SCALE
+	showFooterButton(
+		1,
+		&settings_icon,
+		buttons.pressed(BTN_F2_Pin) ? DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE,
+		buttons.pressed(BTN_F2_Pin) ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK
 	);
 
-	x = 0;
-	w = display_width() / 3;
 	manual_f1_mode = SENSOR_MODE_SURFACE;
-	sFONT* bitmap = &surface_bitmap;
+	const display_icon_t* icon = &surface_icon;
 	if (manual_f1_mode == get_sensor_mode() && !(get_sensor_target_mode() == SENSOR_MODE_BIGSKI)) {
 		manual_f1_mode = SENSOR_MODE_STRING;
-		bitmap = &string_bitmap;
+		icon = &string_icon;
 	}
-	curr_color = buttons[BTN_F1_Pin].pressed() ? DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE;
-	if (f1_color != curr_color) {
-		display_fill_rect(x, y, w, h, curr_color);
-		f1_color = curr_color;
-	}
-	char linef1[] = " ";
-	display_set_background(curr_color);
-	display_set_color(buttons[BTN_F1_Pin].pressed() ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK);
-	display_text_show(
-		x + halfSection,
-		y + (DISPLAY_FOOTER_HEIGHT / 2),
-		bitmap,
-		DISPLAY_ALIGN_CENTER,
-		linef1,
-		strlen(linef1),
-		DEFAULT_SCALE
+	showFooterButton(
+		0,
+		icon,
+		buttons.pressed(BTN_F1_Pin) ? DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE,
+		buttons.pressed(BTN_F1_Pin) ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK
 	);
 
-	w -= 1;
-	x = static_cast<uint16_t>(display_width() / 3 * 2 + 1);
 	manual_f3_mode = SENSOR_MODE_STRING;
-	bitmap = &string_bitmap;
+	icon = &string_icon;
 	if (manual_f1_mode == manual_f3_mode || manual_f3_mode == get_sensor_mode()) {
 		manual_f3_mode = SENSOR_MODE_BIGSKI;
-		bitmap = &bigski_bitmap;
-	}
-	curr_color = buttons[BTN_F3_Pin].pressed() ? DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE;
-	if (f3_color != curr_color) {
-		display_fill_rect(x, y, w, h, curr_color);
-		f3_color = curr_color;
+		icon = &bigski_icon;
 	}
-	char linef3[] = " ";
-	display_set_background(curr_color);
-	display_set_color(buttons[BTN_F3_Pin].pressed() ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK);
-	display_text_show(
-		x + halfSection,
-		y + (DISPLAY_FOOTER_HEIGHT / 2),
-		bitmap,
-		DISPLAY_ALIGN_CENTER,
-		linef3,
-		strlen(linef3),
-		DEFAULT_SCALE
+	showFooterButton(
+		2,
+		icon,
+		buttons.pressed(BTN_F3_Pin) ? DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE,
+		buttons.pressed(BTN_F3_Pin) ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK
 	);
 }
 
 void UI::showServiceFooter()
 {
-	uint16_t halfSection = display_width() / 3 / 2;
+	showFooterButton(
+		0,
+		&back_icon,
+		buttons.pressed(BTN_F1_Pin) ? DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE,
+		buttons.pressed(BTN_F1_Pin) ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK
+	);
 
-	uint16_t x = 0;
-	uint16_t y = DISPLAY_HEADER_HEIGHT + DISPLAY_CONTENT_HEIGHT + 1;
-	uint16_t w = display_width() / 3;
-	uint16_t h = display_height() - y;
-	uint16_t curr_color = buttons[BTN_F1_Pin].pressed() ? DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE;
-	if (f1_color != curr_color) {
-		display_fill_rect(x, y, w, h, curr_color);
-		f1_color = curr_color;
-	}
-	char linef1[] = " ";
-	display_set_background(curr_color);
-	display_set_color(buttons[BTN_F1_Pin].pressed() ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK);
-	display_text_show(
-		x + halfSection,
-		y + (DISPLAY_FOOTER_HEIGHT / 2),
-		&back_bitmap,
-		DISPLAY_ALIGN_CENTER,
-		linef1,
-		strlen(linef1),
-		DEFAULT_SCALE
+	showFooterButton(1, nullptr, DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLACK);
+
+	showFooterButton(
+		2,
+		&save_icon,
+		buttons.pressed(BTN_F3_Pin) ? DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE,
+		buttons.pressed(BTN_F3_Pin) ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK
 	);
+}
 
-	w -= 1;
-	x += static_cast<uint16_t>(display_width() / 3 + 1);
-	display_fill_rect(x, y, w, h, DISPLAY_COLOR_WHITE);
+void UI::showFooterButton(const unsigned index, const display_icon_t* icon, const uint16_t background, const uint16_t color)
+{
+	footer_button_t& button = footerButtons[index];
+	if (!button.needUpdate && button.background == background && button.color == color && button.icon == icon) {
+		return;
+	}
+	button = {background, color, icon, false};
 
-	x += static_cast<uint16_t>(display_width() / 3);
-	curr_color = buttons[BTN_F3_Pin].pressed() ? DISPLAY_COLOR_LIGHT_GRAY : DISPLAY_COLOR_WHITE;
-	if (f3_color != curr_color) {
-		display_fill_rect(x, y, w, h, curr_color);
-		f3_color = curr_color;
+	uint16_t halfSection = display_width() / 3 / 2;
+
+	uint16_t x = index ? static_cast<uint16_t>(display_width() / 3 * index + 1) : 0;
+	uint16_t y = DISPLAY_HEADER_HEIGHT + DISPLAY_CONTENT_HEIGHT + 1;
+	uint16_t w = index ? static_cast<uint16_t>(display_width() / 3 - 1) : static_cast<uint16_t>(display_width() / 3);
+	uint16_t h = display_height() - y;
+	uint16_t palette[] = {background, color};
+
+	display_compose_begin(x, y, w, h);
+	display_compose_fill(x, y, w, h, background);
+	if (icon) {
+		display_compose_icon(
+			x + halfSection,
+			y + (DISPLAY_FOOTER_HEIGHT / 2),
+			DISPLAY_ALIGN_CENTER,
+			icon,
+			palette
+		);
 	}
-	char linef3[] = " ";
-	display_set_background(curr_color);
-	display_set_color(buttons[BTN_F3_Pin].pressed() ? DISPLAY_COLOR_GRAY : DISPLAY_COLOR_BLACK);
-	display_text_show(
-		x + halfSection,
-		y + (DISPLAY_FOOTER_HEIGHT / 2),
-		&save_bitmap,
-		DISPLAY_ALIGN_CENTER,
-		linef3,
-		strlen(linef3),
-		DEFAULT_SCALE
+	display_compose_end();
+
+#if UI_BEDUG
+	printTagLog(
+		TAG,
+		"footer pixels: painted=%lu sent=%lu",
+		display_compose_stats()->painted,
+		display_compose_stats()->sent
 	);
+#endif
 }
 
 void UI::showValue()
 {
-	uint16_t offset_x = display_width() / 2;
-	uint16_t offset_y = static_cast<uint16_t>(display_height() / (uint16_t)2 - u8g2_font_8x13_t_cyrillic.Height - DEFAULT_MARGIN);
-
 	{
 		char target[PHRASE_LEN_MAX] = {};
-		const char* phrase = t(T_TARGET, settings.language);
-		snprintf(
-			target,
-			sizeof(target) - 1,
-			"%s: %d.%d",
-			phrase,
-			get_sensor_mode_target(get_sensor_mode()) / 100,
-			__abs(get_sensor_mode_target(get_sensor_mode()) % 100) / 10
-		);
-		util_add_char(target, sizeof(target), ' ', (size_t)DISPLAY_WIDTH / u8g2_font_8x13_t_cyrillic.Width, ALIGN_MODE_CENTER);
+		format_t format = {};
+		format_init(&format, target, sizeof(target));
+		format_str(&format, t(T_TARGET, settings.language));
+		format_char(&format, ':');
 
-		display_set_color(DISPLAY_COLOR_BLACK);
-		display_text_show(
-			offset_x,
-			offset_y,
-			&u8g2_font_8x13_t_cyrillic,
-			DISPLAY_ALIGN_CENTER,
-			target,
-			strlen(target),
-			DEFAULT_SCALE
-		);
+		targetField.show(target);
+		targetNumber.show(get_sensor_mode_target(get_sensor_mode()) / 10);
 	}
 
 	{
-		offset_y = display_height() / 2 + DEFAULT_MARGIN;
 		char value[PHRASE_LEN_MAX] = {};
-		uint32_t scale = 2;
+		format_t format = {};
+		format_init(&format, value, sizeof(value));
 		if (App::getRealValue() == App::SENSOR_VALUE_ERR) {
-			snprintf(
-				value,
-				sizeof(value) - 1,
-				"%s",
-				t(T_ERROR, settings.language)
-			);
+			format_str(&format, t(T_ERROR, settings.language));
+			valueNumber.showError();
 		} else {
-			snprintf(
-				value,
-				sizeof(value) - 1,
-				"%s: %d.%d",
-				t(T_VALUE, settings.language),
-				App::getRealValue() / 100,
-				__abs(App::getRealValue() % 100) / 10
-			);
+			format_str(&format, t(T_VALUE, settings.language));
+			valueNumber.show(App::getRealValue() / 10);
 		}
-		util_add_char(value, sizeof(value), ' ', (size_t)DISPLAY_WIDTH / (u8g2_font_8x13_t_cyrillic.Width * scale), ALIGN_MODE_CENTER);
+		format_char(&format, ':');
 
-		display_set_color(DISPLAY_COLOR_BLACK);
-		display_text_show(
-			offset_x,
-			offset_y,
-			&u8g2_font_8x13_t_cyrillic,
-			DISPLAY_ALIGN_CENTER,
-			value,
-			strlen(value),
-			scale
-		);
+		valueField.show(value);
+	}
+}
+
+void UI::showTrend()
+{
+	trend.setBands(App::getDeadBand(), App::getPropBand());
+	if (App::getRealValue() == App::SENSOR_VALUE_ERR) {
+		trend.updateValves(is_status(AUTO_NEED_VALVE_UP), is_status(AUTO_NEED_VALVE_DOWN));
+	} else {
+		trend.update(App::getRealValue(), is_status(AUTO_NEED_VALVE_UP), is_status(AUTO_NEED_VALVE_DOWN));
 	}
+	trend.show();
+}
+
+void UI::tuneDisplay()
+{
+	display_spi_t spi = {
+		settings.display_spi_write,
+		settings.display_spi_read,
+		0
+	};
+
+	bool tuned = display_spi_apply(&spi) || display_spi_calibrate(&spi);
+	if (tuned &&
+		(settings.display_spi_write != spi.write_divider ||
+		settings.display_spi_read != spi.read_divider)
+	) {
+		settings.display_spi_write = spi.write_divider;
+		settings.display_spi_read  = spi.read_divider;
+		set_status(NEED_SAVE_SETTINGS);
+	}
+
+	printTagLog(
+		TAG,
+		"display SPI dividers: write=%u read=%u, bandwidth=%lu B/s",
+		spi.write_divider,
+		spi.read_divider,
+		spi.bandwidth
+	);
+
+	displayTuned = true;
+}
+
+/*
+ * The UI draws only the changes, so the display damaged by noise is not repainted.
+ * Every REFRESH_PERIOD_MS one region is marked to be repainted by the state show
+ * (the trend rows are repainted by the graph scrolling) and REFRESH_PROBES display
+ * pixels are read back, a wrong pixel sends the panel configuration at once.
+ */
+void UI::refreshDisplay(const bool menu)
+{
+	if (displayWaking) {
+		displayWaking = display_refresh_config();
+	}
+	if (refreshTimer.wait()) {
+		return;
+	}
+	refreshTimer.start();
+
+	bool damaged = !display_refresh_check(REFRESH_PROBES);
+	if (damaged || !refreshConfigTimer.wait()) {
+		displayWaking = display_refresh_config();
+		refreshConfigTimer.start();
+	}
+	if (damaged) {
+		printTagLog(TAG, "display damage has been found, configuration has been sent");
+	}
+
+	switch (refreshRegion) {
+	case REFRESH_SECTIONS:
+		display_sections_show();
+		break;
+	case REFRESH_TITLE:
+		showTitle();
+		break;
+	case REFRESH_FOOTER_F1:
+	case REFRESH_FOOTER_F2:
+	case REFRESH_FOOTER_F3:
+		footerButtons[refreshRegion - REFRESH_FOOTER_F1].needUpdate = true;
+		break;
+	case REFRESH_SENSORS:
+		sensorsField.setNeedUpdate(true);
+		break;
+	case REFRESH_TARGET:
+		targetField.setNeedUpdate(true);
+		targetNumber.setNeedUpdate(true);
+		break;
+	case REFRESH_VALUE_FIELD:
+		valueField.setNeedUpdate(true);
+		break;
+	case REFRESH_VALUE_NUMBER:
+		valueNumber.setNeedUpdate(true);
+		break;
+	case REFRESH_MENU:
+		if (menu) {
+			serviceMenu.refreshNext();
+		}
+		break;
+	default:
+		break;
+	}
+
+	refreshRegion = (refreshRegion + 1) % REFRESH_REGIONS_COUNT;
+}
+
+void UI::resetFooter()
+{
+	for (auto& button : footerButtons) {
+		button = {DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLACK, nullptr, true};
+	}
+}
+
+void UI::resetFields()
+{
+	sensorsField.setNeedUpdate(true);
+	targetField.setNeedUpdate(true);
+	valueField.setNeedUpdate(true);
+	targetNumber.setNeedUpdate(true);
+	valueNumber.setNeedUpdate(true);
+	trend.reset();
 }
 
 void UI::showLoading()
 {
 	char line[PHRASE_LEN_MAX] = {};
-	snprintf(line, sizeof(line) - 1, "%s", t(loadStr, settings.language));
-	util_add_char(line, sizeof(line), ' ', display_width() / u8g2_font_10x20_t_cyrillic.Width, ALIGN_MODE_CENTER);
+	format_t format = {};
+	format_init(&format, line, sizeof(line));
+	format_str(&format, t(loadStr, settings.language));
+	format_align(&format, display_width() / u8g2_font_10x20_t_cyrillic.Width, FORMAT_ALIGN_CENTER);
 
 	display_set_color(DISPLAY_COLOR_BLACK);
 	display_text_show(
@@ -510,14 +578,14 @@ void UI::showDirection(bool flag)
 		DISPLAY_HEADER_HEIGHT +
 		DISPLAY_CONTENT_HEIGHT -
 		DEFAULT_MARGIN -
-		left_bitmap.Height
+		left_icon.height
 	);
-	display_fill_rect(0, y, display_width(), left_bitmap.Height, DISPLAY_COLOR_WHITE);
+	display_fill_rect(0, y, display_width(), left_icon.height, DISPLAY_COLOR_WHITE);
 
 
 	sFONT* font = &u8g2_font_10x20_t_cyrillic;
 	char direction_line[TRANSLATE_MAX_LEN] = "";
-	sFONT* bitmap = nullptr;
+	const display_icon_t* icon = nullptr;
 	uint16_t color = DISPLAY_COLOR_WHITE;
 	switch (direction) {
 	case STR_FORCE_LEFT:
@@ -526,7 +594,7 @@ void UI::showDirection(bool flag)
 			t(T_LEFT, settings.language),
 			__min(strlen(t(T_LEFT, settings.language)), sizeof(direction_line))
 		);
-		bitmap = &left_bitmap;
+		icon = &left_icon;
 		color = DISPLAY_COLOR_RED;
 		break;
 	case STR_LEFT:
@@ -535,7 +603,7 @@ void UI::showDirection(bool flag)
 			t(T_LEFT, settings.language),
 			__min(strlen(t(T_LEFT, settings.language)), sizeof(direction_line))
 		);
-		bitmap = &left_bitmap;
+		icon = &left_icon;
 		color = DISPLAY_COLOR_BLACK;
 		break;
 	case STR_FORCE_RIGHT:
@@ -544,7 +612,7 @@ void UI::showDirection(bool flag)
 			t(T_RIGHT, settings.language),
 			__min(strlen(t(T_RIGHT, settings.language)), sizeof(direction_line))
 		);
-		bitmap = &right_bitmap;
+		icon = &right_icon;
 		color = DISPLAY_COLOR_RED;
 		break;
 	case STR_RIGHT:
@@ -553,11 +621,11 @@ void UI::showDirection(bool flag)
 			t(T_RIGHT, settings.language),
 			__min(strlen(t(T_RIGHT, settings.language)), sizeof(direction_line))
 		);
-		bitmap = &right_bitmap;
+		icon = &right_icon;
 		color = DISPLAY_COLOR_BLACK;
 		break;
 	case STR_MIDDLE:
-		bitmap = &left_bitmap;
+		icon = &left_icon;
 		break;
 	default:
 #ifdef DEBUG
@@ -574,33 +642,24 @@ void UI::showDirection(bool flag)
 	}
 
 	uint16_t text_len = (uint16_t)(strlen(direction_line) * font->Width);
-	uint16_t full_len = text_len + bitmap->Width;
+	uint16_t full_len = text_len + icon->width;
 
 	uint16_t x = 0;
 	if (direction == STR_FORCE_LEFT || direction == STR_LEFT) {
 		x = display_width() / 2 - full_len / 2;
 	} else {
-		x = (uint16_t)(display_width() / 2 + full_len / 2 - bitmap->Width);
+		x = (uint16_t)(display_width() / 2 + full_len / 2 - icon->width);
 	}
-	char bitmap_line[] = " ";
-	display_set_color(color);
-	display_text_show(
-		x,
-		y,
-		bitmap,
-		DISPLAY_ALIGN_LEFT,
-		bitmap_line,
-		strlen(bitmap_line),
-		DEFAULT_SCALE
-	);
+	uint16_t palette[] = {DISPLAY_COLOR_WHITE, color};
+	display_draw_icon(x, y, DISPLAY_ALIGN_LEFT, icon, palette);
 
 
 	if (direction == STR_FORCE_LEFT || direction == STR_LEFT) {
-		x += bitmap->Width;
+		x += icon->width;
 	} else {
 		x -= text_len;
 	}
-	y += (uint16_t)(bitmap->Height / 2 - font->Height / 2);
+	y += (uint16_t)(icon->height / 2 - font->Height / 2);
 	display_set_color(color);
 	display_text_show(
 		x,
@@ -613,43 +672,40 @@ void UI::showDirection(bool flag)
 	);
 }
 
-void UI::showUp(bool flag)
+void UI::showUp(bool flag, bool arrow)
 {
-	extern const BITMAPSTRUCT bmp_up_15x15;
-
 	uint16_t x = DEFAULT_MARGIN;
 	uint16_t y = static_cast<uint16_t>(
 		DISPLAY_HEADER_HEIGHT +
-		bmp_up_15x15.infoHeader.biHeight +
+		up_icon.height +
 		u8g2_font_8x13_t_cyrillic.Height
 	);
 
-	if (flag) {
-		display_draw_bitmap(x, y, &bmp_up_15x15);
-	} else {
-		display_clear_rect(x, y, static_cast<uint16_t>(bmp_up_15x15.infoHeader.biWidth), static_cast<uint16_t>(bmp_up_15x15.infoHeader.biHeight));
+	if (arrow && flag) {
+		display_draw_icon(x, y, DISPLAY_ALIGN_LEFT, &up_icon, nullptr);
+		trace_point(TRACE_ARROW);
+	} else if (arrow) {
+		display_clear_rect(x, y, up_icon.width, up_icon.height);
 	}
 	HAL_GPIO_WritePin(LED_UP_GPIO_Port, LED_UP_Pin, static_cast<GPIO_PinState>(flag));
 }
 
-void UI::showDown(bool flag)
+void UI::showDown(bool flag, bool arrow)
 {
-	extern const BITMAPSTRUCT bmp_up_15x15;
-	extern const BITMAPSTRUCT bmp_down_15x15;
-
 	uint16_t x = DEFAULT_MARGIN;
 	uint16_t y = static_cast<uint16_t>(
 		DISPLAY_HEADER_HEIGHT +
 		u8g2_font_8x13_t_cyrillic.Height +
-		bmp_up_15x15.infoHeader.biHeight +
+		up_icon.height +
 		DEFAULT_MARGIN +
-		bmp_down_15x15.infoHeader.biHeight
+		down_icon.height
 	);
 
-	if (flag) {
-		display_draw_bitmap(x, y, &bmp_down_15x15);
-	} else {
-		display_clear_rect(x, y, static_cast<uint16_t>(bmp_down_15x15.infoHeader.biWidth), static_cast<uint16_t>(bmp_down_15x15.infoHeader.biHeight));
+	if (arrow && flag) {
+		display_draw_icon(x, y, DISPLAY_ALIGN_LEFT, &down_icon, nullptr);
+		trace_point(TRACE_ARROW);
+	} else if (arrow) {
+		display_clear_rect(x, y, down_icon.width, down_icon.height);
 	}
 	HAL_GPIO_WritePin(LED_DOWN_GPIO_Port, LED_DOWN_Pin, static_cast<GPIO_PinState>(flag));
 }
@@ -670,9 +726,10 @@ void UI::showMiddle(bool flag)
 void UI::_init_s::operator ()() const
 {
 	char line[PHRASE_LEN_MAX] = "bObA";
-	const char* phrase = t(T_LOADING, settings.language);
-	snprintf(line, sizeof(line) - 1, "%s", phrase);
-	util_add_char(line, sizeof(line), ' ', display_width() / u8g2_font_10x20_t_cyrillic.Width, ALIGN_MODE_CENTER);
+	format_t format = {};
+	format_init(&format, line, sizeof(line));
+	format_str(&format, t(T_LOADING, settings.language));
+	format_align(&format, display_width() / u8g2_font_10x20_t_cyrillic.Width, FORMAT_ALIGN_CENTER);
 
     display_init();
 	display_clear();
@@ -693,7 +750,12 @@ void UI::_init_s::operator ()() const
 
 void UI::_load_s::operator ()() const
 {
-	if (!is_status(LOADING) &&
+	if (!displayTuned && is_status(SETTINGS_INITIALIZED)) {
+		tuneDisplay();
+	}
+
+	if (displayTuned &&
+		!is_status(LOADING) &&
 		is_status(WORKING) &&
 		!is_status(NEED_LOAD_SETTINGS) &&
 		!is_status(NEED_SAVE_SETTINGS)
@@ -716,18 +778,19 @@ void UI::_load_s::operator ()() const
 
 void UI::_no_sens_s::operator ()() const
 {
+	refreshDisplay();
 	showMode();
 	showManualFooter();
 
 	char line[PHRASE_LEN_MAX] = {};
-	const char* phrase = t(T_NO_SENSOR, settings.language);
-	snprintf(line, sizeof(line) - 1, "%s", phrase);
+	format_t format = {};
+	format_init(&format, line, sizeof(line));
+	format_str(&format, t(T_NO_SENSOR, settings.language));
 	uint32_t scale = 3;
 	if (settings.language == RUSSIAN) {
 		scale = 2;
 	}
-	size_t width = display_width() / (u8g2_font_8x13_t_cyrillic.Width * scale);
-	util_add_char(line, sizeof(line), ' ', width, ALIGN_MODE_CENTER);
+	format_align(&format, display_width() / (u8g2_font_8x13_t_cyrillic.Width * scale), FORMAT_ALIGN_CENTER);
 
 	display_set_color(DISPLAY_COLOR_BLACK);
 	display_text_show(
@@ -783,6 +846,7 @@ void UI::_no_sens_s::operator ()() const
 
 void UI::_manual_mode_s::operator ()() const
 {
+	refreshDisplay();
 	showMode();
 	showManualFooter();
 	showValue();
@@ -798,11 +862,14 @@ void UI::_manual_mode_s::operator ()() const
 		fsm.push_event(error_e{});
 	}
 
-	buttons[BTN_UP_Pin].pressed() ? set_status(MANUAL_NEED_VALVE_UP) : reset_status(MANUAL_NEED_VALVE_UP);
-	buttons[BTN_DOWN_Pin].pressed() ? set_status(MANUAL_NEED_VALVE_DOWN) : reset_status(MANUAL_NEED_VALVE_DOWN);
+	buttons.pressed(BTN_UP_Pin) ? set_status(MANUAL_NEED_VALVE_UP) : reset_status(MANUAL_NEED_VALVE_UP);
+	buttons.pressed(BTN_DOWN_Pin) ? set_status(MANUAL_NEED_VALVE_DOWN) : reset_status(MANUAL_NEED_VALVE_DOWN);
+	if (is_status(MANUAL_NEED_VALVE_UP) || is_status(MANUAL_NEED_VALVE_DOWN)) {
+		trace_point(TRACE_UI_STATUS);
+	}
 
 	static bool target_reseted = false;
-	if (buttons[BTN_ENTER_Pin].isHolded()) {
+	if (buttons.isHolded(BTN_ENTER_Pin)) {
 		reset_sensor_mode_target();
 		target_reseted = true;
 		set_status(NEED_SAVE_SETTINGS);
@@ -855,11 +922,13 @@ void UI::_manual_mode_s::operator ()() const
 
 void UI::_auto_mode_s::operator ()() const
 {
-	showMode();
+	refreshDisplay();
+	showMode(false);
 	showAutoFooter();
 	showValue();
-	showUp(is_status(AUTO_NEED_VALVE_UP));
-	showDown(is_status(AUTO_NEED_VALVE_DOWN));
+	showTrend();
+	showUp(is_status(AUTO_NEED_VALVE_UP), false);
+	showDown(is_status(AUTO_NEED_VALVE_DOWN), false);
 	showMiddle(__abs(App::getRealValue()) < App::getDeadBand());
 	showDirection(get_sensor_mode() == SENSOR_MODE_STRING);
 
@@ -909,24 +978,19 @@ void UI::_auto_mode_s::operator ()() const
 
 void UI::_service_s::operator ()() const
 {
+	refreshDisplay(true);
 	showServiceHeader();
 	showServiceFooter();
 
-	auto button = buttons.find(BTN_UP_Pin);
-	if (button != buttons.end()) {
-		if (buttons[BTN_UP_Pin].isHolded()) {
-			serviceMenu->holdUp();
-		}
+	if (buttons.isHolded(BTN_UP_Pin)) {
+		serviceMenu.holdUp();
 	}
-	button = buttons.find(BTN_DOWN_Pin);
-	if (button != buttons.end()) {
-		if (buttons[BTN_DOWN_Pin].isHolded()) {
-			serviceMenu->holdDown();
-		}
+	if (buttons.isHolded(BTN_DOWN_Pin)) {
+		serviceMenu.holdDown();
 	}
 
 	if (!clicks.empty()) {
-		serviceMenu->click(clicks.pop_front());
+		serviceMenu.click(clicks.pop_front());
 	}
 
 	if (is_status(NEED_SERVICE_SAVE)) {
@@ -945,10 +1009,15 @@ void UI::_service_s::operator ()() const
 
 	if (is_status(NEED_SERVICE_UPDATE)) {
 		reset_status(NEED_SERVICE_UPDATE);
-		serviceMenu->update();
+		serviceMenu.update();
 	}
 
-	serviceMenu->show();
+	serviceMenu.show();
+
+	if (!liveTimer.wait()) {
+		liveTimer.start();
+		serviceMenu.updateLive();
+	}
 }
 
 
@@ -961,9 +1030,12 @@ void UI::_error_s::operator ()() const
 		uint16_t y = display_height() / 2;
 
 		char line[PHRASE_LEN_MAX] = {};
-		const char* phrase = t(T_ERROR, settings.language);
-		snprintf(line, sizeof(line) - 1, "%s %u", phrase, error);
-		util_add_char(line, sizeof(line), ' ', display_width() / u8g2_font_10x20_t_cyrillic.Width, ALIGN_MODE_CENTER);
+		format_t format = {};
+		format_init(&format, line, sizeof(line));
+		format_str(&format, t(T_ERROR, settings.language));
+		format_char(&format, ' ');
+		format_uint(&format, error);
+		format_align(&format, display_width() / u8g2_font_10x20_t_cyrillic.Width, FORMAT_ALIGN_CENTER);
 		display_set_color(DISPLAY_COLOR_BLACK);
 		display_text_show(
 			x,
@@ -976,8 +1048,9 @@ void UI::_error_s::operator ()() const
 		);
 
 		y += (uint16_t)(u8g2_font_10x20_t_cyrillic.Height + DEFAULT_MARGIN);
-		snprintf(line, sizeof(line) - 1, "%s", get_string_error((SOUL_STATUS)error, settings.language));
-		util_add_char(line, sizeof(line), ' ', display_width() / u8g2_font_8x13_t_cyrillic.Width, ALIGN_MODE_CENTER);
+		format_init(&format, line, sizeof(line));
+		format_str(&format, get_string_error((SOUL_STATUS)error, settings.language));
+		format_align(&format, display_width() / u8g2_font_8x13_t_cyrillic.Width, FORMAT_ALIGN_CENTER);
 		display_set_color(DISPLAY_COLOR_BLACK);
 		display_set_color(DISPLAY_COLOR_BLACK);
 		display_text_show(
@@ -997,6 +1070,7 @@ void UI::_error_s::operator ()() const
 
 void UI::error_a::operator ()() const
 {
+	trend.reset();
 	display_clear();
 
 	showDown(false);
@@ -1009,6 +1083,8 @@ void UI::load_start_a::operator ()() const
 {
 	fsm.clear_events();
 
+	serviceMenu.resetScroll();
+
 	const char* loading1 = t(loadStr, settings.language);
 	const char* loading2 = t(T_LOADING, settings.language);
 	if (memcmp(loading1, loading2, __min(strlen(loading1), strlen(loading2)))) {
@@ -1019,9 +1095,8 @@ void UI::load_start_a::operator ()() const
 
 void UI::no_sens_start_a::operator ()() const
 {
-	f1_color = DISPLAY_COLOR_WHITE;
-	f2_color = DISPLAY_COLOR_WHITE;
-	f3_color = DISPLAY_COLOR_WHITE;
+	resetFields();
+	resetFooter();
 
 	clicks.clear();
 	fsm.clear_events();
@@ -1029,6 +1104,8 @@ void UI::no_sens_start_a::operator ()() const
 	display_clear();
 	display_sections_show();
 
+	titleStr = nullptr;
+
 	showDown(false);
 	showUp(false);
 	showMiddle(false);
@@ -1036,9 +1113,8 @@ void UI::no_sens_start_a::operator ()() const
 
 void UI::manual_start_a::operator ()() const
 {
-	f1_color = DISPLAY_COLOR_WHITE;
-	f2_color = DISPLAY_COLOR_WHITE;
-	f3_color = DISPLAY_COLOR_WHITE;
+	resetFields();
+	resetFooter();
 
 	clicks.clear();
 	fsm.clear_events();
@@ -1048,30 +1124,14 @@ void UI::manual_start_a::operator ()() const
 	display_clear_footer();
 	display_sections_show();
 
-
-	char mode[PHRASE_LEN_MAX] = {};
-	const char* phrase1 = t(T_MANUAL, settings.language);
-	const char* phrase2 = t(T_MODE, settings.language);
-	snprintf(mode, sizeof(mode), "%s %s", phrase1, phrase2);
-	util_add_char(mode, sizeof(mode), ' ', display_width() / u8g2_font_10x20_t_cyrillic.Width, ALIGN_MODE_CENTER);
-
-	display_set_color(DISPLAY_COLOR_BLACK);
-	display_text_show(
-		display_width() / 2,
-		DISPLAY_HEADER_HEIGHT / 2,
-		&u8g2_font_10x20_t_cyrillic,
-		DISPLAY_ALIGN_CENTER,
-		mode,
-		strlen(mode),
-		DEFAULT_SCALE
-	);
+	titleStr = T_MANUAL;
+	showTitle();
 }
 
 void UI::auto_start_a::operator ()() const
 {
-	f1_color = DISPLAY_COLOR_WHITE;
-	f2_color = DISPLAY_COLOR_WHITE;
-	f3_color = DISPLAY_COLOR_WHITE;
+	resetFields();
+	resetFooter();
 
 	clicks.clear();
 	fsm.clear_events();
@@ -1080,29 +1140,13 @@ void UI::auto_start_a::operator ()() const
 	display_clear_footer();
 	display_sections_show();
 
-	char mode[PHRASE_LEN_MAX] = {};
-	const char* phrase1 = t(T_AUTO, settings.language);
-	const char* phrase2 = t(T_MODE, settings.language);
-	snprintf(mode, sizeof(mode), "%s %s", phrase1, phrase2);
-	util_add_char(mode, sizeof(mode), ' ', display_width() / u8g2_font_10x20_t_cyrillic.Width, ALIGN_MODE_CENTER);
-
-	display_set_color(DISPLAY_COLOR_BLACK);
-	display_text_show(
-		display_width() / 2,
-		DISPLAY_HEADER_HEIGHT / 2,
-		&u8g2_font_10x20_t_cyrillic,
-		DISPLAY_ALIGN_CENTER,
-		mode,
-		strlen(mode),
-		DEFAULT_SCALE
-	);
+	titleStr = T_AUTO;
+	showTitle();
 }
 
 void UI::service_start_a::operator ()() const
 {
-	f1_color = DISPLAY_COLOR_WHITE;
-	f2_color = DISPLAY_COLOR_WHITE;
-	f3_color = DISPLAY_COLOR_WHITE;
+	resetFooter();
 
 	display_clear();
 
@@ -1112,5 +1156,7 @@ void UI::service_start_a::operator ()() const
 	display_clear_content();
 	display_sections_show();
 
-	serviceMenu->reset();
+	titleStr = nullptr;
+
+	serviceMenu.reset();
 }
@@ -7,14 +7,16 @@
 #include <memory>
 #include <utility>
 #include <cstdint>
-#include <unordered_map>
 
 #include "sensor.h"
 #include "translate.h"
 
 #include "Menu.h"
 #include "Timer.h"
-#include "Button.h"
+#include "TextField.h"
+#include "ButtonPort.h"
+#include "TrendGraph.h"
+#include "SegmentNumber.h"
 #include "CircleBuffer.h"
 #include "FiniteStateMachine.h"
 
@@ -27,12 +29,48 @@ struct UI
 private:
 	static constexpr unsigned UI_CLICKS_SIZE = 8;
 
-	static constexpr uint32_t DEBOUNCE_MS = 20;
-
 protected:
 	static constexpr uint16_t DEFAULT_MARGIN = 10;
 
+	static constexpr uint16_t TARGET_DIGIT_WIDTH  = 9;
+	static constexpr uint16_t TARGET_DIGIT_HEIGHT = 15;
+	static constexpr uint16_t TARGET_THICKNESS    = 2;
+	static constexpr uint16_t VALUE_DIGIT_WIDTH   = 20;
+	static constexpr uint16_t VALUE_DIGIT_HEIGHT  = 36;
+	static constexpr uint16_t VALUE_THICKNESS     = 4;
+
+	// Deviation trend of the last minute instead of the mode icon and the valve arrows
+	static constexpr uint16_t TREND_Y      = DISPLAY_HEADER_HEIGHT + 24;
+	static constexpr uint16_t TREND_HEIGHT = 52;
+
+	// Display self-healing: one region is repainted and a few display pixels are checked per period
+	static constexpr uint32_t REFRESH_PERIOD_MS        = 300;
+	static constexpr unsigned REFRESH_PROBES           = 2;
+	static constexpr uint32_t REFRESH_CONFIG_PERIOD_MS = 5000;
+
+	// The service menu diagnostics values are repainted in place by the period
+	static constexpr uint32_t LIVE_PERIOD_MS = 500;
+
+	// The UI timers are not shorter than Menu::HOLD_TIMEOUT_MS, the idle UI is ticked by this step
+	static constexpr uint32_t IDLE_PERIOD_MS = 50;
+
+	enum REFRESH_REGION {
+		REFRESH_SECTIONS = 0,
+		REFRESH_TITLE,
+		REFRESH_FOOTER_F1,
+		REFRESH_FOOTER_F2,
+		REFRESH_FOOTER_F3,
+		REFRESH_SENSORS,
+		REFRESH_TARGET,
+		REFRESH_VALUE_FIELD,
+		REFRESH_VALUE_NUMBER,
+		REFRESH_MENU,
+		REFRESH_REGIONS_COUNT
+	};
+
 	static const char (*loadStr)[TRANSLATE_MAX_LEN];
+	// Header mode title (nullptr - the state has no title)
+	static const char (*titleStr)[TRANSLATE_MAX_LEN];
 
 	// Events:
 	FSM_CREATE_EVENT(success_e,     0);
@@ -99,21 +137,54 @@ protected:
 
 	static utl::Timer timer;
 
-	static std::unique_ptr<Menu> serviceMenu;
+	static Menu serviceMenu;
 
 	static SENSOR_MODE manual_f1_mode;
 	static SENSOR_MODE manual_f3_mode;
 
-	static uint16_t f1_color;
-	static uint16_t f2_color;
-	static uint16_t f3_color;
-
-	static void showMode();
+	struct footer_button_t
+	{
+		uint16_t background;
+		uint16_t color;
+		const display_icon_t* icon;
+		bool needUpdate;
+	};
+
+	static footer_button_t footerButtons[3];
+
+	static TextField sensorsField;
+	static TextField targetField;
+	static TextField valueField;
+	static SegmentNumber targetNumber;
+	static SegmentNumber valueNumber;
+	static TrendGraph trend;
+
+	// The display SPI dividers are applied or calibrated after the settings load
+	static bool displayTuned;
+
+	static utl::Timer refreshTimer;
+	static utl::Timer refreshConfigTimer;
+	static unsigned refreshRegion;
+	/* The panel reset by noise waits for the Display On (display_refresh_config) */
+	static bool displayWaking;
+
+	static utl::Timer liveTimer;
+
+	static void tuneDisplay();
+	// Repaints the next region in turn, the menu region is repainted in the service mode only
+	static void refreshDisplay(const bool menu = false);
+	static void resetFields();
+	static void resetFooter();
+
+	static void showMode(const bool icon = true);
 	static void showServiceHeader();
+	static void showTitle();
 	static void showAutoFooter();
 	static void showManualFooter();
 	static void showServiceFooter();
+	static void showFooterButton(const unsigned index, const display_icon_t* icon, const uint16_t background, const uint16_t color);
 	static void showValue();
+	static void showTrend();
 	static void showLoading();
 	static void showDirection(bool flag = true);
 
@@ -121,16 +192,19 @@ public:
 	static constexpr char TAG[] = "UI";
 
 	static utl::circle_buffer<UI_CLICKS_SIZE, uint16_t> clicks;
-	static std::unordered_map<uint16_t, Button> buttons;
+	static ButtonPort buttons;
 
-	static void showUp(bool flag = false);
-	static void showDown(bool flag = false);
+	static void showUp(bool flag = false, bool arrow = true);
+	static void showDown(bool flag = false, bool arrow = true);
 	static void showMiddle(bool flag = false);
 
 	void tick();
 
 	void buttonsTick();
 
+	// The nearest time (ms) when the UI has work: at once for the queued buttons
+	static uint32_t deadline();
+
 };
 
 
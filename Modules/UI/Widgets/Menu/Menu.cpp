@@ -6,8 +6,10 @@
 
 #include <limits>
 
+#include "glog.h"
 #include "main.h"
 #include "soul.h"
+#include "bmacro.h"
 #include "display.h"
 
 
@@ -18,19 +20,35 @@
 								  )
 
 
-Menu::Menu(uint16_t x, uint16_t y, uint16_t w, uint16_t h, MenuItem* items, uint16_t count):
+Menu::Menu(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const menu_descriptor_t* table, uint16_t count):
 	x(x), y(y + 1), w(w), h(h - 1), items(), count(count),
 	start_idx(0), focused_idx(0), last_focused_idx(std::numeric_limits<uint16_t>::max()),
 	real_start_idx(0), selected(false), needInit(true), timer(HOLD_TIMEOUT_MS),
-	needUpdateSelected(false), needUpdateAll(false)
+	needUpdateSelected(false), needUpdateAll(false), slotHeight(0), slots(0),
+	scrollOffset(0), stepPixels(0), refreshIdx(0)
 {
-	this->items = std::make_unique<MenuItem[]>(count);
-	for (uint16_t i = 0; i < count; i++) {
-		this->items[i] = items[i];
-		this->items[i].setWidth(w - SCROLL_WIDTH - 2);
+	BEDUG_ASSERT(count <= ITEMS_MAX, "Menu items count is out of the range");
+	if (this->count > ITEMS_MAX) {
+		this->count = ITEMS_MAX;
 	}
-	for (uint16_t i = 0; i < count; i++) {
-		if (this->items[i].isSelectable()) {
+	for (uint16_t i = 0; i < this->count; i++) {
+		items[i].setDescriptor(&table[i]);
+		items[i].setWidth(w - SCROLL_WIDTH - 2);
+	}
+	if (this->count) {
+		slotHeight = items[0].height();
+	}
+	for (uint16_t i = 0; i < this->count; i++) {
+		if (items[i].height() != slotHeight) {
+			slotHeight = 0;
+			break;
+		}
+	}
+	if (slotHeight) {
+		slots = (uint16_t)((this->h - 1) / slotHeight);
+	}
+	for (uint16_t i = 0; i < this->count; i++) {
+		if (items[i].isSelectable()) {
 			real_start_idx = i;
 			break;
 		}
@@ -47,6 +65,13 @@ void Menu::reset()
 	selected = false;
 }
 
+void Menu::resetScroll()
+{
+	if (scrollOffset) {
+		scrollTo(0);
+	}
+}
+
 void Menu::click(uint16_t button)
 {
 	if (selected && !IS_SPECIAL_BUTTON(button)) {
@@ -57,6 +82,9 @@ void Menu::click(uint16_t button)
 
 	switch (button) {
 	case BTN_ENTER_Pin:
+		if (items[focused_idx].isLive()) {
+			break;
+		}
 		selected = !selected;
 		needUpdateSelected = true;
 		items[focused_idx].setSelected(selected);
@@ -157,6 +185,7 @@ void Menu::show()
 		tmp_start_idx = i - 1;
 	}
 
+	uint16_t old_start_idx = start_idx;
 	bool need_scroll = false;
 	if (start_idx > focused_idx) {
 		start_idx = focused_idx;
@@ -170,8 +199,24 @@ void Menu::show()
 		start_idx = 0;
 		need_scroll = true;
 	}
-	if (needInit || needUpdateAll) {
+	bool need_init = needInit || needUpdateAll;
+	if (need_init) {
 		need_scroll = true;
+	} else if (start_idx == old_start_idx) {
+		need_scroll = false;
+	}
+
+	stepPixels = 0;
+
+	int32_t delta = (int32_t)start_idx - (int32_t)old_start_idx;
+	bool hw_scroll = need_scroll && !need_init && slots && __abs(delta) < slots;
+	bool redraw_scroll = needInit;
+	// Only the old and the new thumbs are repainted, the bar is filled on the init
+	bool clear_thumb = !needInit && last_focused_idx != focused_idx;
+	bool draw_thumb = redraw_scroll || clear_thumb;
+	uint16_t old_y = 0;
+	if (!needInit) {
+		old_y = (uint16_t)util_convert_range(last_focused_idx, real_start_idx, count - 1, y, y + h - SCROLL_HEIGHT);
 	}
 
 	if (!need_scroll) {
@@ -184,44 +229,173 @@ void Menu::show()
 		items[focused_idx].setFocused(true);
 		items[focused_idx].show();
 		items[focused_idx].setNeedUpdate(false);
-	}
+	} else if (hw_scroll) {
+		// The thumb rows scroll with the items: the old thumb is cleared before the offset changes
+		fillScroll(old_y, SCROLL_HEIGHT, DISPLAY_COLOR_LIGHT_GRAY);
+		clear_thumb = false;
+		draw_thumb = true;
 
-	uint16_t curr_height = 0;
-	for (unsigned i = start_idx; i < count; i++) {
-		if (!need_scroll) {
-			break;
+		int32_t offset = ((int32_t)scrollOffset + delta * slotHeight) % scrollArea();
+		scrollTo((uint16_t)(offset < 0 ? offset + scrollArea() : offset));
+
+		// Visible items keep their display rows, only the exposed slots are drawn
+		uint16_t first = (uint16_t)(delta > 0 ? slots - delta : 0);
+		uint16_t last  = (uint16_t)(delta > 0 ? slots : -delta);
+		for (uint16_t slot = first; slot < last; slot++) {
+			uint16_t idx = (uint16_t)(start_idx + slot);
+			if (idx < count) {
+				showItem(idx, slotY(slot));
+			} else {
+				display_fill_rect(x, slotY(slot), (uint16_t)(w - SCROLL_WIDTH), slotHeight, DISPLAY_COLOR_WHITE);
+			}
 		}
-		if (curr_height + items[i].height() >= h) {
-			break;
+
+		uint16_t focus_update[] = { last_focused_idx, focused_idx };
+		for (uint16_t idx : focus_update) {
+			if (idx < start_idx + first || idx >= start_idx + last) {
+				if (idx >= start_idx && idx < start_idx + slots) {
+					showItem(idx, items[idx].getY());
+				}
+			}
+		}
+	} else {
+		if (scrollOffset) {
+			if (!needInit) {
+				fillScroll(old_y, SCROLL_HEIGHT, DISPLAY_COLOR_LIGHT_GRAY);
+				clear_thumb = false;
+				draw_thumb = true;
+			}
+			scrollTo(0);
+		}
+
+		uint16_t curr_height = 0;
+		for (unsigned i = start_idx; i < count; i++) {
+			if (curr_height + items[i].height() >= h) {
+				break;
+			}
+			showItem((uint16_t)i, (uint16_t)(y + curr_height));
+			curr_height += items[i].height();
 		}
-		items[i].setNeedUpdate(need_scroll);
-		items[i].setY((uint16_t)(y + curr_height));
-		items[i].setFocused(focused_idx == i);
-		items[i].show();
-		items[i].setNeedUpdate(false);
-		curr_height += items[i].height();
 	}
 
-	if (needInit) {
-		uint16_t scroll_x = (uint16_t)(x + w - SCROLL_WIDTH);
-		display_fill_rect(scroll_x, y, SCROLL_WIDTH, h, DISPLAY_COLOR_LIGHT_GRAY);
+	if (redraw_scroll) {
+		fillScroll(y, h, DISPLAY_COLOR_LIGHT_GRAY);
 		needInit = false;
-	} else if (last_focused_idx != focused_idx) {
-		uint16_t new_x = (uint16_t)(x + w - SCROLL_WIDTH);
-		uint16_t old_y = (uint16_t)util_convert_range(last_focused_idx, real_start_idx, count - 1, y, y + h - SCROLL_HEIGHT);
-		display_fill_rect(new_x, old_y, SCROLL_WIDTH, SCROLL_HEIGHT, DISPLAY_COLOR_LIGHT_GRAY);
+	} else if (clear_thumb) {
+		fillScroll(old_y, SCROLL_HEIGHT, DISPLAY_COLOR_LIGHT_GRAY);
 	}
 
-	if (last_focused_idx != focused_idx) {
-		uint16_t new_x = (uint16_t)(x + w - SCROLL_WIDTH);
+	if (draw_thumb) {
 		uint16_t new_y = (uint16_t)util_convert_range(focused_idx, real_start_idx, count - 1, y, y + h - SCROLL_HEIGHT);
-		display_fill_rect(new_x, new_y, SCROLL_WIDTH, SCROLL_HEIGHT, DISPLAY_COLOR_LIGHT_GRAY2);
+		fillScroll(new_y, SCROLL_HEIGHT, DISPLAY_COLOR_LIGHT_GRAY2);
 		last_focused_idx = focused_idx;
 	}
 
+#if MENU_BEDUG
+	if (need_scroll) {
+		printTagLog(TAG, "scroll step (%s): %lu pixels", hw_scroll ? "hardware" : "repaint", stepPixels);
+	}
+#endif
+
 	needUpdateAll = false;
 }
 
+void Menu::refreshNext()
+{
+	if (needInit || needUpdateAll || focused_idx != last_focused_idx) {
+		return;
+	}
+
+	uint16_t visible = visibleCount();
+	if (!visible) {
+		return;
+	}
+
+	refreshIdx = (uint16_t)((refreshIdx + 1) % visible);
+	uint16_t idx = (uint16_t)(start_idx + refreshIdx);
+	showItem(idx, items[idx].getY());
+}
+
+void Menu::updateLive()
+{
+	if (needInit || needUpdateAll || focused_idx != last_focused_idx) {
+		return;
+	}
+
+	uint16_t visible = visibleCount();
+	for (uint16_t idx = start_idx; idx < start_idx + visible; idx++) {
+		if (items[idx].isLive()) {
+			items[idx].show();
+		}
+	}
+}
+
+uint16_t Menu::visibleCount()
+{
+	uint16_t visible = 0;
+	uint16_t curr_height = 0;
+	for (unsigned i = start_idx; i < count; i++) {
+		if (curr_height + items[i].height() >= h) {
+			break;
+		}
+		curr_height += items[i].height();
+		visible++;
+	}
+	return visible;
+}
+
+uint16_t Menu::scrollArea()
+{
+	return (uint16_t)(slots * slotHeight);
+}
+
+/* Display row of the visible slot */
+uint16_t Menu::slotY(uint16_t slot)
+{
+	return (uint16_t)(y + (slot * slotHeight + scrollOffset) % scrollArea());
+}
+
+void Menu::scrollTo(uint16_t offset)
+{
+	scrollOffset = offset;
+	display_scroll(
+		(int16_t)(0 - scrollOffset),
+		y,
+		(uint16_t)(display_height() - y - scrollArea())
+	);
+}
+
+void Menu::showItem(uint16_t idx, uint16_t item_y)
+{
+	items[idx].setNeedUpdate(true);
+	items[idx].setY(item_y);
+	items[idx].setFocused(focused_idx == idx);
+	items[idx].show();
+	items[idx].setNeedUpdate(false);
+	stepPixels += (uint32_t)(w - SCROLL_WIDTH - 2) * items[idx].height();
+}
+
+/* Fills the scroll bar part by the screen rows, the scrolled rows are mapped to the display rows */
+void Menu::fillScroll(uint16_t top, uint16_t height, uint16_t color)
+{
+	uint16_t scroll_x = (uint16_t)(x + w - SCROLL_WIDTH);
+	uint16_t area = scrollArea();
+	uint16_t bottom = (uint16_t)(top + height);
+	while (top < bottom) {
+		uint16_t part = (uint16_t)(bottom - top);
+		uint16_t display_y = top;
+		if (top < y + area) {
+			uint16_t row = (uint16_t)((top - y + scrollOffset) % area);
+			display_y = (uint16_t)(y + row);
+			part = __min(part, (uint16_t)(area - row));
+			part = __min(part, (uint16_t)(y + area - top));
+		}
+		display_fill_rect(scroll_x, display_y, SCROLL_WIDTH, part, color);
+		stepPixels += (uint32_t)SCROLL_WIDTH * part;
+		top = (uint16_t)(top + part);
+	}
+}
+
 unsigned Menu::itemsCount()
 {
 	return count;
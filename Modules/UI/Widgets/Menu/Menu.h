@@ -4,13 +4,15 @@
 #define _MENU_H_
 
 
-#include <memory>
 #include <cstdint>
 
 #include "Timer.h"
 #include "MenuItem.h"
 
 
+#define MENU_BEDUG (false)
+
+
 class Menu
 {
 private:
@@ -21,12 +23,19 @@ private:
 
 	static const uint32_t HOLD_TIMEOUT_MS = 100;
 
+	// SERVICE_MENU has 19 lines, every item is 28 bytes of RAM
+	static const uint16_t ITEMS_MAX = 20;
+
+#if MENU_BEDUG
+	static constexpr char TAG[] = "MENU";
+#endif
+
 	uint16_t x;
 	uint16_t y;
 	uint16_t w;
 	uint16_t h;
 
-	std::unique_ptr<MenuItem[]> items;
+	MenuItem items[ITEMS_MAX];
 	uint16_t count;
 
 	uint16_t start_idx;
@@ -41,10 +50,29 @@ private:
 	bool needUpdateSelected;
 	bool needUpdateAll;
 
+	// Items are scrolled by the display vertical scrolling if all of them have the same height
+	uint16_t slotHeight;
+	uint16_t slots;
+	uint16_t scrollOffset;
+
+	uint32_t stepPixels;
+
+	// Visible item index of the next refreshNext()
+	uint16_t refreshIdx;
+
+	uint16_t visibleCount();
+	uint16_t scrollArea();
+	uint16_t slotY(uint16_t slot);
+	void scrollTo(uint16_t offset);
+	void showItem(uint16_t idx, uint16_t item_y);
+	void fillScroll(uint16_t top, uint16_t height, uint16_t color);
+
 public:
-	Menu(uint16_t x, uint16_t y, uint16_t w, uint16_t h, MenuItem* items, uint16_t size);
+	Menu(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const menu_descriptor_t* table, uint16_t count);
 
 	void reset();
+	// Returns the display scrolling to the start position
+	void resetScroll();
 
 	void click(uint16_t button);
 	void holdUp();
@@ -52,6 +80,10 @@ public:
 	void update();
 
 	void show();
+	// Repaints the next visible item in turn (the display self-healing)
+	void refreshNext();
+	// Repaints the visible live items whose text has changed
+	void updateLive();
 
 	unsigned itemsCount();
 
@@ -0,0 +1,142 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Menu tests on lcd_emu: the hardware scroll steps show the same screen
+ * as the full repaint and repaint only the exposed lines and the thumbs
+ */
+
+#include <cstdio>
+#include <cstring>
+
+#include "test.h"
+#include "main.h"
+#include "Menu.h"
+#include "display.h"
+#include "lcd_emu.h"
+
+
+static const unsigned LINES = 16;
+
+static const char LABELS[LINES][1][TRANSLATE_MAX_LEN] = {
+	{"Line 0"},  {"Line 1"},  {"Line 2"},  {"Line 3"},
+	{"Line 4"},  {"Line 5"},  {"Line 6"},  {"Line 7"},
+	{"Line 8"},  {"Line 9"},  {"Line 10"}, {"Line 11"},
+	{"Line 12"}, {"Line 13"}, {"Line 14"}, {"Line 15"},
+};
+
+static uint8_t values[LINES] = {};
+
+static menu_descriptor_t table[LINES] = {};
+
+static uint16_t screen[DISPLAY_HEIGHT][DISPLAY_WIDTH];
+
+
+const char* menu_label(const menu_descriptor_t* descriptor)
+{
+	return descriptor->label[0];
+}
+
+void menu_value(const menu_descriptor_t* descriptor, format_t* line)
+{
+	format_uint(line, *descriptor->field);
+}
+
+void menu_click(const menu_descriptor_t* descriptor, uint16_t button)
+{
+	if (button == BTN_UP_Pin) {
+		(*descriptor->field)++;
+	}
+}
+
+
+static void table_init()
+{
+	for (unsigned i = 0; i < LINES; i++) {
+		table[i] = {LABELS[i], MENU_VALUE_SENSITIVITY, &values[i], 0, 9, 1, 0};
+	}
+}
+
+static void screen_save()
+{
+	for (uint16_t y = 0; y < DISPLAY_HEIGHT; y++) {
+		for (uint16_t x = 0; x < DISPLAY_WIDTH; x++) {
+			screen[y][x] = lcd_emu_pixel(x, y);
+		}
+	}
+}
+
+static bool screen_same()
+{
+	for (uint16_t y = 0; y < DISPLAY_HEIGHT; y++) {
+		for (uint16_t x = 0; x < DISPLAY_WIDTH; x++) {
+			if (screen[y][x] != lcd_emu_pixel(x, y)) {
+				printf("pixel %u,%u: %04X != %04X\n", x, y, screen[y][x], lcd_emu_pixel(x, y));
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+/* The same steps with the full repaint of the lines */
+static void reference_show(Menu& menu, int steps)
+{
+	menu.resetScroll();
+	display_fill_rect(0, DISPLAY_HEADER_HEIGHT, DISPLAY_WIDTH, DISPLAY_CONTENT_HEIGHT, DISPLAY_COLOR_WHITE);
+
+	Menu reference(0, DISPLAY_HEADER_HEIGHT, DISPLAY_WIDTH, DISPLAY_CONTENT_HEIGHT, table, LINES);
+	reference.show();
+	for (int i = 0; i < (steps < 0 ? -steps : steps); i++) {
+		reference.click(steps < 0 ? BTN_UP_Pin : BTN_DOWN_Pin);
+		reference.update();
+		reference.show();
+	}
+}
+
+static void test_scroll_steps(int steps)
+{
+	display_init();
+	display_fill_rect(0, DISPLAY_HEADER_HEIGHT, DISPLAY_WIDTH, DISPLAY_CONTENT_HEIGHT, DISPLAY_COLOR_WHITE);
+
+	Menu menu(0, DISPLAY_HEADER_HEIGHT, DISPLAY_WIDTH, DISPLAY_CONTENT_HEIGHT, table, LINES);
+	menu.show();
+
+	/* A scroll step draws the exposed line, the focus and the thumbs like a focus step without the scroll */
+	uint32_t focus_step = 0;
+	uint32_t pixels_max = 0;
+	unsigned focus = 0;
+	for (int i = 0; i < (steps < 0 ? -steps : steps); i++) {
+		menu.click(steps < 0 ? BTN_UP_Pin : BTN_DOWN_Pin);
+		lcd_emu_reset_stats();
+		menu.show();
+
+		/* The jump between the ends is the full repaint */
+		bool wrap = steps < 0 ? focus == 0 : focus == LINES - 1;
+		focus = (focus + (steps < 0 ? LINES - 1 : 1)) % LINES;
+		if (!wrap && !focus_step) {
+			focus_step = lcd_emu_stats()->pixels;
+		}
+		if (!wrap && lcd_emu_stats()->pixels > pixels_max) {
+			pixels_max = lcd_emu_stats()->pixels;
+		}
+	}
+	printf("%d steps: %u pixels per step max, %u of the first step\n", steps, pixels_max, focus_step);
+	TEST_CHECK(pixels_max <= focus_step);
+
+	screen_save();
+	reference_show(menu, steps);
+	TEST_CHECK(screen_same());
+}
+
+
+int main()
+{
+	table_init();
+
+	int steps[] = {1, 9, 12, 15, 16, 17, 25, -1, -5};
+	for (int step : steps) {
+		test_scroll_steps(step);
+	}
+
+	return TEST_RESULT();
+}
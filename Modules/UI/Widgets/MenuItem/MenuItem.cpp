@@ -2,39 +2,17 @@
 
 #include "MenuItem.h"
 
-#include "gstring.h"
-
 
 MenuItem::MenuItem():
-	x(0), y(0), w(0), font(&Font12), focused(false), selected(false),
-	background(DISPLAY_COLOR_BLACK), selectable(true), needUpdate(false)
+	x(0), y(0), w(0), font(&u8g2_font_8x13_t_cyrillic), focused(false), selected(false),
+	background(DISPLAY_COLOR_BLACK), lineHash(0), descriptor(nullptr), needUpdate(false)
 {}
 
-MenuItem::MenuItem(const MenuItem& other)
-{
-	*this = other;
-}
-
-MenuItem::MenuItem(IMenuCallback* callback, const bool selectable, sFONT* font):
+MenuItem::MenuItem(const menu_descriptor_t* descriptor, sFONT* font):
 	x(0), y(0), w(0), font(font), focused(false), selected(false),
-	background(DISPLAY_COLOR_BLACK), callback(callback), selectable(selectable), needUpdate(false)
+	background(DISPLAY_COLOR_BLACK), lineHash(0), descriptor(descriptor), needUpdate(false)
 {}
 
-MenuItem::~MenuItem()
-{}
-
-MenuItem& MenuItem::operator=(const MenuItem& other)
-{
-	x = other.x;
-	y = other.y;
-	font = other.font;
-	focused = other.focused;
-	background = other.background;
-	callback = other.callback;
-	selectable = other.selectable;
-	return *this;
-}
-
 void MenuItem::setX(const uint16_t x)
 {
 	this->x = x;
@@ -65,9 +43,9 @@ void MenuItem::setSelected(bool selected)
 	this->selected = selected;
 }
 
-void MenuItem::setCallback(IMenuCallback& callback)
+void MenuItem::setDescriptor(const menu_descriptor_t* descriptor)
 {
-	this->callback = &callback;
+	this->descriptor = descriptor;
 }
 
 void MenuItem::setNeedUpdate(bool state)
@@ -82,7 +60,12 @@ bool MenuItem::isFocused()
 
 bool MenuItem::isSelectable()
 {
-	return selectable;
+	return descriptor && (descriptor->field || isLive());
+}
+
+bool MenuItem::isLive()
+{
+	return descriptor && (descriptor->flags & MENU_FLAG_LIVE);
 }
 
 uint16_t MenuItem::getX()
@@ -102,21 +85,23 @@ uint16_t MenuItem::height()
 
 void MenuItem::show()
 {
-	unsigned value_index = (w / 3 * 2) / font->Width;
 	char line[LABEL_MAX_LEN + VALUE_MAX_LEN + 1] = "";
-	memset(line, ' ', sizeof(line));
-	line[sizeof(line) - 1] = 0;
-
-	memcpy(line, callback->label(), strlen(callback->label()));
-
-	memcpy(&line[value_index], callback->value(), strlen(callback->value()));
-	line[value_index + strlen(callback->value())] = 0;
-	util_add_char(
-		line,
-		sizeof(line),
-		' ',
+	format_t format = {};
+	format_init(&format, line, sizeof(line));
+	format_str(&format, menu_label(descriptor));
+
+	bool value = descriptor->format != MENU_VALUE_NONE;
+	if (value) {
+		// The long label is cut to keep one space at least before the value
+		unsigned column = (w / 3 * 2) / font->Width;
+		format_truncate(&format, column ? column - 1 : 0);
+		format_align(&format, column, FORMAT_ALIGN_LEFT);
+		menu_value(descriptor, &format);
+	}
+	format_align(
+		&format,
 		w / font->Width,
-		(selectable || strlen(callback->value())) ? ALIGN_MODE_LEFT : ALIGN_MODE_CENTER
+		(isSelectable() || value) ? FORMAT_ALIGN_LEFT : FORMAT_ALIGN_CENTER
 	);
 
 	uint16_t curr_color = DISPLAY_COLOR_WHITE;
@@ -125,15 +110,26 @@ void MenuItem::show()
 	} else if (focused) {
 		curr_color = DISPLAY_COLOR_LIGHT_GRAY;
 	}
-	if (needUpdate || background != curr_color) {
+	bool repaint = needUpdate || background != curr_color;
+	if (repaint) {
 		background = curr_color;
 		display_fill_rect(x, y, w, height(), background);
 	}
 
+	// FNV-1a
+	uint32_t hash = 2166136261u;
+	for (unsigned i = 0; i < format.length; i++) {
+		hash = (hash ^ (uint8_t)line[i]) * 16777619u;
+	}
+	if (!repaint && hash == lineHash) {
+		return;
+	}
+	lineHash = hash;
+
 	uint16_t max_len = (uint16_t)((w - 2 * MARGIN) / font->Width);
 	display_set_color(DISPLAY_COLOR_BLACK);
 	display_set_background(background);
-	display_text_show(x + MARGIN, y + MARGIN, font, DISPLAY_ALIGN_LEFT, line, __min(max_len, strlen(line)), 1);
+	display_text_run(x + MARGIN, y + MARGIN, font, DISPLAY_ALIGN_LEFT, line, __min(max_len, strlen(line)), 1);
 }
 
 void MenuItem::hide()
@@ -143,5 +139,5 @@ void MenuItem::hide()
 
 void MenuItem::click(uint16_t button)
 {
-	callback->click(button);
+	menu_click(descriptor, button);
 }
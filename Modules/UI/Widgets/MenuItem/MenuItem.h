@@ -9,14 +9,7 @@
 
 #include "gutils.h"
 #include "display.h"
-
-
-struct IMenuCallback
-{
-	virtual void click(uint16_t) = 0;
-	virtual char* value() = 0;
-	virtual char* label() = 0;
-};
+#include "MenuTable.h"
 
 
 struct MenuItem
@@ -37,20 +30,17 @@ private:
 	bool selected;
 
 	uint16_t background;
+	// Hash of the shown line: the live line is not sent to the display while its text is the same
+	uint32_t lineHash;
 
-	IMenuCallback* callback;
+	const menu_descriptor_t* descriptor;
 
-	bool selectable;
 	bool needUpdate;
 
 public:
 
 	MenuItem();
-	MenuItem(const MenuItem& other);
-	MenuItem(IMenuCallback* callback, const bool selectable = true, sFONT* font = &u8g2_font_8x13_t_cyrillic);
-	~MenuItem();
-
-	MenuItem& operator=(const MenuItem& other);
+	MenuItem(const menu_descriptor_t* descriptor, sFONT* font = &u8g2_font_8x13_t_cyrillic);
 
 	void setX(const uint16_t x);
 	void setY(const uint16_t y);
@@ -58,11 +48,12 @@ public:
 	void setFont(sFONT* font);
 	void setFocused(bool focused);
 	void setSelected(bool selected);
-	void setCallback(IMenuCallback& callback);
+	void setDescriptor(const menu_descriptor_t* descriptor);
 	void setNeedUpdate(bool state);
 
 	bool isFocused();
 	bool isSelectable();
+	bool isLive();
 
 	uint16_t getX();
 	uint16_t getY();
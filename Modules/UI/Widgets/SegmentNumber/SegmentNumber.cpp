@@ -0,0 +1,221 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#include "SegmentNumber.h"
+
+#include <cstring>
+
+#include "glog.h"
+#include "gutils.h"
+#include "hal_defs.h"
+
+
+const uint8_t SegmentNumber::digitSegments[10] = {
+	SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,
+	SEGMENT_B | SEGMENT_C,
+	SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,
+	SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G,
+	SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,
+	SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,
+	SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,
+	SEGMENT_A | SEGMENT_B | SEGMENT_C,
+	SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,
+	SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,
+};
+
+utl::Timer SegmentNumber::rateTimer(SECOND_MS);
+
+uint32_t SegmentNumber::pixelsCounter = 0;
+uint32_t SegmentNumber::pixelsRate    = 0;
+
+
+SegmentNumber::SegmentNumber(
+	const uint16_t x,
+	const uint16_t y,
+	const uint16_t digitWidth,
+	const uint16_t digitHeight,
+	const uint16_t thickness,
+	const DISPLAY_ALIGN_MODE mode
+):
+	x(x), y(y), digitWidth(digitWidth), digitHeight(digitHeight), thickness(thickness),
+	color(DISPLAY_COLOR_BLACK), background(DISPLAY_COLOR_WHITE),
+	cells(), needUpdate(true)
+{
+	uint16_t w = width(digitWidth, thickness);
+	switch (mode) {
+	case DISPLAY_ALIGN_CENTER:
+		this->x = (uint16_t)(x - w / 2);
+		this->y = (uint16_t)(y - digitHeight / 2);
+		break;
+	case DISPLAY_ALIGN_RIGHT:
+		this->x = (uint16_t)(x - w);
+		break;
+	default:
+		break;
+	}
+}
+
+void SegmentNumber::setColor(uint16_t color)
+{
+	if (this->color != color) {
+		needUpdate = true;
+	}
+	this->color = color;
+}
+
+void SegmentNumber::setBackground(uint16_t background)
+{
+	if (this->background != background) {
+		needUpdate = true;
+	}
+	this->background = background;
+}
+
+void SegmentNumber::setNeedUpdate(bool state)
+{
+	needUpdate = state;
+}
+
+uint16_t SegmentNumber::left()
+{
+	return x;
+}
+
+uint16_t SegmentNumber::right()
+{
+	return (uint16_t)(x + width(digitWidth, thickness));
+}
+
+void SegmentNumber::show(int32_t value)
+{
+	uint8_t segments[CELLS_COUNT] = {};
+
+	uint32_t number = (uint32_t)__abs(value);
+	unsigned index = CELLS_COUNT;
+	do {
+		segments[--index] = digitSegments[number % 10];
+		number /= 10;
+	} while (index > 1 && (number || index > 1 + INT_DIGITS - 1));
+
+	if (number) {
+		showError();
+		return;
+	}
+	if (value < 0) {
+		segments[index - 1] = SEGMENT_G;
+	}
+
+	draw(segments);
+}
+
+void SegmentNumber::showError()
+{
+	uint8_t segments[CELLS_COUNT] = {};
+	memset(&segments[1], SEGMENT_G, CELLS_COUNT - 1);
+	draw(segments);
+}
+
+uint32_t SegmentNumber::pixelsPerSecond()
+{
+	return pixelsRate;
+}
+
+uint16_t SegmentNumber::cellLeft(unsigned index)
+{
+	uint16_t left = (uint16_t)(x + index * (digitWidth + thickness));
+	if (index > INT_DIGITS) {
+		left = (uint16_t)(left + 2 * thickness);
+	}
+	return left;
+}
+
+void SegmentNumber::draw(const uint8_t* segments)
+{
+	uint32_t pixels = 0;
+
+	if (needUpdate) {
+		display_fill_rect(x, y, width(digitWidth, thickness), digitHeight, background);
+		pixels += (uint32_t)width(digitWidth, thickness) * digitHeight;
+		memset(cells, 0, sizeof(cells));
+
+		if (FRAC_DIGITS) {
+			uint16_t half = (uint16_t)((digitHeight - 3 * thickness) / 2);
+			display_fill_rect(
+				(uint16_t)(cellLeft(INT_DIGITS) + digitWidth + thickness),
+				(uint16_t)(y + 2 * half + 2 * thickness),
+				thickness,
+				thickness,
+				color
+			);
+			pixels += (uint32_t)thickness * thickness;
+		}
+		needUpdate = false;
+	}
+
+	for (unsigned i = 0; i < CELLS_COUNT; i++) {
+		uint8_t changed = cells[i] ^ segments[i];
+		for (unsigned j = 0; j < SEGMENTS_COUNT; j++) {
+			uint8_t segment = (uint8_t)(1 << j);
+			if (changed & segment) {
+				pixels += drawSegment(cellLeft(i), segment, (segments[i] & segment) ? color : background);
+			}
+		}
+		cells[i] = segments[i];
+	}
+
+	count(pixels);
+}
+
+uint32_t SegmentNumber::drawSegment(uint16_t left, uint8_t segment, uint16_t segmentColor)
+{
+	uint16_t t    = thickness;
+	uint16_t len  = (uint16_t)(digitWidth - 2 * t);
+	uint16_t half = (uint16_t)((digitHeight - 3 * t) / 2);
+	uint16_t top  = y;
+
+	uint16_t sx = 0, sy = 0, sw = t, sh = half;
+	switch (segment) {
+	case SEGMENT_A:
+		sx = t;                 sy = 0;                sw = len; sh = t;
+		break;
+	case SEGMENT_B:
+		sx = digitWidth - t;    sy = t;
+		break;
+	case SEGMENT_C:
+		sx = digitWidth - t;    sy = 2 * t + half;
+		break;
+	case SEGMENT_D:
+		sx = t;                 sy = 2 * t + 2 * half; sw = len; sh = t;
+		break;
+	case SEGMENT_E:
+		sx = 0;                 sy = 2 * t + half;
+		break;
+	case SEGMENT_F:
+		sx = 0;                 sy = t;
+		break;
+	case SEGMENT_G:
+		sx = t;                 sy = t + half;         sw = len; sh = t;
+		break;
+	default:
+		return 0;
+	}
+
+	display_fill_rect((uint16_t)(left + sx), (uint16_t)(top + sy), sw, sh, segmentColor);
+	return (uint32_t)sw * sh;
+}
+
+void SegmentNumber::count(uint32_t pixels)
+{
+	pixelsCounter += pixels;
+
+	if (rateTimer.wait()) {
+		return;
+	}
+
+	pixelsRate    = pixelsCounter;
+	pixelsCounter = 0;
+	rateTimer.start();
+
+#if SEGMENT_NUMBER_BEDUG
+	printTagLog(TAG, "pixels per second: %lu", pixelsRate);
+#endif
+}
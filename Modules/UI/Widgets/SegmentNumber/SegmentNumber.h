@@ -0,0 +1,107 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#ifndef _SEGMENT_NUMBER_H_
+#define _SEGMENT_NUMBER_H_
+
+
+#include <cstdint>
+
+#include "Timer.h"
+#include "display.h"
+
+
+#define SEGMENT_NUMBER_BEDUG (false)
+
+
+/*
+ * Seven-segment fixed point number ("-123.4") drawn by filled rectangles.
+ * The widget remembers the segments of every digit
+ * and fills only the segments that have been switched on or off
+ */
+struct SegmentNumber
+{
+public:
+	static const unsigned INT_DIGITS  = 3;
+	static const unsigned FRAC_DIGITS = 1;
+
+	static constexpr uint16_t width(const uint16_t digitWidth, const uint16_t thickness)
+	{
+		return (uint16_t)(
+			CELLS_COUNT * (digitWidth + thickness) + // digits and the sign
+			(FRAC_DIGITS ? 2 * thickness : 0) -      // point
+			thickness
+		);
+	}
+
+private:
+	static constexpr char TAG[] = "SEG";
+
+	// Sign cell, integer digits and fraction digits
+	static const unsigned CELLS_COUNT = 1 + INT_DIGITS + FRAC_DIGITS;
+
+	enum SEGMENT {
+		SEGMENT_A = 0x01,
+		SEGMENT_B = 0x02,
+		SEGMENT_C = 0x04,
+		SEGMENT_D = 0x08,
+		SEGMENT_E = 0x10,
+		SEGMENT_F = 0x20,
+		SEGMENT_G = 0x40,
+	};
+	static const unsigned SEGMENTS_COUNT = 7;
+
+	static const uint8_t digitSegments[10];
+
+	static utl::Timer rateTimer;
+
+	static uint32_t pixelsCounter;
+	static uint32_t pixelsRate;
+
+	uint16_t x;
+	uint16_t y;
+	uint16_t digitWidth;
+	uint16_t digitHeight;
+	uint16_t thickness;
+
+	uint16_t color;
+	uint16_t background;
+
+	uint8_t cells[CELLS_COUNT];
+
+	bool needUpdate;
+
+	uint16_t cellLeft(unsigned index);
+	void draw(const uint8_t* segments);
+	uint32_t drawSegment(uint16_t left, uint8_t segment, uint16_t segmentColor);
+
+	static void count(uint32_t pixels);
+
+public:
+	SegmentNumber(
+		const uint16_t x,
+		const uint16_t y,
+		const uint16_t digitWidth,
+		const uint16_t digitHeight,
+		const uint16_t thickness,
+		const DISPLAY_ALIGN_MODE mode = DISPLAY_ALIGN_CENTER
+	);
+
+	void setColor(uint16_t color);
+	void setBackground(uint16_t background);
+	void setNeedUpdate(bool state);
+
+	uint16_t left();
+	uint16_t right();
+
+	// value in 10^-FRAC_DIGITS units
+	void show(int32_t value);
+	// Dashes in all the digits
+	void showError();
+
+	// Pixels sent to the display during the last second
+	static uint32_t pixelsPerSecond();
+
+};
+
+
+#endif
@@ -0,0 +1,107 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * The value widget benchmark on lcd_emu: the random walk of the value is drawn
+ * by the 20x36 SegmentNumber of UI and by the scale 2 8x13 TextField it has replaced,
+ * the pixels, SPI bytes and commands per update are printed for both
+ */
+
+#include <cstdio>
+
+#include "test.h"
+#include "display.h"
+#include "lcd_emu.h"
+#include "TextField.h"
+#include "SegmentNumber.h"
+
+
+static const unsigned UPDATES    = 1000;
+static const int32_t  VALUE_MAX  = 9999;
+static const uint16_t VALUE_X    = DISPLAY_WIDTH - 10;
+static const uint16_t VALUE_Y    = DISPLAY_HEADER_HEIGHT + 40;
+static const uint32_t TEXT_SCALE = 2;
+
+static uint32_t seed = 0;
+
+
+typedef struct _update_cost_t {
+	double pixels;
+	double bytes;
+	double commands;
+} update_cost_t;
+
+
+static int32_t next_value(int32_t value)
+{
+	seed = seed * 1664525u + 1013904223u;
+	value += (int32_t)((seed >> 8) % 7) - 3;
+	if (value > VALUE_MAX) {
+		return VALUE_MAX;
+	}
+	if (value < -VALUE_MAX) {
+		return -VALUE_MAX;
+	}
+	return value;
+}
+
+static update_cost_t update_cost(const char* name)
+{
+	const lcd_emu_stats_t* stats = lcd_emu_stats();
+	update_cost_t cost = {
+		(double)stats->pixels / UPDATES,
+		(double)stats->bytes / UPDATES,
+		(double)stats->commands / UPDATES
+	};
+	printf("%-24s %6.1f px  %7.1f SPI bytes  %5.1f commands per update\n", name, cost.pixels, cost.bytes, cost.commands);
+	return cost;
+}
+
+static update_cost_t bench_text()
+{
+	display_init();
+	TextField field(VALUE_X, VALUE_Y, &u8g2_font_8x13_t_cyrillic, DISPLAY_ALIGN_RIGHT, TEXT_SCALE);
+	int32_t value = 123;
+	field.show("12.3");
+	display_queue_wait();
+
+	seed = 12345;
+	lcd_emu_reset_stats();
+	for (unsigned i = 0; i < UPDATES; i++) {
+		value = next_value(value);
+		char text[TextField::LEN_MAX + 1] = {};
+		int32_t number = value < 0 ? -value : value;
+		snprintf(text, sizeof(text), "%s%ld.%ld", value < 0 ? "-" : "", (long)(number / 10), (long)(number % 10));
+		field.show(text);
+		display_queue_wait();
+	}
+	return update_cost("TextField x2");
+}
+
+static update_cost_t bench_segments()
+{
+	display_init();
+	SegmentNumber widget(VALUE_X, VALUE_Y, 20, 36, 4, DISPLAY_ALIGN_RIGHT);
+	int32_t value = 123;
+	widget.show(value);
+	display_queue_wait();
+
+	seed = 12345;
+	lcd_emu_reset_stats();
+	for (unsigned i = 0; i < UPDATES; i++) {
+		value = next_value(value);
+		widget.show(value);
+		display_queue_wait();
+	}
+	return update_cost("SegmentNumber 20x36");
+}
+
+
+int main()
+{
+	update_cost_t text     = bench_text();
+	update_cost_t segments = bench_segments();
+	TEST_CHECK(segments.pixels < text.pixels);
+	TEST_CHECK(segments.bytes < text.bytes);
+	TEST_CHECK(segments.commands < text.commands);
+	return TEST_RESULT();
+}
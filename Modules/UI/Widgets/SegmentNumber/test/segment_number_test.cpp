@@ -0,0 +1,185 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * SegmentNumber tests on lcd_emu: the sign is in the cell before the first digit,
+ * the error and the out of range values are the dashes, an update fills only
+ * the switched segments and leaves the screen of the number drawn at once
+ */
+
+#include <cstdio>
+#include <cstring>
+
+#include "test.h"
+#include "display.h"
+#include "lcd_emu.h"
+#include "SegmentNumber.h"
+
+
+static const uint16_t NUMBER_X     = 20;
+static const uint16_t NUMBER_Y     = DISPLAY_HEADER_HEIGHT + 40;
+static const uint16_t DIGIT_WIDTH  = 20;
+static const uint16_t DIGIT_HEIGHT = 36;
+static const uint16_t THICKNESS    = 4;
+static const uint16_t HALF         = (DIGIT_HEIGHT - 3 * THICKNESS) / 2;
+
+static const unsigned CELLS = 1 + SegmentNumber::INT_DIGITS + SegmentNumber::FRAC_DIGITS;
+
+static uint16_t screen[DISPLAY_HEIGHT][DISPLAY_WIDTH];
+
+
+static SegmentNumber number()
+{
+	return SegmentNumber(NUMBER_X, NUMBER_Y, DIGIT_WIDTH, DIGIT_HEIGHT, THICKNESS, DISPLAY_ALIGN_LEFT);
+}
+
+static void screen_clear()
+{
+	display_init();
+	display_fill_rect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, DISPLAY_COLOR_WHITE);
+	display_queue_wait();
+}
+
+static void screen_save()
+{
+	for (uint16_t y = 0; y < DISPLAY_HEIGHT; y++) {
+		for (uint16_t x = 0; x < DISPLAY_WIDTH; x++) {
+			screen[y][x] = lcd_emu_pixel(x, y);
+		}
+	}
+}
+
+static unsigned screen_differences()
+{
+	unsigned differences = 0;
+	for (uint16_t y = 0; y < DISPLAY_HEIGHT; y++) {
+		for (uint16_t x = 0; x < DISPLAY_WIDTH; x++) {
+			if (screen[y][x] != lcd_emu_pixel(x, y) && !differences++) {
+				printf("pixel %u,%u: %04X != %04X\n", x, y, screen[y][x], lcd_emu_pixel(x, y));
+			}
+		}
+	}
+	return differences;
+}
+
+static uint16_t cellLeft(unsigned index)
+{
+	uint16_t left = (uint16_t)(NUMBER_X + index * (DIGIT_WIDTH + THICKNESS));
+	if (index > SegmentNumber::INT_DIGITS) {
+		left = (uint16_t)(left + 2 * THICKNESS);
+	}
+	return left;
+}
+
+// The middle of the G segment (the dash) and of the A segment (the top) of the cell
+static bool dash(unsigned index)
+{
+	uint16_t x = (uint16_t)(cellLeft(index) + DIGIT_WIDTH / 2);
+	return lcd_emu_pixel(x, (uint16_t)(NUMBER_Y + THICKNESS + HALF + THICKNESS / 2)) == DISPLAY_COLOR_BLACK;
+}
+
+static bool top(unsigned index)
+{
+	uint16_t x = (uint16_t)(cellLeft(index) + DIGIT_WIDTH / 2);
+	return lcd_emu_pixel(x, (uint16_t)(NUMBER_Y + THICKNESS / 2)) == DISPLAY_COLOR_BLACK;
+}
+
+// The number drawn by a new widget on the clean screen
+static void reference(int32_t value)
+{
+	screen_clear();
+	SegmentNumber widget = number();
+	widget.show(value);
+	display_queue_wait();
+	screen_save();
+}
+
+static void test_sign()
+{
+	screen_clear();
+	SegmentNumber widget = number();
+
+	// "-12.5": the sign before the tens
+	widget.show(-125);
+	display_queue_wait();
+	TEST_CHECK(!dash(0));
+	TEST_CHECK(dash(1) && !top(1));
+	TEST_CHECK(!dash(2) && !top(2));
+
+	// "-999.9": the sign in the first cell
+	widget.show(-9999);
+	display_queue_wait();
+	TEST_CHECK(dash(0) && !top(0));
+	TEST_CHECK(top(1));
+
+	// "0.5": no sign and the leading zero
+	widget.show(5);
+	display_queue_wait();
+	TEST_CHECK(!dash(0) && !dash(1) && !top(1) && !top(2));
+	TEST_CHECK(top(3) && !dash(3));
+	reference(5);
+	TEST_CHECK(screen_differences() == 0);
+}
+
+static void test_error()
+{
+	screen_clear();
+	SegmentNumber widget = number();
+	widget.show(888);
+	widget.showError();
+	display_queue_wait();
+	TEST_CHECK(!dash(0));
+	for (unsigned i = 1; i < CELLS; i++) {
+		TEST_CHECK(dash(i) && !top(i));
+	}
+	screen_save();
+
+	// The values out of the digits are the dashes too
+	widget.show(0);
+	widget.show(10000);
+	display_queue_wait();
+	TEST_CHECK(screen_differences() == 0);
+	widget.show(0);
+	widget.show(-10000);
+	display_queue_wait();
+	TEST_CHECK(screen_differences() == 0);
+}
+
+static void test_segments_only()
+{
+	reference(128);
+
+	screen_clear();
+	SegmentNumber widget = number();
+	widget.show(125);
+	display_queue_wait();
+
+	// 5 -> 8: the B and E segments only
+	lcd_emu_reset_stats();
+	widget.show(128);
+	display_queue_wait();
+	TEST_CHECK(lcd_emu_stats()->pixels == 2u * THICKNESS * HALF);
+	TEST_CHECK(screen_differences() == 0);
+
+	// The same value is not sent again
+	lcd_emu_reset_stats();
+	widget.show(128);
+	display_queue_wait();
+	TEST_CHECK(lcd_emu_stats()->commands == 0);
+
+	// The forced update fills the whole number again
+	lcd_emu_reset_stats();
+	widget.setNeedUpdate(true);
+	widget.show(128);
+	display_queue_wait();
+	TEST_CHECK(lcd_emu_stats()->pixels > (uint32_t)SegmentNumber::width(DIGIT_WIDTH, THICKNESS) * DIGIT_HEIGHT);
+	TEST_CHECK(screen_differences() == 0);
+}
+
+
+int main()
+{
+	test_sign();
+	test_error();
+	test_segments_only();
+	return TEST_RESULT();
+}
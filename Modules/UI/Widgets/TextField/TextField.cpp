@@ -0,0 +1,165 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#include "TextField.h"
+
+#include <cstring>
+
+#include "glog.h"
+#include "gutils.h"
+#include "hal_defs.h"
+
+
+utl::Timer TextField::rateTimer(SECOND_MS);
+
+uint32_t TextField::drawnCounter   = 0;
+uint32_t TextField::skippedCounter = 0;
+uint32_t TextField::drawnRate      = 0;
+uint32_t TextField::skippedRate    = 0;
+
+
+TextField::TextField(
+	const uint16_t x,
+	const uint16_t y,
+	sFONT* font,
+	const DISPLAY_ALIGN_MODE mode,
+	const uint32_t scale
+):
+	x(x), y(y), font(font), mode(mode), scale(scale),
+	color(DISPLAY_COLOR_BLACK), background(DISPLAY_COLOR_WHITE),
+	cells(), len(0), needUpdate(true)
+{}
+
+void TextField::setColor(uint16_t color)
+{
+	if (this->color != color) {
+		needUpdate = true;
+	}
+	this->color = color;
+}
+
+void TextField::setBackground(uint16_t background)
+{
+	if (this->background != background) {
+		needUpdate = true;
+	}
+	this->background = background;
+}
+
+void TextField::setNeedUpdate(bool state)
+{
+	needUpdate = state;
+}
+
+void TextField::show(const char* text)
+{
+	unsigned new_len = __min(strlen(text), LEN_MAX);
+
+	if (needUpdate || new_len != len) {
+		// The old text is cleared by its own width: the forced redraw of a shorter text too
+		if (new_len != len && len) {
+			display_fill_rect(
+				left(len),
+				top(),
+				(uint16_t)(len * font->Width * scale),
+				(uint16_t)(font->Height * scale),
+				background
+			);
+		}
+
+		memcpy(cells, text, new_len);
+		cells[new_len] = 0;
+		len = new_len;
+		needUpdate = false;
+
+		draw(0, len);
+		count(len, 0);
+		return;
+	}
+
+	unsigned drawn = 0;
+	unsigned i = 0;
+	while (i < len) {
+		if (cells[i] == text[i]) {
+			i++;
+			continue;
+		}
+
+		unsigned start = i;
+		while (i < len && cells[i] != text[i]) {
+			cells[i] = text[i];
+			i++;
+		}
+		draw(start, i - start);
+		drawn += i - start;
+	}
+	count(drawn, len - drawn);
+}
+
+uint32_t TextField::drawnPerSecond()
+{
+	return drawnRate;
+}
+
+uint32_t TextField::skippedPerSecond()
+{
+	return skippedRate;
+}
+
+uint16_t TextField::left(unsigned length)
+{
+	switch (mode) {
+	case DISPLAY_ALIGN_CENTER:
+		return (uint16_t)(x - (length * font->Width * scale) / 2);
+	case DISPLAY_ALIGN_RIGHT:
+		return (uint16_t)(x - length * font->Width * scale);
+	default:
+		return x;
+	}
+}
+
+uint16_t TextField::top()
+{
+	if (mode == DISPLAY_ALIGN_CENTER) {
+		return (uint16_t)(y - font->Height * scale / 2);
+	}
+	return y;
+}
+
+void TextField::draw(unsigned index, unsigned length)
+{
+	if (!length) {
+		return;
+	}
+
+	display_set_color(color);
+	display_set_background(background);
+	display_text_run(
+		(uint16_t)(left(len) + index * font->Width * scale),
+		top(),
+		font,
+		DISPLAY_ALIGN_LEFT,
+		&cells[index],
+		length,
+		scale
+	);
+}
+
+void TextField::count(uint32_t drawn, uint32_t skipped)
+{
+	drawnCounter   += drawn;
+	skippedCounter += skipped;
+
+	if (rateTimer.wait()) {
+		return;
+	}
+
+	drawnRate      = drawnCounter;
+	skippedRate    = skippedCounter;
+	drawnCounter   = 0;
+	skippedCounter = 0;
+	rateTimer.start();
+
+#if TEXT_FIELD_BEDUG
+	printTagLog(TAG, "glyphs per second: drawn=%lu skipped=%lu", drawnRate, skippedRate);
+#endif
+}
@@ -0,0 +1,78 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#ifndef _TEXT_FIELD_H_
+#define _TEXT_FIELD_H_
+
+
+#include <cstdint>
+
+#include "Timer.h"
+#include "display.h"
+
+
+#define TEXT_FIELD_BEDUG (false)
+
+
+/*
+ * Text line that remembers the last drawn character of every cell
+ * and redraws only the cells that have been changed
+ */
+struct TextField
+{
+public:
+	static const unsigned LEN_MAX = 40;
+
+private:
+	static constexpr char TAG[] = "TXT";
+
+	static utl::Timer rateTimer;
+
+	static uint32_t drawnCounter;
+	static uint32_t skippedCounter;
+	static uint32_t drawnRate;
+	static uint32_t skippedRate;
+
+	uint16_t x;
+	uint16_t y;
+	sFONT* font;
+	DISPLAY_ALIGN_MODE mode;
+	uint32_t scale;
+
+	uint16_t color;
+	uint16_t background;
+
+	char cells[LEN_MAX + 1];
+	unsigned len;
+
+	bool needUpdate;
+
+	uint16_t left(unsigned length);
+	uint16_t top();
+	void draw(unsigned index, unsigned length);
+
+	static void count(uint32_t drawn, uint32_t skipped);
+
+public:
+	TextField(
+		const uint16_t x,
+		const uint16_t y,
+		sFONT* font,
+		const DISPLAY_ALIGN_MODE mode = DISPLAY_ALIGN_CENTER,
+		const uint32_t scale = 1
+	);
+
+	void setColor(uint16_t color);
+	void setBackground(uint16_t background);
+	void setNeedUpdate(bool state);
+
+	void show(const char* text);
+
+	// Glyphs sent to the display during the last second
+	static uint32_t drawnPerSecond();
+	// Glyphs that were equal to the drawn ones during the last second
+	static uint32_t skippedPerSecond();
+
+};
+
+
+#endif
@@ -0,0 +1,164 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * TextField tests on lcd_emu: only the changed cells are sent, the length change
+ * and the forced redraw leave the screen of the new text drawn on the clean field
+ * and the drawn/skipped glyphs per second are counted
+ */
+
+#include <cstdio>
+#include <cstring>
+
+#include "test.h"
+#include "gtime.h"
+#include "hal_defs.h"
+#include "display.h"
+#include "lcd_emu.h"
+#include "TextField.h"
+
+
+static const uint16_t FIELD_X = DISPLAY_WIDTH / 2;
+static const uint16_t FIELD_Y = DISPLAY_HEADER_HEIGHT + 40;
+
+// CP1251 "ЗНАЧЕНИЕ:" and "ОШИБКА:"
+static const char VALUE_LABEL[] = "\xC7\xCD\xC0\xD7\xC5\xCD\xC8\xC5:";
+static const char ERROR_LABEL[] = "\xCE\xD8\xC8\xC1\xCA\xC0:";
+
+static uint16_t screen[DISPLAY_HEIGHT][DISPLAY_WIDTH];
+
+
+static void screen_clear()
+{
+	display_init();
+	display_fill_rect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, DISPLAY_COLOR_WHITE);
+	display_queue_wait();
+}
+
+static void screen_save()
+{
+	for (uint16_t y = 0; y < DISPLAY_HEIGHT; y++) {
+		for (uint16_t x = 0; x < DISPLAY_WIDTH; x++) {
+			screen[y][x] = lcd_emu_pixel(x, y);
+		}
+	}
+}
+
+static unsigned screen_differences()
+{
+	unsigned differences = 0;
+	for (uint16_t y = 0; y < DISPLAY_HEIGHT; y++) {
+		for (uint16_t x = 0; x < DISPLAY_WIDTH; x++) {
+			if (screen[y][x] != lcd_emu_pixel(x, y) && !differences++) {
+				printf("pixel %u,%u: %04X != %04X\n", x, y, screen[y][x], lcd_emu_pixel(x, y));
+			}
+		}
+	}
+	return differences;
+}
+
+// The text drawn by a new field on the clean screen
+static void reference(const char* text, DISPLAY_ALIGN_MODE mode, uint32_t scale)
+{
+	screen_clear();
+	TextField field(FIELD_X, FIELD_Y, &u8g2_font_8x13_t_cyrillic, mode, scale);
+	field.show(text);
+	display_queue_wait();
+	screen_save();
+}
+
+static uint32_t glyph_pixels(unsigned glyphs, uint32_t scale)
+{
+	return glyphs * u8g2_font_8x13_t_cyrillic.Width * u8g2_font_8x13_t_cyrillic.Height * scale * scale;
+}
+
+static void test_changed_cells(uint32_t scale)
+{
+	reference("12.7 mm", DISPLAY_ALIGN_RIGHT, scale);
+
+	screen_clear();
+	TextField field(FIELD_X, FIELD_Y, &u8g2_font_8x13_t_cyrillic, DISPLAY_ALIGN_RIGHT, scale);
+	field.show("12.5 mm");
+	lcd_emu_reset_stats();
+	field.show("12.7 mm");
+	display_queue_wait();
+	TEST_CHECK(lcd_emu_stats()->pixels == glyph_pixels(1, scale));
+	TEST_CHECK(screen_differences() == 0);
+
+	// The same text is not sent again
+	lcd_emu_reset_stats();
+	field.show("12.7 mm");
+	display_queue_wait();
+	TEST_CHECK(lcd_emu_stats()->commands == 0);
+}
+
+static void test_length_change(DISPLAY_ALIGN_MODE mode)
+{
+	reference(ERROR_LABEL, mode, 1);
+
+	screen_clear();
+	TextField field(FIELD_X, FIELD_Y, &u8g2_font_8x13_t_cyrillic, mode);
+	field.show(VALUE_LABEL);
+	field.show(ERROR_LABEL);
+	display_queue_wait();
+	TEST_CHECK(screen_differences() == 0);
+
+	reference(VALUE_LABEL, mode, 1);
+	field.show(VALUE_LABEL);
+	display_queue_wait();
+	TEST_CHECK(screen_differences() == 0);
+}
+
+static void test_forced_redraw()
+{
+	reference(ERROR_LABEL, DISPLAY_ALIGN_CENTER, 1);
+
+	screen_clear();
+	TextField field(FIELD_X, FIELD_Y, &u8g2_font_8x13_t_cyrillic);
+	field.show(ERROR_LABEL);
+
+	// The same text is sent again by setNeedUpdate
+	lcd_emu_reset_stats();
+	field.setNeedUpdate(true);
+	field.show(ERROR_LABEL);
+	display_queue_wait();
+	TEST_CHECK(lcd_emu_stats()->pixels == glyph_pixels(strlen(ERROR_LABEL), 1));
+
+	// The forced redraw of a shorter text clears the old one
+	field.show(VALUE_LABEL);
+	field.setNeedUpdate(true);
+	field.show(ERROR_LABEL);
+	display_queue_wait();
+	TEST_CHECK(screen_differences() == 0);
+}
+
+static void test_counters()
+{
+	display_init();
+	TextField field(FIELD_X, FIELD_Y, &u8g2_font_8x13_t_cyrillic);
+
+	// The counters of the previous tests are published and started again
+	test_millis += SECOND_MS;
+	field.show("");
+
+	field.show("1234");
+	field.show("1235");
+	field.show("1335");
+
+	test_millis += SECOND_MS;
+	field.show("1335");
+	TEST_CHECK(TextField::drawnPerSecond() == 6);
+	TEST_CHECK(TextField::skippedPerSecond() == 10);
+}
+
+
+int main()
+{
+	test_changed_cells(1);
+	test_changed_cells(2);
+	test_length_change(DISPLAY_ALIGN_CENTER);
+	test_length_change(DISPLAY_ALIGN_RIGHT);
+	test_length_change(DISPLAY_ALIGN_LEFT);
+	test_forced_redraw();
+	test_counters();
+	return TEST_RESULT();
+}
@@ -0,0 +1,152 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#include "TrendGraph.h"
+
+#include "glog.h"
+#include "gutils.h"
+
+
+TrendGraph::TrendGraph(const uint16_t y, const uint16_t height, const uint32_t periodMs):
+	y(y), height(height), periodTimer(periodMs), samples(), current(),
+	deadBand(0), propBand(0), scrollOffset(0), lastX(-1), needInit(true)
+{}
+
+void TrendGraph::setBands(uint16_t deadBand, uint16_t propBand)
+{
+	this->deadBand = deadBand;
+	this->propBand = propBand;
+}
+
+void TrendGraph::update(int16_t value, bool valveUp, bool valveDown)
+{
+	if (!(current.flags & SAMPLE_VALUE)) {
+		current.min = value;
+		current.max = value;
+	}
+	current.min = value < current.min ? value : current.min;
+	current.max = value > current.max ? value : current.max;
+	current.flags |= SAMPLE_VALUE;
+
+	updateValves(valveUp, valveDown);
+}
+
+void TrendGraph::updateValves(bool valveUp, bool valveDown)
+{
+	if (valveUp) {
+		current.flags |= SAMPLE_VALVE_UP;
+	}
+	if (valveDown) {
+		current.flags |= SAMPLE_VALVE_DOWN;
+	}
+}
+
+void TrendGraph::show()
+{
+	if (needInit) {
+		display_fill_rect(0, y, DISPLAY_WIDTH, height, DISPLAY_COLOR_WHITE);
+		periodTimer.start();
+		needInit = false;
+	}
+
+	if (!periodTimer.wait()) {
+		samples.push_back(current);
+		current = {};
+		periodTimer.start();
+	}
+
+	uint32_t pixels = 0;
+	while (!samples.empty() && pixels + DISPLAY_WIDTH <= PIXELS_BUDGET) {
+		drawRow(samples.pop_front());
+		pixels += DISPLAY_WIDTH;
+	}
+
+#if TREND_GRAPH_BEDUG
+	if (pixels) {
+		printTagLog(TAG, "rows pixels: %lu, scroll: %u", pixels, scrollOffset);
+	}
+#endif
+}
+
+void TrendGraph::reset()
+{
+	samples.clear();
+	current = {};
+	lastX = -1;
+	needInit = true;
+	if (scrollOffset) {
+		scrollTo(0);
+	}
+}
+
+uint16_t TrendGraph::valueX(int32_t value)
+{
+	int32_t range = (int32_t)(propBand ? propBand : deadBand) * 3 / 2;
+	int32_t half  = DISPLAY_WIDTH / 2 - MARK_WIDTH - TRACE_WIDTH;
+	if (range <= 0) {
+		range = 1;
+	}
+	int32_t x = DISPLAY_WIDTH / 2 + value * half / range;
+	if (x < MARK_WIDTH) {
+		x = MARK_WIDTH;
+	}
+	if (x > DISPLAY_WIDTH - MARK_WIDTH - TRACE_WIDTH) {
+		x = DISPLAY_WIDTH - MARK_WIDTH - TRACE_WIDTH;
+	}
+	return (uint16_t)x;
+}
+
+/* Draws the sample into the oldest row and scrolls it to the band bottom */
+void TrendGraph::drawRow(const sample_t& sample)
+{
+	uint16_t row = (uint16_t)(y + scrollOffset);
+
+	display_compose_begin(0, row, DISPLAY_WIDTH, 1);
+	display_compose_fill(0, row, DISPLAY_WIDTH, 1, DISPLAY_COLOR_WHITE);
+
+	uint16_t dead_left = valueX(-(int32_t)deadBand);
+	display_compose_fill(
+		dead_left,
+		row,
+		(uint16_t)(valueX(deadBand) - dead_left + TRACE_WIDTH),
+		1,
+		DISPLAY_COLOR_LIGHT_GRAY
+	);
+	if (propBand) {
+		display_compose_fill(valueX(-(int32_t)propBand), row, 1, 1, DISPLAY_COLOR_GRAY);
+		display_compose_fill((uint16_t)(valueX(propBand) + TRACE_WIDTH - 1), row, 1, 1, DISPLAY_COLOR_GRAY);
+	}
+
+	if (sample.flags & SAMPLE_VALUE) {
+		uint16_t left  = valueX(sample.min);
+		uint16_t right = valueX(sample.max);
+		if (lastX >= 0) {
+			left  = lastX < left ? (uint16_t)lastX : left;
+			right = lastX > right ? (uint16_t)lastX : right;
+		}
+		display_compose_fill(left, row, (uint16_t)(right - left + TRACE_WIDTH), 1, DISPLAY_COLOR_BLACK);
+		lastX = (int16_t)valueX(((int32_t)sample.min + sample.max) / 2);
+	} else {
+		lastX = -1;
+	}
+
+	if (sample.flags & SAMPLE_VALVE_UP) {
+		display_compose_fill(0, row, MARK_WIDTH, 1, DISPLAY_COLOR_RED);
+	}
+	if (sample.flags & SAMPLE_VALVE_DOWN) {
+		display_compose_fill(DISPLAY_WIDTH - MARK_WIDTH, row, MARK_WIDTH, 1, DISPLAY_COLOR_RED);
+	}
+
+	display_compose_end();
+
+	scrollTo((uint16_t)((scrollOffset + 1) % height));
+}
+
+void TrendGraph::scrollTo(uint16_t offset)
+{
+	scrollOffset = offset;
+	display_scroll(
+		(int16_t)(0 - scrollOffset),
+		y,
+		(uint16_t)(DISPLAY_HEIGHT - y - height)
+	);
+}
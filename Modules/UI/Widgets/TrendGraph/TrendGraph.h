@@ -0,0 +1,84 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#ifndef _TREND_GRAPH_H_
+#define _TREND_GRAPH_H_
+
+
+#include <cstdint>
+
+#include "Timer.h"
+#include "display.h"
+#include "CircleBuffer.h"
+
+
+#define TREND_GRAPH_BEDUG (false)
+
+
+/*
+ * Strip chart of the sensor deviation over the display width band.
+ * Every period adds one display row at the bottom of the band:
+ * the dead band area, the proportional band limits, the deviation trace
+ * (min..max of the period) and the valve up (left) / down (right) marks.
+ * The band is scrolled by the display vertical scrolling,
+ * so a new row costs one DISPLAY_WIDTH line instead of a repaint.
+ */
+struct TrendGraph
+{
+private:
+	static constexpr char TAG[] = "TRND";
+
+	static const unsigned SAMPLES_SIZE = 8;
+	// Rows drawn by one show() call
+	static const uint32_t PIXELS_BUDGET = 2 * DISPLAY_WIDTH;
+
+	static const uint16_t MARK_WIDTH  = 4;
+	static const uint16_t TRACE_WIDTH = 2;
+
+	enum SAMPLE_FLAG {
+		SAMPLE_VALUE      = 0x01,
+		SAMPLE_VALVE_UP   = 0x02,
+		SAMPLE_VALVE_DOWN = 0x04,
+	};
+
+	struct sample_t
+	{
+		int16_t min;
+		int16_t max;
+		uint8_t flags;
+	};
+
+	uint16_t y;
+	uint16_t height;
+
+	utl::Timer periodTimer;
+	utl::circle_buffer<SAMPLES_SIZE, sample_t> samples;
+	sample_t current;
+
+	uint16_t deadBand;
+	uint16_t propBand;
+
+	uint16_t scrollOffset;
+	int16_t lastX;
+
+	bool needInit;
+
+	uint16_t valueX(int32_t value);
+	void drawRow(const sample_t& sample);
+	void scrollTo(uint16_t offset);
+
+public:
+	TrendGraph(const uint16_t y, const uint16_t height, const uint32_t periodMs);
+
+	void setBands(uint16_t deadBand, uint16_t propBand);
+	// Adds the sensor deviation and the valves state to the current period
+	void update(int16_t value, bool valveUp, bool valveDown);
+	// Adds the valves state only (no sensor value)
+	void updateValves(bool valveUp, bool valveDown);
+	void show();
+	// Clears the samples and returns the display scrolling to the start
+	void reset();
+
+};
+
+
+#endif
@@ -0,0 +1,101 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * TrendGraph render test on lcd_emu: every period the visible band is
+ * the previous one moved up by one row and a frame writes one row
+ */
+
+#include <cstdio>
+#include <cstring>
+
+#include "test.h"
+#include "gtime.h"
+#include "display.h"
+#include "lcd_emu.h"
+#include "TrendGraph.h"
+
+
+static const uint16_t TREND_Y      = DISPLAY_HEADER_HEIGHT + 24;
+static const uint16_t TREND_HEIGHT = 52;
+static const uint32_t PERIOD_MS    = 60 * 1000 / TREND_HEIGHT;
+static const unsigned FRAMES       = 300;
+
+static uint16_t band[TREND_HEIGHT][DISPLAY_WIDTH];
+
+
+static void band_save()
+{
+	for (uint16_t row = 0; row < TREND_HEIGHT; row++) {
+		for (uint16_t x = 0; x < DISPLAY_WIDTH; x++) {
+			band[row][x] = lcd_emu_pixel(x, (uint16_t)(TREND_Y + row));
+		}
+	}
+}
+
+static bool band_shifted()
+{
+	for (uint16_t row = 0; row + 1 < TREND_HEIGHT; row++) {
+		for (uint16_t x = 0; x < DISPLAY_WIDTH; x++) {
+			if (band[row + 1][x] != lcd_emu_pixel(x, (uint16_t)(TREND_Y + row))) {
+				printf("row %u x %u is not shifted\n", row, x);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static unsigned row_count(uint16_t row, uint16_t color)
+{
+	unsigned count = 0;
+	for (uint16_t x = 0; x < DISPLAY_WIDTH; x++) {
+		count += lcd_emu_pixel(x, (uint16_t)(TREND_Y + row)) == color;
+	}
+	return count;
+}
+
+static void test_scroll()
+{
+	display_init();
+	test_millis = 0;
+
+	TrendGraph trend(TREND_Y, TREND_HEIGHT, PERIOD_MS);
+	trend.setBands(50, 150);
+	trend.show();
+
+	uint32_t pixels_max = 0;
+	for (unsigned frame = 0; frame < FRAMES; frame++) {
+		band_save();
+
+		int16_t value = (int16_t)((int)(frame % 40) * 10 - 200);
+		trend.update(value, value < -50, value > 50);
+		test_millis += PERIOD_MS;
+
+		lcd_emu_reset_stats();
+		trend.show();
+		if (lcd_emu_stats()->pixels > pixels_max) {
+			pixels_max = lcd_emu_stats()->pixels;
+		}
+
+		if (!band_shifted()) {
+			TEST_CHECK(false);
+			break;
+		}
+
+		/* The new row: the dead band area, the trace and one valve mark at most */
+		uint16_t bottom = TREND_HEIGHT - 1;
+		TEST_CHECK(row_count(bottom, DISPLAY_COLOR_BLACK) >= 2);
+		TEST_CHECK(row_count(bottom, DISPLAY_COLOR_RED) <= 4);
+	}
+	printf("%u frames: %u pixels per frame max\n", FRAMES, pixels_max);
+	TEST_CHECK(pixels_max <= DISPLAY_WIDTH);
+
+	trend.reset();
+}
+
+
+int main()
+{
+	test_scroll();
+	return TEST_RESULT();
+}
@@ -0,0 +1,47 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#include "fonts.h"
+
+
+/**
+  * @brief  Reads one line of the character glyph.
+  *         The line is loaded by whole bytes (up to 4 for FONT_WIDTH_MAX),
+  *         so the renderer tests the bits of a register instead of the table bytes.
+  * @param  font: Font
+  * @param  Ascii: Character code
+  * @param  line: Glyph line (0..Height-1)
+  * @retval Line bits, the left pixel is the bit (Width - 1), 0 for the blank lines,
+  *         the lines out of the glyph and the characters that are not in the font
+  */
+uint32_t FONT_GetGlyphLine(const sFONT *font, uint8_t Ascii, uint32_t line)
+{
+  uint32_t bit_num;
+
+  if(Ascii < ' ' || font->Width > FONT_WIDTH_MAX || line >= font->Height)
+    return 0;
+
+  if(font->map)
+  {
+    uint8_t index = font->map[Ascii - ' '];
+    if(index == FONT_NO_GLYPH || index >= font->count)
+      return 0;
+
+    const sGLYPH *glyph = &font->glyphs[index];
+    if(line < glyph->top || line >= (uint32_t)glyph->top + glyph->rows)
+      return 0;
+    bit_num = ((uint32_t)glyph->offset << 3) + (line - glyph->top) * font->Width;
+  }
+  else
+  {
+    bit_num = ((uint32_t)(Ascii - ' ') * font->Height + line) * font->Width;
+  }
+
+  const uint8_t *data = &font->table[bit_num >> 3];
+  uint32_t shift = bit_num & 0x07;
+  uint32_t bytes = (shift + font->Width + 7) >> 3;
+  uint32_t value = 0;
+  for(uint32_t i = 0; i < bytes; i++)
+    value = (value << 8) | data[i];
+
+  return (value >> ((bytes << 3) - shift - font->Width)) & ((1UL << font->Width) - 1);
+}
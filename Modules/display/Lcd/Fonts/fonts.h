@@ -65,18 +65,25 @@
 /** @defgroup FONTS_Exported_Types
   * @{
   */ 
+typedef struct _tGlyph
+{
+  const uint16_t offset; /* First byte of the glyph in the font table */
+  const uint8_t  top;    /* First not blank line */
+  const uint8_t  rows;   /* Stored lines count */
+} sGLYPH;
+
 typedef struct _tFont
 {    
   const uint8_t *table;
   const uint16_t Width;
   const uint16_t Height;
+  /* Subset fonts (tools/font_converter.py): glyph index of (Ascii - ' ') or FONT_NO_GLYPH.
+     Fonts without the map store all the glyphs from ' ' as one bit stream */
+  const uint8_t *map;
+  const sGLYPH  *glyphs;
+  const uint16_t count;  /* Glyphs count of the map */
 } sFONT;
 
-extern sFONT Font24;
-extern sFONT Font20;
-extern sFONT Font16;
-extern sFONT Font12;
-extern sFONT Font8;
 extern sFONT u8g2_font_8x13_t_cyrillic;
 extern sFONT u8g2_font_10x20_t_cyrillic;
 /**
@@ -88,6 +95,9 @@ extern sFONT u8g2_font_10x20_t_cyrillic;
   */ 
 #define LINE(x) ((x) * (((sFONT *)BSP_LCD_GetFont())->Height))
 
+#define FONT_NO_GLYPH     ((uint8_t)0xFF)
+#define FONT_WIDTH_MAX    (25)
+
 /**
   * @}
   */ 
@@ -102,6 +112,7 @@ extern sFONT u8g2_font_10x20_t_cyrillic;
 /** @defgroup FONTS_Exported_Functions
   * @{
   */ 
+uint32_t FONT_GetGlyphLine(const sFONT *font, uint8_t Ascii, uint32_t line);
 /**
   * @}
   */
@@ -1,574 +1,362 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/* Generated by tools/font_converter.py from fonts/u8g2_font_10x20_t_cyrillic.pbm */
+
 #include "fonts.h"
 
 
-const uint8_t u8g2_font_10x20_t_cyrillic_table[] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
-    0x60, 0x18, 0x00, 0x01, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x66, 0x19, 0x82, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0x06, 0xC1, 0xB1, 0xFE, 0x36, 0x0D, 0x83, 0x63,
-    0xFC, 0x6C, 0x1B, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x7E, 0x36, 0xCD, 0x83,
-    0x60, 0xD8, 0x1F, 0x81, 0xB0, 0x6C, 0x1B, 0x36, 0xC7, 0xE0,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x73, 0x36, 0xCD, 0xE1, 0xD8, 0x0C, 0x03, 0x01, 0x80,
-    0x60, 0x37, 0x0F, 0x66, 0xD9, 0x9C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x6C, 0x1B, 0x06, 0xC1,
-    0xE0, 0x30, 0x1C, 0x0D, 0x83, 0x36, 0xC7, 0x31, 0x8E, 0xF1,
-    0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x18, 0x06, 0x01, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x06, 0x01, 0x80,
-    0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x18, 0x06, 0x00, 0xC0,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x30, 0x06, 0x01, 0x80, 0x30, 0x0C, 0x03, 0x00, 0xC0,
-    0x30, 0x18, 0x06, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61,
-    0x98, 0x3C, 0x3F, 0xC3, 0xC1, 0x98, 0x66, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x60, 0x18, 0x3F, 0xC1, 0x80,
-    0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0,
-    0x70, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xC0,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0xC0, 0x60, 0x18, 0x0C, 0x03, 0x01, 0x80,
-    0x60, 0x30, 0x0C, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x3C, 0x19, 0x86, 0x63,
-    0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0x66, 0x19, 0x83, 0xC0,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x38, 0x1E, 0x0D, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
-    0x60, 0x18, 0x06, 0x01, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x66, 0x30, 0xCC, 0x30,
-    0x0C, 0x03, 0x01, 0x81, 0xC0, 0xC0, 0x60, 0x30, 0x0C, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x66, 0x30, 0xCC, 0x30, 0x0C, 0x06, 0x07, 0x00, 0x60,
-    0x0C, 0xC3, 0x30, 0xC6, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x06, 0x03, 0x81, 0xE0,
-    0xD8, 0x66, 0x31, 0x8C, 0x63, 0xFC, 0x06, 0x01, 0x80, 0x60,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xDC, 0x39, 0x80, 0x30,
-    0x0C, 0x03, 0x30, 0xC6, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x66, 0x30, 0x8C, 0x03,
-    0x00, 0xDC, 0x39, 0x8C, 0x33, 0x0C, 0xC3, 0x30, 0xC6, 0x60,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x03, 0x00, 0xC0, 0x60, 0x18, 0x0C, 0x03, 0x01, 0x80,
-    0x60, 0x30, 0x0C, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x66, 0x30, 0xCC, 0x33,
-    0x0C, 0x66, 0x0F, 0x06, 0x63, 0x0C, 0xC3, 0x30, 0xC6, 0x60,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x66, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x19, 0xC3, 0xB0,
-    0x0C, 0x03, 0x10, 0xC6, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xC0, 0x70, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x06, 0x03, 0x01, 0x80,
-    0xC0, 0x60, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x60, 0x0C, 0x01, 0x80,
-    0x30, 0x06, 0x00, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x66, 0x30, 0xCC, 0x33, 0x0C, 0x06, 0x03, 0x01, 0x80,
-    0x60, 0x18, 0x00, 0x01, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x66, 0x30, 0xCC, 0xF3,
-    0x7C, 0xDB, 0x36, 0xCD, 0xB3, 0x78, 0xCC, 0x30, 0x06, 0x30,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x3C, 0x19, 0x86, 0x63, 0x0C, 0xC3, 0x30, 0xCF, 0xF3,
-    0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xCC, 0x31, 0x8C, 0x63,
-    0x18, 0xCC, 0x3F, 0x0C, 0x63, 0x0C, 0xC3, 0x30, 0xCC, 0x63,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x66, 0x30, 0xCC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
-    0x00, 0xC0, 0x30, 0xC6, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xC6, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x63,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x3F, 0x0C, 0x03,
-    0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xC0, 0x30, 0x0C, 0x03,
-    0x00, 0xC0, 0x3F, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x66, 0x30, 0xCC, 0x03, 0x00, 0xC0, 0x33, 0xCC, 0x33,
-    0x0C, 0xC3, 0x30, 0xC6, 0x70, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x3F, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
-    0x60, 0x18, 0x06, 0x01, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x06, 0x01, 0x80, 0x60,
-    0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0xC6, 0x31, 0x86, 0xC0,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x0C, 0xC3, 0x31, 0x8C, 0x63, 0x30, 0xCC, 0x3E, 0x0C, 0xC3,
-    0x30, 0xC6, 0x31, 0x8C, 0x33, 0x0C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
-    0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x0C, 0xC3, 0x39, 0xCE, 0x73, 0xFC, 0xDB, 0x36, 0xCD, 0xB3,
-    0x6C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0xE3, 0x38, 0xCF, 0x33,
-    0xCC, 0xDB, 0x36, 0xCC, 0xF3, 0x3C, 0xC7, 0x31, 0xCC, 0x33,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x66, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x30, 0xC6, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xC6, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x31, 0x8F, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x66, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0xDB, 0x33, 0xC6, 0x60, 0xF8, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xC6, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x31, 0x8F, 0xC3, 0x30, 0xC6, 0x31, 0x8C, 0x33,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x66, 0x30, 0xCC, 0x03, 0x00, 0x60, 0x0F, 0x00, 0x60,
-    0x0C, 0x03, 0x30, 0xC6, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x18, 0x06, 0x01, 0x80,
-    0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x30, 0xC6, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0xC3, 0x30, 0xCC, 0x31,
-    0x98, 0x66, 0x19, 0x83, 0xC0, 0xF0, 0x3C, 0x06, 0x01, 0x80,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xDB, 0x36, 0xCD, 0xB3,
-    0x6C, 0xE7, 0x39, 0xCC, 0x33, 0x0C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0xC3, 0x19, 0x86, 0x60,
-    0xF0, 0x3C, 0x06, 0x03, 0xC0, 0xF0, 0x66, 0x19, 0x8C, 0x33,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x0C, 0xC3, 0x19, 0x86, 0x60, 0xF0, 0x3C, 0x06, 0x01, 0x80,
-    0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x03, 0x00, 0xC0, 0x60,
-    0x30, 0x0C, 0x06, 0x03, 0x00, 0xC0, 0x60, 0x30, 0x0C, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
-    0x80, 0x60, 0x18, 0x06, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x03, 0x00,
-    0xC0, 0x18, 0x06, 0x00, 0xC0, 0x30, 0x06, 0x01, 0x80, 0x30,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
-    0x18, 0x06, 0x01, 0x80, 0x61, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x3C, 0x19, 0x8C, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x18, 0xC0, 0x31,
-    0xFC, 0xC3, 0x30, 0xCC, 0x31, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
-    0x00, 0xDC, 0x39, 0x8C, 0x33, 0x0C, 0xC3, 0x30, 0xCE, 0x63,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x18, 0xCC, 0x03,
-    0x00, 0xC0, 0x30, 0x06, 0x30, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x03, 0x00, 0xC0, 0x30,
-    0x0C, 0x3B, 0x19, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xC6, 0x70,
-    0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x19, 0x8C, 0x33,
-    0xFC, 0xC0, 0x30, 0x06, 0x30, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x33, 0x0C, 0xC3, 0x00,
-    0xC0, 0xFC, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x31, 0xCC, 0x63,
-    0x18, 0xC6, 0x1F, 0x0C, 0x01, 0xF8, 0xC3, 0x30, 0xCC, 0x31,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
-    0x00, 0xDC, 0x39, 0x8C, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x01, 0x80, 0x00, 0x78, 0x06, 0x01, 0x80,
-    0x60, 0x18, 0x06, 0x01, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x30,
-    0x00, 0x0F, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30,
-    0x0C, 0x63, 0x18, 0xC6, 0x30, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC6, 0x33, 0x0D, 0x83,
-    0xC0, 0xF8, 0x33, 0x0C, 0x63, 0x0C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x18, 0x06, 0x01, 0x80,
-    0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x83,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x3F, 0xCD, 0xB3,
-    0x6C, 0xDB, 0x36, 0xCD, 0xB3, 0x6C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xDC, 0x39, 0x8C, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x19, 0x8C, 0x33,
-    0x0C, 0xC3, 0x30, 0xC6, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xDC, 0x39, 0x8C, 0x33, 0x0C, 0xC3, 0x30, 0xCE, 0x63,
-    0x70, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x19, 0xCC, 0x33,
-    0x0C, 0xC3, 0x30, 0xC6, 0x70, 0xEC, 0x03, 0x00, 0xC0, 0x30,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xDE, 0x1C, 0xC6, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x30, 0xCC, 0x01,
-    0xF8, 0x03, 0x00, 0xCC, 0x31, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x03, 0x00,
-    0xC0, 0xFC, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x30,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x30, 0xC6, 0x70, 0xEC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xC3, 0x30, 0xC6, 0x61, 0x98, 0x3C, 0x0F, 0x01, 0x80,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x30, 0xCC, 0x33,
-    0x6C, 0xDB, 0x36, 0xCF, 0xF1, 0x98, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xC3, 0x19, 0x83, 0xC0, 0x60, 0x18, 0x0F, 0x06, 0x63,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x30, 0xC6, 0x70, 0xEC, 0x03, 0x30, 0xC6, 0x60,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x3C, 0x01, 0x80,
-    0x60, 0x18, 0x06, 0x01, 0x80, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x06, 0x01, 0x80,
-    0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x03, 0xC1, 0x80,
-    0x60, 0x18, 0x06, 0x01, 0x83, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xCC, 0xDB, 0x33, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x70, 0x06, 0x00, 0x03, 0xFC, 0xC0, 0x30, 0x0C, 0x03,
-    0x00, 0xC0, 0x3F, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x19, 0x80, 0x03,
-    0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x3F, 0x0C, 0x03,
-    0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x30, 0x0C, 0x03, 0x00,
-    0xF8, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30,
-    0xCC, 0x03, 0x01, 0x80, 0x00, 0x00, 0x1C, 0x0C, 0x00, 0x03,
-    0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
-    0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x66, 0x30, 0xCC, 0x03,
-    0x00, 0xC0, 0x3F, 0x8C, 0x03, 0x00, 0xC0, 0x30, 0xC6, 0x60,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x66, 0x30, 0xCC, 0x03, 0x00, 0x60, 0x0F, 0x00, 0x60,
-    0x0C, 0x03, 0x30, 0xC6, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x18, 0x06, 0x01, 0x80,
-    0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x83,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x19, 0x80, 0x03,
-    0xFC, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
-    0x60, 0x18, 0x06, 0x01, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x03, 0x00, 0xC0, 0x30,
-    0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0xC3, 0x30, 0xC6, 0x60,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0xD8, 0x36, 0x0D, 0x83, 0x60, 0xDE, 0x36, 0x8D, 0xB3,
-    0x6C, 0xDB, 0x36, 0xCD, 0xA2, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x60, 0xD8, 0x36, 0x0D, 0x83,
-    0x60, 0xD8, 0x3F, 0x8D, 0xA3, 0x6C, 0xDB, 0x36, 0xCD, 0xA3,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x30, 0x0C, 0x03, 0x00, 0xD8, 0x3B, 0x0C, 0xC3, 0x30,
-    0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x03, 0x01, 0x83, 0x0C, 0xC3, 0x31, 0x8C, 0x63,
-    0x30, 0xCC, 0x3E, 0x0C, 0xC3, 0x30, 0xC6, 0x31, 0x8C, 0x33,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0xC3,
-    0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x1C, 0xCF, 0x37, 0xCF, 0xB3,
-    0xCC, 0xE3, 0x30, 0xCC, 0x33, 0x0C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x66, 0x0F, 0x00, 0x03, 0x0C, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x1F, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xCC, 0x31,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x30, 0xCC, 0x33, 0xFC, 0x18, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0xF0, 0x66, 0x19, 0x8C, 0x33,
-    0x0C, 0xC3, 0x3F, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE3,
-    0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFC, 0x31, 0x8C, 0x33,
-    0x0C, 0xC3, 0x31, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x83, 0x30, 0xC6, 0x31, 0x8C, 0x63,
-    0x30, 0xFC, 0x31, 0x8C, 0x33, 0x0C, 0xC3, 0x31, 0x8F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF3,
-    0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
-    0x00, 0xC0, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xE0, 0xD8, 0x66, 0x19, 0x86, 0x61,
-    0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x8F, 0xF3,
-    0x0C, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF3,
-    0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFC, 0x30, 0x0C, 0x03,
-    0x00, 0xC0, 0x30, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0D, 0xB3, 0x6C, 0xDB, 0x36, 0xCD, 0xB1,
-    0xF8, 0x3C, 0x1F, 0x8D, 0xB3, 0x6C, 0xDB, 0x36, 0xCD, 0xB0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1,
-    0x98, 0xC3, 0x30, 0xC0, 0x30, 0x18, 0x1C, 0x01, 0x80, 0x33,
-    0x0C, 0xC3, 0x19, 0x83, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0C, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x73,
-    0x3C, 0xDF, 0x3E, 0xCF, 0x33, 0x8C, 0xC3, 0x30, 0xCC, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0C, 0x33,
-    0x0C, 0xC3, 0x30, 0xCC, 0x73, 0x3C, 0xDF, 0x3E, 0xCF, 0x33,
-    0x8C, 0xC3, 0x30, 0xCC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0C, 0x33, 0x0C, 0xC6, 0x31, 0x8C, 0xC3,
-    0x30, 0xF8, 0x33, 0x0C, 0xC3, 0x18, 0xC6, 0x30, 0xCC, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0xCC, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31,
-    0x8C, 0x63, 0x38, 0xCC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0C, 0x33, 0x0C, 0xE7, 0x39, 0xCF, 0xF3,
-    0x6C, 0xDB, 0x36, 0xCD, 0xB3, 0x0C, 0xC3, 0x30, 0xCC, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x33,
-    0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xFF, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x30, 0xCC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC1, 0x98, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x19, 0x83, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF3,
-    0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x30, 0xCC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC3, 0x18, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0xC6, 0x3F, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1,
-    0x98, 0xC3, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
-    0x00, 0xC3, 0x19, 0x83, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x60, 0x18, 0x06, 0x01, 0x80,
-    0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x33,
-    0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0x7F, 0x00, 0xC0, 0x30,
-    0x0C, 0x03, 0x30, 0xC7, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x81, 0xF8, 0xDB, 0x36, 0xCD, 0xB3,
-    0x6C, 0xDB, 0x36, 0xCD, 0xB3, 0x6C, 0x7E, 0x06, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x33,
-    0x0C, 0x66, 0x19, 0x83, 0xC0, 0xF0, 0x18, 0x0F, 0x03, 0xC1,
-    0x98, 0x66, 0x30, 0xCC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0C, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCF, 0xF8,
-    0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x33,
-    0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x1F, 0xC0, 0x30,
-    0x0C, 0x03, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0D, 0xB3, 0x6C, 0xDB, 0x36, 0xCD, 0xB3,
-    0x6C, 0xDB, 0x36, 0xCD, 0xB3, 0x6C, 0xDB, 0x36, 0xCF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xB3,
-    0x6C, 0xDB, 0x36, 0xCD, 0xB3, 0x6C, 0xDB, 0x36, 0xCD, 0xB3,
-    0x6C, 0xDB, 0x36, 0xCF, 0xF8, 0x06, 0x01, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x02, 0xC0, 0x30, 0x0C, 0x03, 0x00,
-    0xF8, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x33,
-    0x0C, 0xC3, 0x30, 0xCC, 0x33, 0xCC, 0xDB, 0x36, 0xCD, 0xB3,
-    0x6C, 0xDB, 0x36, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
-    0xF0, 0xC6, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x31, 0x8F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1,
-    0x98, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x7F, 0x00, 0xC0, 0x30,
-    0x0C, 0xC3, 0x19, 0x83, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0C, 0xE3, 0x6C, 0xDB, 0x36, 0xCD, 0xB3,
-    0x6C, 0xFB, 0x36, 0xCD, 0xB3, 0x6C, 0xDB, 0x36, 0xCC, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF1,
-    0x8C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0x63, 0x0F, 0xC3, 0x31,
-    0x8C, 0x63, 0x30, 0xCC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x63, 0x00, 0xC7, 0xF3, 0x0C, 0xC3, 0x30, 0xC7, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x7C, 0x30, 0x0C, 0x01, 0xF0, 0xE6, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x19, 0x83, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0xC6, 0x31, 0x8F, 0xE3, 0x0C, 0xC3, 0x30, 0xCF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xC0, 0x30, 0x0C, 0x03,
-    0x00, 0xC0, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x36, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x8F, 0xF3,
-    0x0C, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x66, 0x30, 0xCF, 0xF3,
-    0x00, 0xC0, 0x18, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x6C, 0xDB, 0x36, 0xC7, 0xE1, 0xF8, 0xDB, 0x36, 0xCD, 0xB0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xC3, 0x00, 0xC3, 0xE0,
-    0x18, 0x03, 0x30, 0xC7, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x0C, 0xC3, 0x31, 0xCC, 0xF3, 0x6C, 0xF3, 0x38, 0xCC, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x66, 0x0F, 0x00, 0x03, 0x0C, 0xC3, 0x31, 0xCC, 0xF3,
-    0x6C, 0xF3, 0x38, 0xCC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x0C, 0xC6, 0x33, 0x0F, 0x83, 0xE0, 0xCC, 0x31, 0x8C, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x33, 0x18, 0xC6, 0x31,
-    0x8C, 0x63, 0x18, 0xCC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x0C, 0xE7, 0x3F, 0xCD, 0xB3, 0x6C, 0xDB, 0x30, 0xCC, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0xC3, 0x30, 0xCF, 0xF3,
-    0x0C, 0xC3, 0x30, 0xCC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x66, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x19, 0x83, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x30, 0xCC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x70, 0xE6, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x39, 0x8D, 0xC3,
-    0x00, 0xC0, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x63, 0x30, 0x0C, 0x03,
-    0x00, 0xC0, 0x18, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0xC3, 0x30, 0xCC, 0x33,
-    0x0C, 0xC3, 0x19, 0xC3, 0xB0, 0x0C, 0xC3, 0x19, 0x83, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x81,
-    0xF8, 0xDB, 0x36, 0xCD, 0xB3, 0x6C, 0xDB, 0x36, 0xC7, 0xE0,
-    0x60, 0x18, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x66, 0x0F, 0x01, 0x80,
-    0x60, 0x3C, 0x19, 0x8C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8F, 0xF0,
-    0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0xC3, 0x30, 0xCC, 0x31,
-    0xFC, 0x03, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x6C, 0xDB, 0x36, 0xCD, 0xB3, 0x6C, 0xDB, 0x36, 0xCF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x6C, 0xDB, 0x36, 0xCD, 0xB3,
-    0x6C, 0xDB, 0x36, 0xCF, 0xF8, 0x06, 0x01, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0xE0, 0x3F, 0x86, 0x31, 0x8C, 0x63, 0x18, 0xC7, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0xC3, 0x3C, 0xCD, 0xB3,
-    0x6C, 0xDB, 0x36, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0xC0, 0x30, 0x0F, 0xE3, 0x0C, 0xC3, 0x30, 0xCF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xC3, 0x00, 0xC0, 0x30,
-    0x7C, 0x03, 0x30, 0xC7, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x38, 0xDB, 0x36, 0xCF, 0xB3, 0x6C, 0xDB, 0x36, 0xCC, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0xC3, 0x30, 0xCC, 0x31,
-    0xFC, 0x33, 0x18, 0xCC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00
+static const uint8_t u8g2_font_10x20_t_cyrillic_table[] = {
+	0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+	0x00, 0x00, 0x60, 0x18, 0x00, 0x66, 0x19, 0x86, 0x60, 0x90, 0x1B, 0x06,
+	0xC1, 0xB1, 0xFE, 0x36, 0x0D, 0x83, 0x63, 0xFC, 0x6C, 0x1B, 0x06, 0xC0,
+	0x18, 0x1F, 0x8D, 0xB3, 0x60, 0xD8, 0x36, 0x07, 0xE0, 0x6C, 0x1B, 0x06,
+	0xCD, 0xB1, 0xF8, 0x18, 0x00, 0x73, 0x36, 0xCD, 0xE1, 0xD8, 0x0C, 0x03,
+	0x01, 0x80, 0x60, 0x37, 0x0F, 0x66, 0xD9, 0x9C, 0x38, 0x1B, 0x06, 0xC1,
+	0xB0, 0x78, 0x0C, 0x07, 0x03, 0x60, 0xCD, 0xB1, 0xCC, 0x63, 0xBC, 0x79,
+	0x80, 0x18, 0x06, 0x01, 0x80, 0x60, 0x10, 0x00, 0x06, 0x03, 0x01, 0x80,
+	0x60, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x06, 0x01, 0x80, 0x30, 0x06,
+	0x00, 0x60, 0x0C, 0x01, 0x80, 0x60, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C,
+	0x06, 0x01, 0x80, 0xC0, 0x60, 0x00, 0x66, 0x19, 0x83, 0xC3, 0xFC, 0x3C,
+	0x19, 0x86, 0x60, 0x18, 0x06, 0x01, 0x83, 0xFC, 0x18, 0x06, 0x01, 0x80,
+	0x1C, 0x07, 0x03, 0x80, 0xFF, 0x00, 0x1C, 0x07, 0x01, 0xC0, 0x03, 0x00,
+	0xC0, 0x60, 0x18, 0x0C, 0x03, 0x01, 0x80, 0x60, 0x30, 0x0C, 0x06, 0x01,
+	0x80, 0x18, 0x0F, 0x06, 0x61, 0x98, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3,
+	0x19, 0x86, 0x60, 0xF0, 0x18, 0x00, 0x18, 0x0E, 0x07, 0x83, 0x60, 0x18,
+	0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0xFF, 0x00, 0x3C,
+	0x19, 0x8C, 0x33, 0x0C, 0x03, 0x00, 0xC0, 0x60, 0x70, 0x30, 0x18, 0x0C,
+	0x03, 0x00, 0xFF, 0x00, 0x3C, 0x19, 0x8C, 0x33, 0x0C, 0x03, 0x01, 0x81,
+	0xC0, 0x18, 0x03, 0x30, 0xCC, 0x31, 0x98, 0x3C, 0x00, 0x02, 0x01, 0x80,
+	0xE0, 0x78, 0x36, 0x19, 0x8C, 0x63, 0x18, 0xFF, 0x01, 0x80, 0x60, 0x18,
+	0x06, 0x00, 0xFF, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x37, 0x0E, 0x60, 0x0C,
+	0x03, 0x00, 0xCC, 0x31, 0x98, 0x3C, 0x00, 0x3C, 0x19, 0x8C, 0x23, 0x00,
+	0xC0, 0x37, 0x0E, 0x63, 0x0C, 0xC3, 0x30, 0xCC, 0x31, 0x98, 0x3C, 0x00,
+	0xFF, 0x00, 0xC0, 0x30, 0x18, 0x06, 0x03, 0x00, 0xC0, 0x60, 0x18, 0x0C,
+	0x03, 0x01, 0x80, 0x60, 0x00, 0x3C, 0x19, 0x8C, 0x33, 0x0C, 0xC3, 0x19,
+	0x83, 0xC1, 0x98, 0xC3, 0x30, 0xCC, 0x31, 0x98, 0x3C, 0x00, 0x3C, 0x19,
+	0x8C, 0x33, 0x0C, 0xC3, 0x30, 0xC6, 0x70, 0xEC, 0x03, 0x00, 0xC4, 0x31,
+	0x98, 0x3C, 0x00, 0x1C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0,
+	0x70, 0x1C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x70, 0x38,
+	0x00, 0x02, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x01, 0x80, 0x30,
+	0x06, 0x00, 0xC0, 0x18, 0x02, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3F, 0xC0, 0x40, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x18,
+	0x0C, 0x06, 0x03, 0x01, 0x80, 0x40, 0x00, 0x3C, 0x19, 0x8C, 0x33, 0x0C,
+	0xC3, 0x01, 0x80, 0xC0, 0x60, 0x18, 0x06, 0x00, 0x00, 0x60, 0x18, 0x00,
+	0x3C, 0x19, 0x8C, 0x33, 0x3C, 0xDF, 0x36, 0xCD, 0xB3, 0x6C, 0xDE, 0x33,
+	0x0C, 0x01, 0x8C, 0x3E, 0x00, 0x18, 0x0F, 0x06, 0x61, 0x98, 0xC3, 0x30,
+	0xCC, 0x33, 0xFC, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x00, 0xF8, 0x33,
+	0x0C, 0x63, 0x18, 0xC6, 0x33, 0x0F, 0xC3, 0x18, 0xC3, 0x30, 0xCC, 0x33,
+	0x18, 0xFC, 0x00, 0x3C, 0x19, 0x8C, 0x33, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+	0x00, 0xC0, 0x30, 0x0C, 0x31, 0x98, 0x3C, 0x00, 0xFC, 0x31, 0x8C, 0x33,
+	0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x18, 0xFC,
+	0x00, 0xFF, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0F, 0xC3, 0x00, 0xC0,
+	0x30, 0x0C, 0x03, 0x00, 0xFF, 0x00, 0xFF, 0x30, 0x0C, 0x03, 0x00, 0xC0,
+	0x30, 0x0F, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x00, 0x3C,
+	0x19, 0x8C, 0x33, 0x00, 0xC0, 0x30, 0x0C, 0xF3, 0x0C, 0xC3, 0x30, 0xCC,
+	0x31, 0x9C, 0x3D, 0x00, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCF,
+	0xF3, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x00, 0xFF, 0x06, 0x01,
+	0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+	0xFF, 0x00, 0x1F, 0x81, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+	0x06, 0x31, 0x8C, 0x61, 0xB0, 0x38, 0x00, 0xC3, 0x30, 0xCC, 0x63, 0x18,
+	0xCC, 0x33, 0x0F, 0x83, 0x30, 0xCC, 0x31, 0x8C, 0x63, 0x0C, 0xC3, 0x00,
+	0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30,
+	0x0C, 0x03, 0x00, 0xFF, 0x00, 0xC3, 0x30, 0xCE, 0x73, 0x9C, 0xFF, 0x36,
+	0xCD, 0xB3, 0x6C, 0xDB, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x00, 0xC3, 0x38,
+	0xCE, 0x33, 0xCC, 0xF3, 0x36, 0xCD, 0xB3, 0x3C, 0xCF, 0x31, 0xCC, 0x73,
+	0x0C, 0xC3, 0x00, 0x3C, 0x19, 0x8C, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33,
+	0x0C, 0xC3, 0x30, 0xCC, 0x31, 0x98, 0x3C, 0x00, 0xFC, 0x31, 0x8C, 0x33,
+	0x0C, 0xC3, 0x30, 0xCC, 0x63, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0,
+	0x00, 0x3C, 0x19, 0x8C, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3,
+	0x36, 0xCC, 0xF1, 0x98, 0x3E, 0x00, 0xC0, 0xFC, 0x31, 0x8C, 0x33, 0x0C,
+	0xC3, 0x30, 0xCC, 0x63, 0xF0, 0xCC, 0x31, 0x8C, 0x63, 0x0C, 0xC3, 0x00,
+	0x3C, 0x19, 0x8C, 0x33, 0x00, 0xC0, 0x18, 0x03, 0xC0, 0x18, 0x03, 0x00,
+	0xCC, 0x31, 0x98, 0x3C, 0x00, 0xFF, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+	0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x00, 0xC3, 0x30,
+	0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x31,
+	0x98, 0x3C, 0x00, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0x66, 0x19, 0x86, 0x60,
+	0xF0, 0x3C, 0x0F, 0x01, 0x80, 0x60, 0x18, 0x00, 0xC3, 0x30, 0xCC, 0x33,
+	0x0C, 0xC3, 0x36, 0xCD, 0xB3, 0x6C, 0xDB, 0x39, 0xCE, 0x73, 0x0C, 0xC3,
+	0x00, 0xC3, 0x30, 0xC6, 0x61, 0x98, 0x3C, 0x0F, 0x01, 0x80, 0xF0, 0x3C,
+	0x19, 0x86, 0x63, 0x0C, 0xC3, 0x00, 0xC3, 0x30, 0xC6, 0x61, 0x98, 0x3C,
+	0x0F, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x00, 0xFF,
+	0x00, 0xC0, 0x30, 0x18, 0x0C, 0x03, 0x01, 0x80, 0xC0, 0x30, 0x18, 0x0C,
+	0x03, 0x00, 0xFF, 0x00, 0x7E, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+	0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7E, 0x00, 0x60, 0x18, 0x03,
+	0x00, 0xC0, 0x18, 0x06, 0x00, 0xC0, 0x30, 0x06, 0x01, 0x80, 0x30, 0x0C,
+	0x7E, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+	0x80, 0x60, 0x18, 0x7E, 0x00, 0x18, 0x0F, 0x06, 0x63, 0x0C, 0xFF, 0x80,
+	0x30, 0x06, 0x00, 0xC0, 0x3E, 0x18, 0xC0, 0x31, 0xFC, 0xC3, 0x30, 0xCC,
+	0x31, 0xF4, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x37, 0x0E, 0x63, 0x0C,
+	0xC3, 0x30, 0xCC, 0x33, 0x98, 0xDC, 0x00, 0x3E, 0x18, 0xCC, 0x03, 0x00,
+	0xC0, 0x30, 0x06, 0x30, 0xF8, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x0E,
+	0xC6, 0x73, 0x0C, 0xC3, 0x30, 0xCC, 0x31, 0x9C, 0x3B, 0x00, 0x3C, 0x19,
+	0x8C, 0x33, 0xFC, 0xC0, 0x30, 0x06, 0x30, 0xF8, 0x1E, 0x0C, 0xC3, 0x30,
+	0xC0, 0x30, 0x3F, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30,
+	0x00, 0x7D, 0x31, 0xCC, 0x63, 0x18, 0xC6, 0x1F, 0x0C, 0x01, 0xF8, 0xC3,
+	0x30, 0xCC, 0x31, 0xF8, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x37, 0x0E,
+	0x63, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x00, 0x18, 0x06, 0x00,
+	0x01, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x0F, 0xF0, 0x03,
+	0x00, 0xC0, 0x00, 0x3C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0,
+	0x31, 0x8C, 0x63, 0x18, 0xC3, 0xE0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0,
+	0x31, 0x8C, 0xC3, 0x60, 0xF0, 0x3E, 0x0C, 0xC3, 0x18, 0xC3, 0x00, 0x78,
+	0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+	0x80, 0x60, 0xFF, 0x00, 0xB6, 0x3F, 0xCD, 0xB3, 0x6C, 0xDB, 0x36, 0xCD,
+	0xB3, 0x6C, 0xDC, 0x39, 0x8C, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C,
+	0x3C, 0x19, 0x8C, 0x33, 0x0C, 0xC3, 0x30, 0xC6, 0x60, 0xF0, 0xDC, 0x39,
+	0x8C, 0x33, 0x0C, 0xC3, 0x30, 0xCE, 0x63, 0x70, 0xC0, 0x30, 0x0C, 0x03,
+	0x00, 0x3B, 0x19, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xC6, 0x70, 0xEC, 0x03,
+	0x00, 0xC0, 0x30, 0x0C, 0xDE, 0x1C, 0xC6, 0x01, 0x80, 0x60, 0x18, 0x06,
+	0x01, 0x80, 0x7E, 0x30, 0xCC, 0x01, 0xF8, 0x03, 0x00, 0xCC, 0x31, 0xF8,
+	0x30, 0x0C, 0x03, 0x03, 0xF0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C,
+	0xC1, 0xE0, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xC6, 0x70, 0xEC,
+	0xC3, 0x30, 0xC6, 0x61, 0x98, 0x3C, 0x0F, 0x01, 0x80, 0x60, 0xC3, 0x30,
+	0xCC, 0x33, 0x6C, 0xDB, 0x36, 0xCF, 0xF1, 0x98, 0xC3, 0x19, 0x83, 0xC0,
+	0x60, 0x18, 0x0F, 0x06, 0x63, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3,
+	0x30, 0xC6, 0x70, 0xEC, 0x03, 0x30, 0xC6, 0x60, 0xF0, 0x7F, 0x00, 0xC0,
+	0x60, 0x30, 0x18, 0x0C, 0x06, 0x01, 0xFC, 0x0F, 0x06, 0x01, 0x80, 0x60,
+	0x18, 0x06, 0x0F, 0x00, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x0F, 0x00,
+	0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+	0x01, 0x80, 0x60, 0x18, 0x00, 0xF0, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+	0x00, 0xF0, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0xF0, 0x00, 0x73, 0x36,
+	0xCC, 0xE0, 0x18, 0x0F, 0x06, 0x61, 0x98, 0xC3, 0x30, 0xCC, 0x33, 0xFC,
+	0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x00, 0xFE, 0x30, 0x0C, 0x03, 0x00,
+	0xC0, 0x30, 0x0F, 0xC3, 0x18, 0xC3, 0x30, 0xCC, 0x33, 0x18, 0xFC, 0x00,
+	0xF8, 0x33, 0x0C, 0x63, 0x18, 0xC6, 0x33, 0x0F, 0xC3, 0x18, 0xC3, 0x30,
+	0xCC, 0x33, 0x18, 0xFC, 0x00, 0xFF, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30,
+	0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x00, 0x1E, 0x0D,
+	0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
+	0x98, 0xFF, 0x30, 0xCC, 0x30, 0xFF, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30,
+	0x0F, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF, 0x00, 0xDB, 0x36,
+	0xCD, 0xB3, 0x6C, 0xDB, 0x1F, 0x83, 0xC1, 0xF8, 0xDB, 0x36, 0xCD, 0xB3,
+	0x6C, 0xDB, 0x00, 0x3C, 0x19, 0x8C, 0x33, 0x0C, 0x03, 0x01, 0x81, 0xC0,
+	0x18, 0x03, 0x30, 0xCC, 0x31, 0x98, 0x3C, 0x00, 0xC3, 0x30, 0xCC, 0x33,
+	0x0C, 0xC7, 0x33, 0xCD, 0xF3, 0xEC, 0xF3, 0x38, 0xCC, 0x33, 0x0C, 0xC3,
+	0x00, 0x3C, 0x00, 0x0C, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x73, 0x3C, 0xDF,
+	0x3E, 0xCF, 0x33, 0x8C, 0xC3, 0x30, 0xCC, 0x30, 0xC3, 0x30, 0xCC, 0x63,
+	0x18, 0xCC, 0x33, 0x0F, 0x83, 0x30, 0xCC, 0x31, 0x8C, 0x63, 0x0C, 0xC3,
+	0x00, 0x1F, 0x0C, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63,
+	0x18, 0xC6, 0x33, 0x8C, 0xC3, 0x00, 0xC3, 0x30, 0xCE, 0x73, 0x9C, 0xFF,
+	0x36, 0xCD, 0xB3, 0x6C, 0xDB, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x00, 0xC3,
+	0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCF, 0xF3, 0x0C, 0xC3, 0x30, 0xCC,
+	0x33, 0x0C, 0xC3, 0x00, 0x3C, 0x19, 0x8C, 0x33, 0x0C, 0xC3, 0x30, 0xCC,
+	0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x31, 0x98, 0x3C, 0x00, 0xFF, 0x30, 0xCC,
+	0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C,
+	0xC3, 0x00, 0xFC, 0x31, 0x8C, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x63, 0xF0,
+	0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x00, 0x3C, 0x19, 0x8C, 0x33, 0x00,
+	0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x31, 0x98, 0x3C, 0x00,
+	0xFF, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+	0x01, 0x80, 0x60, 0x18, 0x00, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30,
+	0xC7, 0xF0, 0x0C, 0x03, 0x00, 0xC0, 0x33, 0x0C, 0x7E, 0x00, 0x18, 0x1F,
+	0x8D, 0xB3, 0x6C, 0xDB, 0x36, 0xCD, 0xB3, 0x6C, 0xDB, 0x36, 0xC7, 0xE0,
+	0x60, 0x18, 0x00, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33,
+	0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xFF, 0x80, 0x60, 0x18, 0xC3, 0x30,
+	0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x31, 0xFC, 0x03, 0x00, 0xC0, 0x30,
+	0x0C, 0x03, 0x00, 0xDB, 0x36, 0xCD, 0xB3, 0x6C, 0xDB, 0x36, 0xCD, 0xB3,
+	0x6C, 0xDB, 0x36, 0xCD, 0xB3, 0x6C, 0xFF, 0x00, 0xC3, 0x30, 0xCC, 0x33,
+	0x0C, 0xC3, 0x3C, 0xCD, 0xB3, 0x6C, 0xDB, 0x36, 0xCD, 0xB3, 0x6C, 0xF3,
+	0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x3F, 0x0C, 0x63, 0x0C, 0xC3,
+	0x30, 0xCC, 0x33, 0x18, 0xFC, 0x00, 0xCE, 0x36, 0xCD, 0xB3, 0x6C, 0xDB,
+	0x36, 0xCF, 0xB3, 0x6C, 0xDB, 0x36, 0xCD, 0xB3, 0x6C, 0xCE, 0x00, 0x3F,
+	0x18, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xC6, 0x30, 0xFC, 0x33, 0x18, 0xC6,
+	0x33, 0x0C, 0xC3, 0x00, 0x3E, 0x18, 0xC0, 0x31, 0xFC, 0xC3, 0x30, 0xCC,
+	0x31, 0xF4, 0x02, 0x1F, 0x0C, 0x03, 0x00, 0x7C, 0x39, 0x8C, 0x33, 0x0C,
+	0xC3, 0x30, 0xC6, 0x60, 0xF0, 0xFC, 0x31, 0x8C, 0x63, 0xF8, 0xC3, 0x30,
+	0xCC, 0x33, 0xF8, 0x1E, 0x0D, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x63,
+	0xFC, 0xC3, 0x30, 0xC0, 0x3C, 0x19, 0x8C, 0x33, 0xFC, 0xC0, 0x30, 0x06,
+	0x30, 0xF8, 0xDB, 0x36, 0xCD, 0xB1, 0xF8, 0x7E, 0x36, 0xCD, 0xB3, 0x6C,
+	0x7E, 0x30, 0xC0, 0x30, 0xF8, 0x06, 0x00, 0xCC, 0x31, 0xF8, 0xC3, 0x30,
+	0xCC, 0x73, 0x3C, 0xDB, 0x3C, 0xCE, 0x33, 0x0C, 0x66, 0x0F, 0x00, 0x03,
+	0x0C, 0xC3, 0x31, 0xCC, 0xF3, 0x6C, 0xF3, 0x38, 0xCC, 0x30, 0xC3, 0x31,
+	0x8C, 0xC3, 0xE0, 0xF8, 0x33, 0x0C, 0x63, 0x0C, 0x1F, 0x0C, 0xC6, 0x31,
+	0x8C, 0x63, 0x18, 0xC6, 0x33, 0x0C, 0xC3, 0x39, 0xCF, 0xF3, 0x6C, 0xDB,
+	0x36, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0xFC, 0xC3, 0x30, 0xCC,
+	0x33, 0x0C, 0x3C, 0x19, 0x8C, 0x33, 0x0C, 0xC3, 0x30, 0xC6, 0x60, 0xF0,
+	0xFF, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xDC, 0x39,
+	0x8C, 0x33, 0x0C, 0xC3, 0x30, 0xCE, 0x63, 0x70, 0xC0, 0x30, 0x0C, 0x03,
+	0x00, 0x3E, 0x18, 0xCC, 0x03, 0x00, 0xC0, 0x30, 0x06, 0x30, 0xF8, 0xFF,
+	0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0xC3, 0x30, 0xCC,
+	0x33, 0x0C, 0xC3, 0x30, 0xC6, 0x70, 0xEC, 0x03, 0x30, 0xC6, 0x60, 0xF0,
+	0xC3, 0x19, 0x83, 0xC0, 0x60, 0x18, 0x0F, 0x06, 0x63, 0x0C, 0xC6, 0x31,
+	0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0xFC, 0x03, 0x00, 0xC0, 0xDB,
+	0x36, 0xCD, 0xB3, 0x6C, 0xDB, 0x36, 0xCD, 0xB3, 0xFC, 0xC3, 0x30, 0xCF,
+	0x33, 0x6C, 0xDB, 0x36, 0xCD, 0xB3, 0xCC, 0xC0, 0x30, 0x0C, 0x03, 0xF8,
+	0xC3, 0x30, 0xCC, 0x33, 0xF8, 0x7F, 0x30, 0xCC, 0x33, 0x0C, 0x7F, 0x0C,
+	0xC6, 0x33, 0x0C,
+};
+
+static const uint8_t u8g2_font_10x20_t_cyrillic_map[] = {
+	  0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+	 16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+	 32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,
+	 48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,
+	 64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,
+	 80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	 95,  96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+	111, 112, 113, 114, 115, 255, 116, 117, 118, 255, 255, 119, 120, 255, 121, 122,
+	123, 124, 125, 255, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137,
+	138, 139, 140, 141, 255, 142, 143, 255, 144, 255, 255, 145, 146, 255, 255, 147,
+};
+
+static const sGLYPH u8g2_font_10x20_t_cyrillic_glyphs[] = {
+	{   0,  0,  0}, /* 0x20 */
+	{   0,  3, 13}, /* 0x21 */
+	{  17,  3,  4}, /* 0x22 */
+	{  22,  4, 11}, /* 0x23 */
+	{  36,  3, 13}, /* 0x24 */
+	{  53,  4, 12}, /* 0x25 */
+	{  68,  3, 13}, /* 0x26 */
+	{  85,  3,  5}, /* 0x27 */
+	{  92,  3, 13}, /* 0x28 */
+	{ 109,  3, 13}, /* 0x29 */
+	{ 126,  6,  7}, /* 0x2A */
+	{ 135,  6,  7}, /* 0x2B */
+	{ 144, 14,  3}, /* 0x2C */
+	{ 148,  9,  1}, /* 0x2D */
+	{ 150, 13,  3}, /* 0x2E */
+	{ 154,  4, 12}, /* 0x2F */
+	{ 169,  3, 13}, /* 0x30 */
+	{ 186,  3, 13}, /* 0x31 */
+	{ 203,  3, 13}, /* 0x32 */
+	{ 220,  3, 13}, /* 0x33 */
+	{ 237,  3, 13}, /* 0x34 */
+	{ 254,  3, 13}, /* 0x35 */
+	{ 271,  3, 13}, /* 0x36 */
+	{ 288,  3, 13}, /* 0x37 */
+	{ 305,  3, 13}, /* 0x38 */
+	{ 322,  3, 13}, /* 0x39 */
+	{ 339,  8,  8}, /* 0x3A */
+	{ 349,  8,  9}, /* 0x3B */
+	{ 361,  3, 13}, /* 0x3C */
+	{ 378,  7,  6}, /* 0x3D */
+	{ 386,  3, 13}, /* 0x3E */
+	{ 403,  3, 13}, /* 0x3F */
+	{ 420,  3, 13}, /* 0x40 */
+	{ 437,  3, 13}, /* 0x41 */
+	{ 454,  3, 13}, /* 0x42 */
+	{ 471,  3, 13}, /* 0x43 */
+	{ 488,  3, 13}, /* 0x44 */
+	{ 505,  3, 13}, /* 0x45 */
+	{ 522,  3, 13}, /* 0x46 */
+	{ 539,  3, 13}, /* 0x47 */
+	{ 556,  3, 13}, /* 0x48 */
+	{ 573,  3, 13}, /* 0x49 */
+	{ 590,  3, 13}, /* 0x4A */
+	{ 607,  3, 13}, /* 0x4B */
+	{ 624,  3, 13}, /* 0x4C */
+	{ 641,  3, 13}, /* 0x4D */
+	{ 658,  3, 13}, /* 0x4E */
+	{ 675,  3, 13}, /* 0x4F */
+	{ 692,  3, 13}, /* 0x50 */
+	{ 709,  3, 14}, /* 0x51 */
+	{ 727,  3, 13}, /* 0x52 */
+	{ 744,  3, 13}, /* 0x53 */
+	{ 761,  3, 13}, /* 0x54 */
+	{ 778,  3, 13}, /* 0x55 */
+	{ 795,  3, 13}, /* 0x56 */
+	{ 812,  3, 13}, /* 0x57 */
+	{ 829,  3, 13}, /* 0x58 */
+	{ 846,  3, 13}, /* 0x59 */
+	{ 863,  3, 13}, /* 0x5A */
+	{ 880,  3, 13}, /* 0x5B */
+	{ 897,  4, 12}, /* 0x5C */
+	{ 912,  3, 13}, /* 0x5D */
+	{ 929,  3,  4}, /* 0x5E */
+	{ 934, 16,  1}, /* 0x5F */
+	{ 936,  3,  3}, /* 0x60 */
+	{ 940,  8,  8}, /* 0x61 */
+	{ 950,  3, 13}, /* 0x62 */
+	{ 967,  8,  8}, /* 0x63 */
+	{ 977,  3, 13}, /* 0x64 */
+	{ 994,  8,  8}, /* 0x65 */
+	{1004,  3, 13}, /* 0x66 */
+	{1021,  8, 12}, /* 0x67 */
+	{1036,  3, 13}, /* 0x68 */
+	{1053,  5, 11}, /* 0x69 */
+	{1067,  5, 15}, /* 0x6A */
+	{1086,  3, 13}, /* 0x6B */
+	{1103,  3, 13}, /* 0x6C */
+	{1120,  8,  8}, /* 0x6D */
+	{1130,  8,  8}, /* 0x6E */
+	{1140,  8,  8}, /* 0x6F */
+	{1150,  8, 12}, /* 0x70 */
+	{1165,  8, 12}, /* 0x71 */
+	{1180,  8,  8}, /* 0x72 */
+	{1190,  8,  8}, /* 0x73 */
+	{1200,  5, 11}, /* 0x74 */
+	{1214,  8,  8}, /* 0x75 */
+	{1224,  8,  8}, /* 0x76 */
+	{1234,  8,  8}, /* 0x77 */
+	{1244,  8,  8}, /* 0x78 */
+	{1254,  8, 12}, /* 0x79 */
+	{1269,  8,  8}, /* 0x7A */
+	{1279,  3, 13}, /* 0x7B */
+	{1296,  3, 13}, /* 0x7C */
+	{1313,  3, 13}, /* 0x7D */
+	{1330,  3,  3}, /* 0x7E */
+	{1334,  2, 13}, /* 0xC0 */
+	{1351,  2, 13}, /* 0xC1 */
+	{1368,  2, 13}, /* 0xC2 */
+	{1385,  2, 13}, /* 0xC3 */
+	{1402,  2, 15}, /* 0xC4 */
+	{1421,  2, 13}, /* 0xC5 */
+	{1438,  2, 13}, /* 0xC6 */
+	{1455,  2, 13}, /* 0xC7 */
+	{1472,  2, 13}, /* 0xC8 */
+	{1489,  0, 15}, /* 0xC9 */
+	{1508,  2, 13}, /* 0xCA */
+	{1525,  2, 13}, /* 0xCB */
+	{1542,  2, 13}, /* 0xCC */
+	{1559,  2, 13}, /* 0xCD */
+	{1576,  2, 13}, /* 0xCE */
+	{1593,  2, 13}, /* 0xCF */
+	{1610,  2, 13}, /* 0xD0 */
+	{1627,  2, 13}, /* 0xD1 */
+	{1644,  2, 13}, /* 0xD2 */
+	{1661,  2, 13}, /* 0xD3 */
+	{1678,  2, 13}, /* 0xD4 */
+	{1695,  2, 15}, /* 0xD6 */
+	{1714,  2, 13}, /* 0xD7 */
+	{1731,  2, 13}, /* 0xD8 */
+	{1748,  2, 13}, /* 0xDB */
+	{1765,  2, 13}, /* 0xDC */
+	{1782,  2, 13}, /* 0xDE */
+	{1799,  2, 13}, /* 0xDF */
+	{1816,  7,  8}, /* 0xE0 */
+	{1826,  3, 12}, /* 0xE1 */
+	{1841,  7,  8}, /* 0xE2 */
+	{1851,  7, 10}, /* 0xE4 */
+	{1864,  7,  8}, /* 0xE5 */
+	{1874,  7,  8}, /* 0xE6 */
+	{1884,  7,  8}, /* 0xE7 */
+	{1894,  7,  8}, /* 0xE8 */
+	{1904,  4, 11}, /* 0xE9 */
+	{1918,  7,  8}, /* 0xEA */
+	{1928,  7,  8}, /* 0xEB */
+	{1938,  7,  8}, /* 0xEC */
+	{1948,  7,  8}, /* 0xED */
+	{1958,  7,  8}, /* 0xEE */
+	{1968,  7,  8}, /* 0xEF */
+	{1978,  7, 12}, /* 0xF0 */
+	{1993,  7,  8}, /* 0xF1 */
+	{2003,  7,  8}, /* 0xF2 */
+	{2013,  7, 12}, /* 0xF3 */
+	{2028,  7,  8}, /* 0xF5 */
+	{2038,  7, 10}, /* 0xF6 */
+	{2051,  7,  8}, /* 0xF8 */
+	{2061,  7,  8}, /* 0xFB */
+	{2071,  7,  8}, /* 0xFC */
+	{2081,  7,  8}, /* 0xFF */
 };
 
 
 sFONT u8g2_font_10x20_t_cyrillic = {
 	u8g2_font_10x20_t_cyrillic_table,
 	10,
-	20
+	20,
+	u8g2_font_10x20_t_cyrillic_map,
+	u8g2_font_10x20_t_cyrillic_glyphs,
+	148
 };
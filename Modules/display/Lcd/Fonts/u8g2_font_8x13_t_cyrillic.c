@@ -1,307 +1,283 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/* Generated by tools/font_converter.py from fonts/u8g2_font_8x13_t_cyrillic.pbm */
+
 #include "fonts.h"
 
-const uint8_t u8g2_font_8x13_t_cyrillic_table[] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10,
-    0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x24,
-    0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x24, 0x7E, 0x24, 0x7E, 0x24, 0x24,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3C, 0x50, 0x50, 0x38,
-    0x14, 0x14, 0x78, 0x10, 0x00, 0x00, 0x00, 0x00, 0x22, 0x52,
-    0x24, 0x08, 0x08, 0x10, 0x24, 0x2A, 0x44, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x30, 0x48, 0x48, 0x30, 0x4A, 0x44, 0x3A,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x08,
-    0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x18, 0x7E, 0x18, 0x24, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10,
-    0x7C, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x30, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x38, 0x10, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x18, 0x24, 0x42, 0x42, 0x42, 0x42, 0x42, 0x24, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x30, 0x50, 0x10, 0x10, 0x10,
-    0x10, 0x10, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x42,
-    0x02, 0x04, 0x18, 0x20, 0x40, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x02, 0x04, 0x08, 0x1C, 0x02, 0x02, 0x42, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x0C, 0x14, 0x24, 0x44, 0x44, 0x7E,
-    0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x40, 0x40, 0x5C,
-    0x62, 0x02, 0x02, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x1C,
-    0x20, 0x40, 0x40, 0x5C, 0x62, 0x42, 0x42, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x42, 0x3C,
-    0x42, 0x42, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42,
-    0x42, 0x46, 0x3A, 0x02, 0x02, 0x04, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x38, 0x10, 0x00, 0x00, 0x10, 0x38,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x10, 0x00,
-    0x00, 0x38, 0x30, 0x40, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08,
-    0x10, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x08, 0x10,
-    0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x02,
-    0x04, 0x08, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x42, 0x42, 0x4E, 0x52, 0x56, 0x4A, 0x40, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x24, 0x42, 0x42, 0x42, 0x7E, 0x42, 0x42,
-    0x42, 0x00, 0x00, 0x00, 0x00, 0x78, 0x44, 0x42, 0x44, 0x78,
-    0x44, 0x42, 0x44, 0x78, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42,
-    0x40, 0x40, 0x40, 0x40, 0x40, 0x42, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x40, 0x40, 0x40, 0x78, 0x40,
-    0x40, 0x40, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x40, 0x40,
-    0x40, 0x78, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x42, 0x40, 0x40, 0x40, 0x4E, 0x42, 0x46, 0x3A, 0x00,
-    0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x42, 0x42,
-    0x42, 0x42, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x10, 0x10,
-    0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x44, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x42, 0x44, 0x48, 0x50, 0x60, 0x50, 0x48, 0x44,
-    0x42, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40,
-    0x40, 0x40, 0x40, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82,
-    0xC6, 0xAA, 0x92, 0x92, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00,
-    0x00, 0x42, 0x42, 0x62, 0x52, 0x4A, 0x46, 0x42, 0x42, 0x42,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x42, 0x42, 0x42,
-    0x42, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x42, 0x42,
-    0x42, 0x7C, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x42, 0x42, 0x42, 0x42, 0x42, 0x52, 0x4A, 0x3C, 0x02,
-    0x00, 0x00, 0x00, 0x7C, 0x42, 0x42, 0x42, 0x7C, 0x50, 0x48,
-    0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x40, 0x40,
-    0x3C, 0x02, 0x02, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x44, 0x44, 0x44,
-    0x28, 0x28, 0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82,
-    0x82, 0x82, 0x92, 0x92, 0x92, 0xAA, 0x44, 0x00, 0x00, 0x00,
-    0x00, 0x82, 0x82, 0x44, 0x28, 0x10, 0x28, 0x44, 0x82, 0x82,
-    0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x44, 0x28, 0x10, 0x10,
-    0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x02, 0x04,
-    0x08, 0x10, 0x20, 0x40, 0x40, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x78, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x78, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x28, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x02, 0x3E, 0x42, 0x46, 0x3A, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x40, 0x40, 0x5C, 0x62, 0x42, 0x42, 0x62, 0x5C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x40,
-    0x40, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02,
-    0x3A, 0x46, 0x42, 0x42, 0x46, 0x3A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x42, 0x7E, 0x40, 0x42, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x1C, 0x22, 0x20, 0x20, 0x7C, 0x20, 0x20,
-    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A,
-    0x44, 0x44, 0x38, 0x40, 0x3C, 0x42, 0x3C, 0x00, 0x00, 0x40,
-    0x40, 0x40, 0x5C, 0x62, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x30, 0x10, 0x10, 0x10, 0x10,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0C, 0x04,
-    0x04, 0x04, 0x04, 0x44, 0x44, 0x38, 0x00, 0x00, 0x40, 0x40,
-    0x40, 0x44, 0x48, 0x70, 0x48, 0x44, 0x42, 0x00, 0x00, 0x00,
-    0x00, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x92, 0x92,
-    0x92, 0x92, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x5C, 0x62, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x62, 0x42, 0x62,
-    0x5C, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A,
-    0x46, 0x42, 0x46, 0x3A, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x5C, 0x22, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x30, 0x0C, 0x42,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x7C, 0x20,
-    0x20, 0x20, 0x22, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x28, 0x28, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x92,
-    0x92, 0xAA, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x46, 0x3A, 0x02, 0x42,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x04, 0x08, 0x10,
-    0x20, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x10, 0x10, 0x08,
-    0x30, 0x08, 0x10, 0x10, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x70, 0x08, 0x08, 0x10, 0x0C, 0x10, 0x08, 0x08,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x24, 0x54, 0x48, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x08, 0x00, 0x7E, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x7E,
-    0x00, 0x00, 0x00, 0x24, 0x24, 0x00, 0x7E, 0x40, 0x40, 0x7C,
-    0x40, 0x40, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x20, 0x20,
-    0x3C, 0x22, 0x22, 0x22, 0x22, 0x22, 0x02, 0x00, 0x00, 0x08,
-    0x10, 0x00, 0x7E, 0x42, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x22, 0x40, 0x40, 0x7C, 0x40, 0x40,
-    0x22, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x40, 0x40,
-    0x3C, 0x02, 0x02, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00,
-    0x00, 0x44, 0x44, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x44, 0x38, 0x00, 0x00, 0x00, 0x00, 0x70, 0x90,
-    0x90, 0x90, 0x9C, 0x92, 0x92, 0x92, 0x9C, 0x00, 0x00, 0x00,
-    0x00, 0x90, 0x90, 0x90, 0x90, 0xFC, 0x92, 0x92, 0x92, 0x9C,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x20, 0x20, 0x2C, 0x32, 0x22,
-    0x22, 0x22, 0x22, 0x00, 0x00, 0x08, 0x10, 0x00, 0x44, 0x48,
-    0x50, 0x60, 0x50, 0x48, 0x44, 0x44, 0x00, 0x00, 0x00, 0x10,
-    0x08, 0x42, 0x46, 0x46, 0x4A, 0x52, 0x62, 0x62, 0x42, 0x00,
-    0x00, 0x00, 0x42, 0x3C, 0x00, 0x42, 0x42, 0x42, 0x3E, 0x02,
-    0x02, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x24, 0x42, 0x42, 0x42, 0x7E, 0x42,
-    0x42, 0x42, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x40, 0x40, 0x40,
-    0x7C, 0x42, 0x42, 0x42, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x42, 0x42, 0x42, 0x7C, 0x42, 0x42, 0x42, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x42, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x24, 0x24, 0x24, 0x44,
-    0x44, 0x44, 0x44, 0xFE, 0x82, 0x00, 0x00, 0x00, 0x7E, 0x40,
-    0x40, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x92, 0x92, 0x54, 0x38, 0x54, 0x92, 0x92, 0x92, 0x92,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x02, 0x02, 0x0C, 0x02,
-    0x02, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x42, 0x46, 0x46,
-    0x4A, 0x4A, 0x52, 0x52, 0x62, 0x42, 0x00, 0x00, 0x00, 0x42,
-    0x3C, 0x42, 0x46, 0x46, 0x4A, 0x52, 0x62, 0x62, 0x42, 0x00,
-    0x00, 0x00, 0x00, 0x42, 0x44, 0x48, 0x50, 0x60, 0x50, 0x48,
-    0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00, 0x82,
-    0x82, 0xC6, 0xAA, 0x92, 0x92, 0x82, 0x82, 0x82, 0x00, 0x00,
-    0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42,
-    0x42, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x42, 0x42,
-    0x42, 0x42, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x42,
-    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x42, 0x42, 0x42, 0x42, 0x7C, 0x40, 0x40, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x40, 0x40, 0x40, 0x40,
-    0x40, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x10, 0x10,
-    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x42, 0x42, 0x42, 0x42, 0x24, 0x18, 0x10, 0x20, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x7C, 0x92, 0x92, 0x92, 0x92, 0x7C,
-    0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x28, 0x28,
-    0x10, 0x28, 0x28, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x84,
-    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xFE, 0x02, 0x02,
-    0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x3E, 0x02, 0x02, 0x02,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xFE, 0x02, 0x02, 0x00,
-    0x00, 0xE0, 0x20, 0x20, 0x20, 0x3C, 0x22, 0x22, 0x22, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x72, 0x4A, 0x4A,
-    0x4A, 0x4A, 0x72, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40,
-    0x40, 0x7C, 0x42, 0x42, 0x42, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x04, 0x02, 0x02, 0x3E, 0x02, 0x02, 0x04, 0x78, 0x00,
-    0x00, 0x00, 0x00, 0x8C, 0x92, 0x92, 0x92, 0xF2, 0x92, 0x92,
-    0x92, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x44, 0x44, 0x44,
-    0x3C, 0x14, 0x24, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x02, 0x3E, 0x42, 0x42, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x3C, 0x40, 0x7C, 0x42, 0x42, 0x42, 0x42,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x42,
-    0x7C, 0x42, 0x42, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x42, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1C, 0x24, 0x24, 0x24, 0x24, 0x7E,
-    0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x7E,
-    0x40, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x92, 0x92, 0x7C, 0x54, 0x92, 0x92, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x42, 0x1C, 0x02, 0x42, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x46, 0x4A, 0x52,
-    0x62, 0x42, 0x00, 0x00, 0x00, 0x00, 0x42, 0x3C, 0x00, 0x42,
-    0x46, 0x4A, 0x52, 0x62, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x44, 0x48, 0x70, 0x48, 0x44, 0x44, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x22, 0x22, 0x22, 0x22,
-    0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x6C,
-    0x54, 0x54, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x42, 0x42, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x42, 0x42,
-    0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x5C, 0x62, 0x42, 0x42, 0x62, 0x5C, 0x40, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x42, 0x40, 0x40, 0x42, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x10, 0x10,
-    0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
-    0x42, 0x42, 0x46, 0x3A, 0x02, 0x42, 0x3C, 0x00, 0x00, 0x10,
-    0x10, 0x10, 0x7C, 0x92, 0x92, 0x92, 0x92, 0x7C, 0x10, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x24, 0x18, 0x18, 0x24,
-    0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x7E, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x42, 0x42, 0x46, 0x3A, 0x02, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x92, 0x92, 0x92, 0x92, 0x92, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0xFE, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE0, 0x20, 0x3C, 0x22, 0x22, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x42, 0x42, 0x72, 0x4A, 0x4A, 0x72, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x3C, 0x22,
-    0x22, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x02, 0x0E, 0x02, 0x02, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x8C, 0x92, 0x92, 0xF2, 0x92, 0x8C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x42, 0x42, 0x3E, 0x22,
-    0x42, 0x00, 0x00
+
+static const uint8_t u8g2_font_8x13_t_cyrillic_table[] = {
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x24, 0x24, 0x24,
+	0x24, 0x24, 0x7E, 0x24, 0x7E, 0x24, 0x24, 0x10, 0x3C, 0x50, 0x50, 0x38,
+	0x14, 0x14, 0x78, 0x10, 0x22, 0x52, 0x24, 0x08, 0x08, 0x10, 0x24, 0x2A,
+	0x44, 0x30, 0x48, 0x48, 0x30, 0x4A, 0x44, 0x3A, 0x10, 0x10, 0x10, 0x04,
+	0x08, 0x08, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x20, 0x10, 0x10, 0x08,
+	0x08, 0x08, 0x10, 0x10, 0x20, 0x24, 0x18, 0x7E, 0x18, 0x24, 0x10, 0x10,
+	0x7C, 0x10, 0x10, 0x38, 0x30, 0x40, 0x7C, 0x10, 0x38, 0x10, 0x02, 0x02,
+	0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x80, 0x18, 0x24, 0x42, 0x42, 0x42,
+	0x42, 0x42, 0x24, 0x18, 0x10, 0x30, 0x50, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x7C, 0x3C, 0x42, 0x42, 0x02, 0x04, 0x18, 0x20, 0x40, 0x7E, 0x7E, 0x02,
+	0x04, 0x08, 0x1C, 0x02, 0x02, 0x42, 0x3C, 0x04, 0x0C, 0x14, 0x24, 0x44,
+	0x44, 0x7E, 0x04, 0x04, 0x7E, 0x40, 0x40, 0x5C, 0x62, 0x02, 0x02, 0x42,
+	0x3C, 0x1C, 0x20, 0x40, 0x40, 0x5C, 0x62, 0x42, 0x42, 0x3C, 0x7E, 0x02,
+	0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x3C, 0x42, 0x42, 0x42, 0x3C,
+	0x42, 0x42, 0x42, 0x3C, 0x3C, 0x42, 0x42, 0x46, 0x3A, 0x02, 0x02, 0x04,
+	0x38, 0x10, 0x38, 0x10, 0x00, 0x00, 0x10, 0x38, 0x10, 0x10, 0x38, 0x10,
+	0x00, 0x00, 0x38, 0x30, 0x40, 0x02, 0x04, 0x08, 0x10, 0x20, 0x10, 0x08,
+	0x04, 0x02, 0x7E, 0x00, 0x00, 0x7E, 0x40, 0x20, 0x10, 0x08, 0x04, 0x08,
+	0x10, 0x20, 0x40, 0x3C, 0x42, 0x42, 0x02, 0x04, 0x08, 0x08, 0x00, 0x08,
+	0x3C, 0x42, 0x42, 0x4E, 0x52, 0x56, 0x4A, 0x40, 0x3C, 0x18, 0x24, 0x42,
+	0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x78, 0x44, 0x42, 0x44, 0x78, 0x44,
+	0x42, 0x44, 0x78, 0x3C, 0x42, 0x40, 0x40, 0x40, 0x40, 0x40, 0x42, 0x3C,
+	0x78, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x78, 0x7E, 0x40, 0x40,
+	0x40, 0x78, 0x40, 0x40, 0x40, 0x7E, 0x7E, 0x40, 0x40, 0x40, 0x78, 0x40,
+	0x40, 0x40, 0x40, 0x3C, 0x42, 0x40, 0x40, 0x40, 0x4E, 0x42, 0x46, 0x3A,
+	0x42, 0x42, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x42, 0x7C, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x44, 0x38, 0x42, 0x44, 0x48, 0x50, 0x60, 0x50, 0x48, 0x44, 0x42,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7E, 0x82, 0x82, 0xC6,
+	0xAA, 0x92, 0x92, 0x82, 0x82, 0x82, 0x42, 0x42, 0x62, 0x52, 0x4A, 0x46,
+	0x42, 0x42, 0x42, 0x3C, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C,
+	0x7C, 0x42, 0x42, 0x42, 0x7C, 0x40, 0x40, 0x40, 0x40, 0x3C, 0x42, 0x42,
+	0x42, 0x42, 0x42, 0x52, 0x4A, 0x3C, 0x02, 0x7C, 0x42, 0x42, 0x42, 0x7C,
+	0x50, 0x48, 0x44, 0x42, 0x3C, 0x42, 0x40, 0x40, 0x3C, 0x02, 0x02, 0x42,
+	0x3C, 0xFE, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x42, 0x42,
+	0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x82, 0x82, 0x44, 0x44, 0x44,
+	0x28, 0x28, 0x28, 0x10, 0x82, 0x82, 0x82, 0x82, 0x92, 0x92, 0x92, 0xAA,
+	0x44, 0x82, 0x82, 0x44, 0x28, 0x10, 0x28, 0x44, 0x82, 0x82, 0x82, 0x82,
+	0x44, 0x28, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7E, 0x02, 0x04, 0x08, 0x10,
+	0x20, 0x40, 0x40, 0x7E, 0x3C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x3C, 0x80, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x02, 0x78, 0x08,
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x10, 0x28, 0x44, 0xFE, 0x10,
+	0x08, 0x3C, 0x02, 0x3E, 0x42, 0x46, 0x3A, 0x40, 0x40, 0x40, 0x5C, 0x62,
+	0x42, 0x42, 0x62, 0x5C, 0x3C, 0x42, 0x40, 0x40, 0x42, 0x3C, 0x02, 0x02,
+	0x02, 0x3A, 0x46, 0x42, 0x42, 0x46, 0x3A, 0x3C, 0x42, 0x7E, 0x40, 0x42,
+	0x3C, 0x1C, 0x22, 0x20, 0x20, 0x7C, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x44,
+	0x44, 0x38, 0x40, 0x3C, 0x42, 0x3C, 0x40, 0x40, 0x40, 0x5C, 0x62, 0x42,
+	0x42, 0x42, 0x42, 0x10, 0x00, 0x30, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x04,
+	0x00, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x44, 0x44, 0x38, 0x40, 0x40, 0x40,
+	0x44, 0x48, 0x70, 0x48, 0x44, 0x42, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x7C, 0xEC, 0x92, 0x92, 0x92, 0x92, 0x82, 0x5C, 0x62, 0x42,
+	0x42, 0x42, 0x42, 0x3C, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x5C, 0x62, 0x42,
+	0x62, 0x5C, 0x40, 0x40, 0x40, 0x3A, 0x46, 0x42, 0x46, 0x3A, 0x02, 0x02,
+	0x02, 0x5C, 0x22, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x42, 0x30, 0x0C, 0x42,
+	0x3C, 0x20, 0x20, 0x7C, 0x20, 0x20, 0x20, 0x22, 0x1C, 0x44, 0x44, 0x44,
+	0x44, 0x44, 0x3A, 0x44, 0x44, 0x44, 0x28, 0x28, 0x10, 0x82, 0x82, 0x92,
+	0x92, 0xAA, 0x44, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x42, 0x42, 0x42,
+	0x46, 0x3A, 0x02, 0x42, 0x3C, 0x7E, 0x04, 0x08, 0x10, 0x20, 0x7E, 0x0E,
+	0x10, 0x10, 0x08, 0x30, 0x08, 0x10, 0x10, 0x0E, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x70, 0x08, 0x08, 0x10, 0x0C, 0x10, 0x08,
+	0x08, 0x70, 0x24, 0x54, 0x48, 0x18, 0x24, 0x42, 0x42, 0x42, 0x7E, 0x42,
+	0x42, 0x42, 0x7C, 0x40, 0x40, 0x40, 0x7C, 0x42, 0x42, 0x42, 0x7C, 0x7C,
+	0x42, 0x42, 0x42, 0x7C, 0x42, 0x42, 0x42, 0x7C, 0x7E, 0x42, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x3C, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44,
+	0x44, 0xFE, 0x82, 0x7E, 0x40, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x7E,
+	0x92, 0x92, 0x54, 0x38, 0x54, 0x92, 0x92, 0x92, 0x92, 0x3C, 0x42, 0x02,
+	0x02, 0x0C, 0x02, 0x02, 0x42, 0x3C, 0x42, 0x46, 0x46, 0x4A, 0x4A, 0x52,
+	0x52, 0x62, 0x42, 0x42, 0x3C, 0x42, 0x46, 0x46, 0x4A, 0x52, 0x62, 0x62,
+	0x42, 0x42, 0x44, 0x48, 0x50, 0x60, 0x50, 0x48, 0x44, 0x42, 0x1E, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x42, 0x42, 0x82, 0x82, 0xC6, 0xAA, 0x92,
+	0x92, 0x82, 0x82, 0x82, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42,
+	0x42, 0x3C, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x7E, 0x42,
+	0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7C, 0x42, 0x42, 0x42, 0x42,
+	0x7C, 0x40, 0x40, 0x40, 0x3C, 0x42, 0x40, 0x40, 0x40, 0x40, 0x40, 0x42,
+	0x3C, 0xFE, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x42, 0x42,
+	0x42, 0x42, 0x24, 0x18, 0x10, 0x20, 0x40, 0x10, 0x7C, 0x92, 0x92, 0x92,
+	0x92, 0x7C, 0x10, 0x10, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+	0xFE, 0x02, 0x02, 0x42, 0x42, 0x42, 0x42, 0x3E, 0x02, 0x02, 0x02, 0x02,
+	0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xFE, 0x42, 0x42, 0x42,
+	0x72, 0x4A, 0x4A, 0x4A, 0x4A, 0x72, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x42,
+	0x42, 0x42, 0x7C, 0x8C, 0x92, 0x92, 0x92, 0xF2, 0x92, 0x92, 0x92, 0x8C,
+	0x3C, 0x44, 0x44, 0x44, 0x3C, 0x14, 0x24, 0x44, 0x44, 0x3C, 0x02, 0x3E,
+	0x42, 0x42, 0x3E, 0x02, 0x3C, 0x40, 0x7C, 0x42, 0x42, 0x42, 0x42, 0x3C,
+	0x7C, 0x42, 0x7C, 0x42, 0x42, 0x7C, 0x1C, 0x24, 0x24, 0x24, 0x24, 0x7E,
+	0x42, 0x3C, 0x42, 0x7E, 0x40, 0x42, 0x3C, 0x92, 0x92, 0x7C, 0x54, 0x92,
+	0x92, 0x3C, 0x42, 0x1C, 0x02, 0x42, 0x3C, 0x42, 0x46, 0x4A, 0x52, 0x62,
+	0x42, 0x42, 0x3C, 0x00, 0x42, 0x46, 0x4A, 0x52, 0x62, 0x42, 0x44, 0x48,
+	0x70, 0x48, 0x44, 0x44, 0x1E, 0x22, 0x22, 0x22, 0x22, 0x42, 0x44, 0x6C,
+	0x54, 0x54, 0x44, 0x44, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x3C, 0x42,
+	0x42, 0x42, 0x42, 0x3C, 0x7E, 0x42, 0x42, 0x42, 0x42, 0x42, 0x5C, 0x62,
+	0x42, 0x42, 0x62, 0x5C, 0x40, 0x40, 0x3C, 0x42, 0x40, 0x40, 0x42, 0x3C,
+	0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x42, 0x42, 0x42, 0x46, 0x3A, 0x02,
+	0x42, 0x3C, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x44, 0x44, 0x44, 0x44,
+	0x44, 0x7E, 0x02, 0x02, 0x92, 0x92, 0x92, 0x92, 0x92, 0xFE, 0x42, 0x42,
+	0x72, 0x4A, 0x4A, 0x72, 0x20, 0x20, 0x3C, 0x22, 0x22, 0x3C, 0x3E, 0x42,
+	0x42, 0x3E, 0x22, 0x42,
 };
 
+static const uint8_t u8g2_font_8x13_t_cyrillic_map[] = {
+	  0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+	 16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+	 32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,
+	 48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,
+	 64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,
+	 80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	 95,  96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+	111, 112, 113, 114, 115, 255, 116, 117, 118, 255, 255, 119, 120, 255, 121, 122,
+	123, 124, 125, 255, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137,
+	138, 139, 140, 141, 255, 142, 143, 255, 144, 255, 255, 145, 146, 255, 255, 147,
+};
 
+static const sGLYPH u8g2_font_8x13_t_cyrillic_glyphs[] = {
+	{   0,  0,  0}, /* 0x20 */
+	{   0,  2,  9}, /* 0x21 */
+	{   9,  2,  3}, /* 0x22 */
+	{  12,  3,  7}, /* 0x23 */
+	{  19,  2,  9}, /* 0x24 */
+	{  28,  2,  9}, /* 0x25 */
+	{  37,  4,  7}, /* 0x26 */
+	{  44,  2,  3}, /* 0x27 */
+	{  47,  2,  9}, /* 0x28 */
+	{  56,  2,  9}, /* 0x29 */
+	{  65,  2,  5}, /* 0x2A */
+	{  70,  4,  5}, /* 0x2B */
+	{  75,  9,  3}, /* 0x2C */
+	{  78,  6,  1}, /* 0x2D */
+	{  79,  9,  3}, /* 0x2E */
+	{  82,  2,  9}, /* 0x2F */
+	{  91,  2,  9}, /* 0x30 */
+	{ 100,  2,  9}, /* 0x31 */
+	{ 109,  2,  9}, /* 0x32 */
+	{ 118,  2,  9}, /* 0x33 */
+	{ 127,  2,  9}, /* 0x34 */
+	{ 136,  2,  9}, /* 0x35 */
+	{ 145,  2,  9}, /* 0x36 */
+	{ 154,  2,  9}, /* 0x37 */
+	{ 163,  2,  9}, /* 0x38 */
+	{ 172,  2,  9}, /* 0x39 */
+	{ 181,  4,  8}, /* 0x3A */
+	{ 189,  4,  8}, /* 0x3B */
+	{ 197,  2,  9}, /* 0x3C */
+	{ 206,  5,  4}, /* 0x3D */
+	{ 210,  2,  9}, /* 0x3E */
+	{ 219,  2,  9}, /* 0x3F */
+	{ 228,  2,  9}, /* 0x40 */
+	{ 237,  2,  9}, /* 0x41 */
+	{ 246,  2,  9}, /* 0x42 */
+	{ 255,  2,  9}, /* 0x43 */
+	{ 264,  2,  9}, /* 0x44 */
+	{ 273,  2,  9}, /* 0x45 */
+	{ 282,  2,  9}, /* 0x46 */
+	{ 291,  2,  9}, /* 0x47 */
+	{ 300,  2,  9}, /* 0x48 */
+	{ 309,  2,  9}, /* 0x49 */
+	{ 318,  2,  9}, /* 0x4A */
+	{ 327,  2,  9}, /* 0x4B */
+	{ 336,  2,  9}, /* 0x4C */
+	{ 345,  2,  9}, /* 0x4D */
+	{ 354,  2,  9}, /* 0x4E */
+	{ 363,  2,  9}, /* 0x4F */
+	{ 372,  2,  9}, /* 0x50 */
+	{ 381,  2, 10}, /* 0x51 */
+	{ 391,  2,  9}, /* 0x52 */
+	{ 400,  2,  9}, /* 0x53 */
+	{ 409,  2,  9}, /* 0x54 */
+	{ 418,  2,  9}, /* 0x55 */
+	{ 427,  2,  9}, /* 0x56 */
+	{ 436,  2,  9}, /* 0x57 */
+	{ 445,  2,  9}, /* 0x58 */
+	{ 454,  2,  9}, /* 0x59 */
+	{ 463,  2,  9}, /* 0x5A */
+	{ 472,  2,  9}, /* 0x5B */
+	{ 481,  2,  9}, /* 0x5C */
+	{ 490,  2,  9}, /* 0x5D */
+	{ 499,  2,  3}, /* 0x5E */
+	{ 502, 11,  1}, /* 0x5F */
+	{ 503,  1,  2}, /* 0x60 */
+	{ 505,  5,  6}, /* 0x61 */
+	{ 511,  2,  9}, /* 0x62 */
+	{ 520,  5,  6}, /* 0x63 */
+	{ 526,  2,  9}, /* 0x64 */
+	{ 535,  5,  6}, /* 0x65 */
+	{ 541,  2,  9}, /* 0x66 */
+	{ 550,  5,  8}, /* 0x67 */
+	{ 558,  2,  9}, /* 0x68 */
+	{ 567,  3,  8}, /* 0x69 */
+	{ 575,  3, 10}, /* 0x6A */
+	{ 585,  2,  9}, /* 0x6B */
+	{ 594,  2,  9}, /* 0x6C */
+	{ 603,  5,  6}, /* 0x6D */
+	{ 609,  5,  6}, /* 0x6E */
+	{ 615,  5,  6}, /* 0x6F */
+	{ 621,  5,  8}, /* 0x70 */
+	{ 629,  5,  8}, /* 0x71 */
+	{ 637,  5,  6}, /* 0x72 */
+	{ 643,  5,  6}, /* 0x73 */
+	{ 649,  3,  8}, /* 0x74 */
+	{ 657,  5,  6}, /* 0x75 */
+	{ 663,  5,  6}, /* 0x76 */
+	{ 669,  5,  6}, /* 0x77 */
+	{ 675,  5,  6}, /* 0x78 */
+	{ 681,  5,  8}, /* 0x79 */
+	{ 689,  5,  6}, /* 0x7A */
+	{ 695,  2,  9}, /* 0x7B */
+	{ 704,  2,  9}, /* 0x7C */
+	{ 713,  2,  9}, /* 0x7D */
+	{ 722,  2,  3}, /* 0x7E */
+	{ 725,  2,  9}, /* 0xC0 */
+	{ 734,  2,  9}, /* 0xC1 */
+	{ 743,  2,  9}, /* 0xC2 */
+	{ 752,  2,  9}, /* 0xC3 */
+	{ 761,  2, 10}, /* 0xC4 */
+	{ 771,  2,  9}, /* 0xC5 */
+	{ 780,  2,  9}, /* 0xC6 */
+	{ 789,  2,  9}, /* 0xC7 */
+	{ 798,  2,  9}, /* 0xC8 */
+	{ 807,  1, 10}, /* 0xC9 */
+	{ 817,  2,  9}, /* 0xCA */
+	{ 826,  2,  9}, /* 0xCB */
+	{ 835,  2,  9}, /* 0xCC */
+	{ 844,  2,  9}, /* 0xCD */
+	{ 853,  2,  9}, /* 0xCE */
+	{ 862,  2,  9}, /* 0xCF */
+	{ 871,  2,  9}, /* 0xD0 */
+	{ 880,  2,  9}, /* 0xD1 */
+	{ 889,  2,  9}, /* 0xD2 */
+	{ 898,  2,  9}, /* 0xD3 */
+	{ 907,  2,  9}, /* 0xD4 */
+	{ 916,  2, 11}, /* 0xD6 */
+	{ 927,  2,  9}, /* 0xD7 */
+	{ 936,  2,  9}, /* 0xD8 */
+	{ 945,  2,  9}, /* 0xDB */
+	{ 954,  2,  9}, /* 0xDC */
+	{ 963,  2,  9}, /* 0xDE */
+	{ 972,  2,  9}, /* 0xDF */
+	{ 981,  5,  6}, /* 0xE0 */
+	{ 987,  2,  9}, /* 0xE1 */
+	{ 996,  5,  6}, /* 0xE2 */
+	{1002,  5,  7}, /* 0xE4 */
+	{1009,  5,  6}, /* 0xE5 */
+	{1015,  5,  6}, /* 0xE6 */
+	{1021,  5,  6}, /* 0xE7 */
+	{1027,  5,  6}, /* 0xE8 */
+	{1033,  2,  9}, /* 0xE9 */
+	{1042,  5,  6}, /* 0xEA */
+	{1048,  5,  6}, /* 0xEB */
+	{1054,  5,  6}, /* 0xEC */
+	{1060,  5,  6}, /* 0xED */
+	{1066,  5,  6}, /* 0xEE */
+	{1072,  5,  6}, /* 0xEF */
+	{1078,  5,  8}, /* 0xF0 */
+	{1086,  5,  6}, /* 0xF1 */
+	{1092,  5,  6}, /* 0xF2 */
+	{1098,  5,  8}, /* 0xF3 */
+	{1106,  5,  6}, /* 0xF5 */
+	{1112,  5,  8}, /* 0xF6 */
+	{1120,  5,  6}, /* 0xF8 */
+	{1126,  5,  6}, /* 0xFB */
+	{1132,  5,  6}, /* 0xFC */
+	{1138,  5,  6}, /* 0xFF */
+};
 
 
 sFONT u8g2_font_8x13_t_cyrillic = {
 	u8g2_font_8x13_t_cyrillic_table,
 	8,
-	13
+	13,
+	u8g2_font_8x13_t_cyrillic_map,
+	u8g2_font_8x13_t_cyrillic_glyphs,
+	148
 };
-
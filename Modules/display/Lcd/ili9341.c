@@ -31,6 +31,8 @@ void     ili9341_DrawBitmap(uint16_t Xpos, uint16_t Ypos, uint8_t *pbmp);
 void     ili9341_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint16_t *pData);
 void     ili9341_ReadRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint16_t *pData);
 void     ili9341_Scroll(int16_t Scroll, uint16_t TopFix, uint16_t BottonFix);
+void     ili9341_WriteWindow(uint16_t *pData, uint32_t Size, uint8_t Continue);
+uint8_t  ili9341_Refresh(void);
 
 LCD_DrvTypeDef   ili9341_drv =
 {
@@ -51,6 +53,8 @@ LCD_DrvTypeDef   ili9341_drv =
   ili9341_FillRect,
   ili9341_ReadRGBImage,
   ili9341_Scroll,
+  ili9341_WriteWindow,
+  ili9341_Refresh,
 };
 
 LCD_DrvTypeDef  *lcd_drv = &ili9341_drv;
@@ -61,6 +65,8 @@ LCD_DrvTypeDef  *lcd_drv = &ili9341_drv;
 #define ILI9341_RDDID          0x04
 #define ILI9341_RDDST          0x09
 #define ILI9341_RDMODE         0x0A
+#define ILI9341_MODE_SLPOUT    0x10     /* RDMODE: booster on, sleep out */
+#define ILI9341_MODE_DISPON    0x04     /* RDMODE: display on */
 #define ILI9341_RDMADCTL       0x0B
 #define ILI9341_RDPIXFMT       0x0C
 #define ILI9341_RDIMGFMT       0x0D
@@ -87,6 +93,7 @@ LCD_DrvTypeDef  *lcd_drv = &ili9341_drv;
 #define ILI9341_MADCTL         0x36
 #define ILI9341_VSCRSADD       0x37     /* Vertical Scrolling Start Address */
 #define ILI9341_PIXFMT         0x3A     /* COLMOD: Pixel Format Set */
+#define ILI9341_RAMWRC         0x3C     /* Write Memory Continue */
 
 #define ILI9341_RGB_INTERFACE  0xB0     /* RGB Interface Signal Control */
 #define ILI9341_FRMCTR1        0xB1
@@ -199,6 +206,10 @@ static  uint8_t   Is_ili9341_Initialized = 0;
 
 #if ILI9341_INTERFACE_MODE == 1
 static  uint16_t  yStart, yEnd;
+/* Scroll parameters: start address, top fix, scroll area, bottom fix */
+static  uint16_t  scrparam[4] = {0, 0, 0, 0};
+/* Time of the Sleep Out sent by ili9341_Refresh (0: none), the next command waits 5 ms */
+static  uint32_t  sleepOutTick = 0;
 
 #if      ILI9341_MULTITASK_MUTEX == 1 && ILI9341_TOUCH == 1
 volatile uint8_t io_lcd_busy = 0;
@@ -329,20 +340,9 @@ uint16_t ili9341_ReadID(void)
 #if ILI9341_INTERFACE_MODE == 1
 
 //-----------------------------------------------------------------------------
-void ili9341_Init(void)
+/* Power, gamma, pixel format and memory access registers (ili9341_Init and ili9341_Refresh) */
+static void ili9341_Config(void)
 {
-  if((Is_ili9341_Initialized & ILI9341_LCD_INITIALIZED) == 0)
-  {
-    Is_ili9341_Initialized |= ILI9341_LCD_INITIALIZED;
-    if((Is_ili9341_Initialized & ILI9341_IO_INITIALIZED) == 0)
-      LCD_IO_Init();
-    Is_ili9341_Initialized |= ILI9341_IO_INITIALIZED;
-  }
-
-  LCD_Delay(10);
-  LCD_IO_WriteCmd8(ILI9341_SWRESET);
-  LCD_Delay(10);
-
   LCD_IO_WriteCmd8MultipleData8(0xEF, (uint8_t *)"\x03\x80\x02", 3);
   LCD_IO_WriteCmd8MultipleData8(0xCF, (uint8_t *)"\x00\xC1\x30", 3);
   LCD_IO_WriteCmd8MultipleData8(0xED, (uint8_t *)"\x64\x03\x12\x81", 4);
@@ -363,8 +363,6 @@ void ili9341_Init(void)
   // Power Control 3 (Vcom)
   LCD_IO_WriteCmd8MultipleData8(ILI9341_VMCTR2, (uint8_t *)"\x86", 1);
 
-  // Vertical scroll zero
-  LCD_IO_WriteCmd8MultipleData8(ILI9341_VSCRSADD, (uint8_t *)"\x00", 1);
   LCD_IO_WriteCmd8MultipleData8(ILI9341_PIXFMT, (uint8_t *)"\x55", 1);
 
   // LCD_IO_WriteCmd8MultipleData8(0xF6, (uint8_t *)"\x01\x00\x06", 3);
@@ -381,6 +379,29 @@ void ili9341_Init(void)
   LCD_IO_WriteCmd8MultipleData8(ILI9341_GMCTRN1, (uint8_t *)"\x00\x0E\x14\x03\x11\x07\x31\xC1\x48\x08\x0F\x0C\x31\x36\x0F", 15);
 
   LCD_IO_WriteCmd8(ILI9341_MADCTL); LCD_IO_WriteData8(ILI9341_MAD_DATA_RIGHT_THEN_DOWN);
+}
+
+//-----------------------------------------------------------------------------
+void ili9341_Init(void)
+{
+  if((Is_ili9341_Initialized & ILI9341_LCD_INITIALIZED) == 0)
+  {
+    Is_ili9341_Initialized |= ILI9341_LCD_INITIALIZED;
+    if((Is_ili9341_Initialized & ILI9341_IO_INITIALIZED) == 0)
+      LCD_IO_Init();
+    Is_ili9341_Initialized |= ILI9341_IO_INITIALIZED;
+  }
+
+  LCD_Delay(10);
+  LCD_IO_WriteCmd8(ILI9341_SWRESET);
+  LCD_Delay(10);
+
+  ili9341_Config();
+
+  // Vertical scroll zero
+  memset(scrparam, 0, sizeof(scrparam));
+  LCD_IO_WriteCmd8MultipleData8(ILI9341_VSCRSADD, (uint8_t *)"\x00", 1);
+
   LCD_IO_WriteCmd8(ILI9341_SLPOUT);    // Exit Sleep
   LCD_Delay(10);
 
@@ -592,7 +613,6 @@ void ili9341_ReadRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t
   */
 void ili9341_Scroll(int16_t Scroll, uint16_t TopFix, uint16_t BottonFix)
 {
-  static uint16_t scrparam[4] = {0, 0, 0, 0};
   ILI9341_LCDMUTEX_PUSH();
   #if (ILI9341_ORIENTATION == 0)
   if((TopFix != scrparam[1]) || (BottonFix != scrparam[3]))
@@ -655,6 +675,59 @@ void ili9341_Scroll(int16_t Scroll, uint16_t TopFix, uint16_t BottonFix)
   ILI9341_LCDMUTEX_POP();
 }
 
+//-----------------------------------------------------------------------------
+/**
+  * @brief  Write pixels into the window set by ili9341_SetDisplayWindow
+  *         (the window is filled right then down)
+  * @param  pData:    pixels
+  * @param  Size:     pixels count
+  * @param  Continue: 0 = from the window start, 1 = after the last written pixel
+  * @retval None
+  */
+void ili9341_WriteWindow(uint16_t *pData, uint32_t Size, uint8_t Continue)
+{
+  ILI9341_LCDMUTEX_PUSH();
+  LCD_IO_WriteCmd8MultipleData16(Continue ? ILI9341_RAMWRC : ILI9341_RAMWR, pData, Size);
+  ILI9341_LCDMUTEX_POP();
+}
+
+//-----------------------------------------------------------------------------
+/**
+  * @brief  Send the configuration registers again without the reset
+  *         (the display RAM and the scroll position are kept).
+  *         The display reset by noise is in sleep: the refresh sends Sleep Out
+  *         and returns, the Display On is sent by the next refresh after 5 ms
+  * @param  None
+  * @retval 1: Display On has not been sent yet
+  */
+uint8_t ili9341_Refresh(void)
+{
+  if(sleepOutTick && HAL_GetTick() - sleepOutTick < 5)
+    return 1;
+
+  ILI9341_LCDMUTEX_PUSH();
+  ili9341_Config();
+  if(scrparam[2])
+    LCD_IO_WriteCmd8MultipleData16(ILI9341_VSCRDEF, &scrparam[1], 3);
+  LCD_IO_WriteCmd8DataFill16(ILI9341_VSCRSADD, scrparam[0], 1);
+
+  uint8_t mode = 0;
+  LCD_IO_ReadCmd8MultipleData8(ILI9341_RDMODE, &mode, 1, 1);
+  if(!sleepOutTick && !(mode & ILI9341_MODE_SLPOUT))
+  {
+    LCD_IO_WriteCmd8(ILI9341_SLPOUT);  // Exit Sleep (the display has been reset)
+    sleepOutTick = HAL_GetTick() | 1;
+  }
+  else
+  {
+    if(!(mode & ILI9341_MODE_DISPON))
+      LCD_IO_WriteCmd8(ILI9341_DISPON);// Display on
+    sleepOutTick = 0;
+  }
+  ILI9341_LCDMUTEX_POP();
+  return sleepOutTick != 0;
+}
+
 #endif /* #if ILI9341_INTERFACE_MODE == 1 */
 
 //=============================================================================
@@ -766,8 +839,12 @@ uint16_t ili9341_ReadPixel(uint16_t Xpos, uint16_t Ypos)
   * @param  Width:  display window width.
   * @retval None
   */
+static uint16_t wXpos, wYpos, wXsize, wYsize, wX, wY;
+
 void ili9341_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
 {
+  wXpos = Xpos; wYpos = Ypos; wXsize = Width; wYsize = Height;
+  wX = 0; wY = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -931,6 +1008,40 @@ void ili9341_Scroll(int16_t Scroll, uint16_t TopFix, uint16_t BottonFix)
 {
 }
 
+//-----------------------------------------------------------------------------
+/**
+  * @brief  Write pixels into the window set by ili9341_SetDisplayWindow
+  *         (the window is filled right then down)
+  * @param  pData:    pixels
+  * @param  Size:     pixels count
+  * @param  Continue: 0 = from the window start, 1 = after the last written pixel
+  * @retval None
+  */
+void ili9341_WriteWindow(uint16_t *pData, uint32_t Size, uint8_t Continue)
+{
+  if(!Continue)
+  {
+    wX = 0; wY = 0;
+  }
+  while(Size--)
+  {
+    uint16_t Xpos = wXpos + wX, Ypos = wYpos + wY;
+    *((YPOS * FrameBuffer.Xsize + XPOS) + FrameBuffer.Pixels) = *pData++;
+    if(++wX >= wXsize)
+    {
+      wX = 0;
+      if(++wY >= wYsize)
+        wY = 0;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+uint8_t ili9341_Refresh(void)
+{
+  return 0;
+}
+
 #endif /* #if ILI9341_INTERFACE_MODE == 2 */
 
 //=============================================================================
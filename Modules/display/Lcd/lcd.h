@@ -95,6 +95,8 @@ typedef struct
   void     (*FillRect)(uint16_t, uint16_t, uint16_t, uint16_t, uint16_t);
   void     (*ReadRGBImage)(uint16_t, uint16_t, uint16_t, uint16_t, uint16_t*);
   void     (*Scroll)(int16_t, uint16_t, uint16_t);
+  void     (*WriteWindow)(uint16_t*, uint32_t, uint8_t);
+  uint8_t  (*Refresh)(void);    /* 1: the display wakes up, call again after 5 ms */
 }LCD_DrvTypeDef;    
 /**
   * @}
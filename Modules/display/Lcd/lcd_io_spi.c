@@ -20,6 +20,11 @@ void  LCD_Delay (uint32_t delay);
 void  LCD_IO_Init(void);
 void  LCD_IO_Bl_OnOff(uint8_t Bl);
 
+/* Called from the DMA interrupt when the last TX transfer has ended */
+void  LCD_IO_DmaTxCpltCallback(void);
+/* Masks (mask != 0) and unmasks the DMA TX interrupt */
+void  LCD_IO_DmaTxIrqMask(uint32_t mask);
+
 void  LCD_IO_WriteCmd8(uint8_t Cmd);
 void  LCD_IO_WriteCmd16(uint16_t Cmd);
 void  LCD_IO_WriteData8(uint8_t Data);
@@ -402,6 +407,10 @@ uint16_t LcdRead16(void)
 #define LcdSpiMode8()         BITBAND_ACCESS(SPIX->CR1, SPI_CR1_DFF_Pos) = 0
 #define LcdSpiMode16()        BITBAND_ACCESS(SPIX->CR1, SPI_CR1_DFF_Pos) = 1
 
+/* SPI clock dividers (LCD_SPI_SPD_WRITE, LCD_SPI_SPD_READ), see LCD_IO_SetSpeed */
+static uint32_t LcdSpiSpdWrite = LCD_SPI_SPD_WRITE;
+static uint32_t LcdSpiSpdRead  = LCD_SPI_SPD_READ;
+
 //-----------------------------------------------------------------------------
 #if     LCD_SPI_MODE == 1
 /* Halfduplex SPI : the direction of the data must be changed */
@@ -420,7 +429,7 @@ inline void LcdDirRead(uint32_t d)
     GPIOX_ODR(LCD_SCK) = 1;
   }
   GPIOX_MODE(MODE_PP_ALTER_50MHZ, LCD_SCK);
-  SPIX->CR1 = (SPIX->CR1 & ~(SPI_CR1_BR | SPI_CR1_BIDIOE)) | (LCD_SPI_SPD_READ << SPI_CR1_BR_Pos);
+  SPIX->CR1 = (SPIX->CR1 & ~(SPI_CR1_BR | SPI_CR1_BIDIOE)) | (LcdSpiSpdRead << SPI_CR1_BR_Pos);
 }
 
 /* Data direction from IN to OUT */
@@ -431,8 +440,8 @@ inline void LcdDirWrite(void)
   while(BITBAND_ACCESS(SPIX->SR, SPI_SR_RXNE_Pos))
     d8 = SPIX->DR;
   SPIX->CR1 &= ~SPI_CR1_SPE;
-  SPIX->CR1 = (SPIX->CR1 & ~SPI_CR1_BR) | ((LCD_SPI_SPD_WRITE << SPI_CR1_BR_Pos) | SPI_CR1_BIDIOE);
-  LCD_IO_Delay(2 ^ LCD_SPI_SPD_READ);
+  SPIX->CR1 = (SPIX->CR1 & ~SPI_CR1_BR) | ((LcdSpiSpdWrite << SPI_CR1_BR_Pos) | SPI_CR1_BIDIOE);
+  LCD_IO_Delay(2 ^ LcdSpiSpdRead);
   while(BITBAND_ACCESS(SPIX->SR, SPI_SR_RXNE_Pos))
     d8 = SPIX->DR;
   SPIX->CR1 |= SPI_CR1_SPE;
@@ -453,7 +462,7 @@ inline void LcdDirRead(uint32_t d)
   GPIOX_MODE(MODE_PP_ALTER_50MHZ, LCD_SCK);
   while(BITBAND_ACCESS(SPIX->SR, SPI_SR_RXNE_Pos))
     d = SPIX->DR;
-  SPIX->CR1 = (SPIX->CR1 & ~SPI_CR1_BR) | (LCD_SPI_SPD_READ << SPI_CR1_BR_Pos) | SPI_CR1_RXONLY;
+  SPIX->CR1 = (SPIX->CR1 & ~SPI_CR1_BR) | (LcdSpiSpdRead << SPI_CR1_BR_Pos) | SPI_CR1_RXONLY;
 }
 
 extern inline void LcdDirWrite(void);
@@ -463,8 +472,8 @@ inline void LcdDirWrite(void)
   SPIX->CR1 &= ~SPI_CR1_SPE;
   while(BITBAND_ACCESS(SPIX->SR, SPI_SR_RXNE_Pos))
     d8 = SPIX->DR;
-  SPIX->CR1 = (SPIX->CR1 & ~(SPI_CR1_BR | SPI_CR1_RXONLY)) | (LCD_SPI_SPD_WRITE << SPI_CR1_BR_Pos);
-  LCD_IO_Delay(2 ^ LCD_SPI_SPD_READ);
+  SPIX->CR1 = (SPIX->CR1 & ~(SPI_CR1_BR | SPI_CR1_RXONLY)) | (LcdSpiSpdWrite << SPI_CR1_BR_Pos);
+  LCD_IO_Delay(2 ^ LcdSpiSpdRead);
   while(BITBAND_ACCESS(SPIX->SR, SPI_SR_RXNE_Pos))
     d8 = SPIX->DR;
   SPIX->CR1 |= SPI_CR1_SPE;
@@ -543,6 +552,11 @@ inline void LcdCmdWrite16(uint16_t cmd16)
    - 2: DMA transfer in progress */
 volatile uint32_t LCD_IO_DmaTransferStatus = 0;
 
+/* Bitmap transfer end wait off (LCD_DMA_TXWAIT) while it is not 0:
+   the caller keeps the data until LCD_IO_DmaTxCpltCallback and the transfer
+   can be started from the callback (the DMA interrupt is not nested) */
+volatile uint32_t LCD_IO_DmaTxNoWait = 0;
+
 //-----------------------------------------------------------------------------
 /* Waiting for all DMA processes to complete */
 #ifndef osFeature_Semaphore
@@ -607,6 +621,11 @@ void LCD_IO_WriteMultiData16(uint16_t * pData, uint32_t Size, uint32_t dinc)
   LCD_CS_OFF;
 }
 
+//-----------------------------------------------------------------------------
+void LCD_IO_DmaTxIrqMask(uint32_t mask)
+{
+}
+
 #else // #if DMANUM(LCD_DMA_TX) == 0 || LCD_SPI == 0
 
 //-----------------------------------------------------------------------------
@@ -622,9 +641,10 @@ void DMAX_CHANNEL_IRQHANDLER(LCD_DMA_TX)(void)
     while(DMAX_CHANNEL(LCD_DMA_TX)->CCR & DMA_CCR_EN);
     BITBAND_ACCESS(SPIX->CR2, SPI_CR2_TXDMAEN_Pos) = 0;
     while(BITBAND_ACCESS(SPIX->SR, SPI_SR_BSY_Pos));
-    LCD_IO_Delay(2 ^ LCD_SPI_SPD_WRITE);
+    LCD_IO_Delay(2 ^ LcdSpiSpdWrite);
 
-    if(LCD_IO_DmaTransferStatus == 1) /* last transfer end ? */
+    uint32_t last = (LCD_IO_DmaTransferStatus == 1);
+    if(last) /* last transfer end ? */
       LCD_CS_OFF;
 
     #ifndef osFeature_Semaphore
@@ -634,11 +654,30 @@ void DMAX_CHANNEL_IRQHANDLER(LCD_DMA_TX)(void)
     /* FreeRtos */
     osSemaphoreRelease(spiDmaBinSemHandle);
     #endif // #else osFeature_Semaphore
+
+    if(last)
+      LCD_IO_DmaTxCpltCallback();
   }
   else
     DMAX(LCD_DMA_TX)->IFCR = DMAX_IFCR_CGIF(LCD_DMA_TX);
 }
 
+//-----------------------------------------------------------------------------
+__weak void LCD_IO_DmaTxCpltCallback(void)
+{
+}
+
+//-----------------------------------------------------------------------------
+/* The transfer chain started out of the interrupt reads LCD_IO_DmaTransferStatus
+   without the LCD_IO_DmaTxCpltCallback of its own transfer in between */
+void LCD_IO_DmaTxIrqMask(uint32_t mask)
+{
+  if(mask)
+    NVIC_DisableIRQ(DMAX_CHANNEL_IRQ(LCD_DMA_TX));
+  else
+    NVIC_EnableIRQ(DMAX_CHANNEL_IRQ(LCD_DMA_TX));
+}
+
 //-----------------------------------------------------------------------------
 void LCD_IO_WriteMultiData(void * pData, uint32_t Size, uint32_t dmacr)
 {
@@ -681,7 +720,7 @@ void LCD_IO_WriteMultiData8(uint8_t * pData, uint32_t Size, uint32_t dinc)
       LCD_IO_WriteMultiData((void *)pData, Size, dmacr);
       Size = 0;
       #if LCD_DMA_TXWAIT == 1
-      if(dinc)
+      if(dinc && !LCD_IO_DmaTxNoWait)
         WaitForDmaEnd();
       #endif
     }
@@ -697,7 +736,8 @@ void LCD_IO_WriteMultiData8(uint8_t * pData, uint32_t Size, uint32_t dinc)
       #endif
     }
     #if LCD_DMA_TXWAIT == 2
-    WaitForDmaEnd();
+    if(Size || !LCD_IO_DmaTxNoWait)
+      WaitForDmaEnd();
     #endif
   }
 }
@@ -728,7 +768,7 @@ void LCD_IO_WriteMultiData16(uint16_t * pData, uint32_t Size, uint32_t dinc)
       LCD_IO_WriteMultiData((void *)pData, Size, dmacr);
       Size = 0;
       #if LCD_DMA_TXWAIT == 1
-      if(dinc)
+      if(dinc && !LCD_IO_DmaTxNoWait)
         WaitForDmaEnd();
       #endif
     }
@@ -755,7 +795,8 @@ void LCD_IO_WriteMultiData16(uint16_t * pData, uint32_t Size, uint32_t dinc)
       #endif
     }
     #if LCD_DMA_TXWAIT == 2
-    WaitForDmaEnd();
+    if(Size || !LCD_IO_DmaTxNoWait)
+      WaitForDmaEnd();
     #endif
   }
 }
@@ -824,8 +865,8 @@ void DMAX_CHANNEL_IRQHANDLER(LCD_DMA_RX)(void)
     BITBAND_ACCESS(SPIX->CR2, SPI_CR2_RXDMAEN_Pos) = 0; /* SPI DMA off  */
     while(BITBAND_ACCESS(SPIX->SR, SPI_SR_RXNE_Pos))
       d8 = *(uint8_t *)&SPIX->DR;
-    SPIX->CR1 = (SPIX->CR1 & ~SPI_CR1_BR) | ((LCD_SPI_SPD_READ << SPI_CR1_BR_Pos) | SPI_CR1_BIDIOE);
-    LCD_IO_Delay(2 ^ LCD_SPI_SPD_READ);
+    SPIX->CR1 = (SPIX->CR1 & ~SPI_CR1_BR) | ((LcdSpiSpdRead << SPI_CR1_BR_Pos) | SPI_CR1_BIDIOE);
+    LCD_IO_Delay(2 ^ LcdSpiSpdRead);
     while(BITBAND_ACCESS(SPIX->SR, SPI_SR_RXNE_Pos))
       d8 = SPIX->DR;
     SPIX->CR1 |= SPI_CR1_SPE;
@@ -964,8 +1005,8 @@ void LCD_IO_ReadMultiData16to24(uint16_t * pData, uint32_t Size)
   BITBAND_ACCESS(SPIX->CR2, SPI_CR2_RXDMAEN_Pos) = 0;
   while(BITBAND_ACCESS(SPIX->SR, SPI_SR_RXNE_Pos))
     d8 = SPIX->DR;
-  SPIX->CR1 = (SPIX->CR1 & ~SPI_CR1_BR) | ((LCD_SPI_SPD_WRITE << SPI_CR1_BR_Pos) | SPI_CR1_BIDIOE);
-  LCD_IO_Delay(2 ^ LCD_SPI_SPD_READ);
+  SPIX->CR1 = (SPIX->CR1 & ~SPI_CR1_BR) | ((LcdSpiSpdWrite << SPI_CR1_BR_Pos) | SPI_CR1_BIDIOE);
+  LCD_IO_Delay(2 ^ LcdSpiSpdRead);
   while(BITBAND_ACCESS(SPIX->SR, SPI_SR_RXNE_Pos))
     d8 = SPIX->DR;
   DMAX_CHANNEL(LCD_DMA_RX)->CCR = 0;
@@ -1119,10 +1160,10 @@ void LCD_IO_Init(void)
 
   #if LCD_SPI_MODE == 1
   /* Half duplex */
-  SPIX->CR1 = SPI_CR1_CPHA | SPI_CR1_CPOL | SPI_CR1_MSTR | SPI_CR1_SPE | SPI_CR1_SSM | SPI_CR1_SSI | (LCD_SPI_SPD_WRITE << SPI_CR1_BR_Pos) | SPI_CR1_BIDIMODE | SPI_CR1_BIDIOE;
+  SPIX->CR1 = SPI_CR1_CPHA | SPI_CR1_CPOL | SPI_CR1_MSTR | SPI_CR1_SPE | SPI_CR1_SSM | SPI_CR1_SSI | (LcdSpiSpdWrite << SPI_CR1_BR_Pos) | SPI_CR1_BIDIMODE | SPI_CR1_BIDIOE;
   #else // #if LCD_SPI_MODE == 1
   /* TX or full duplex */
-  SPIX->CR1 = SPI_CR1_CPHA | SPI_CR1_CPOL | SPI_CR1_MSTR | SPI_CR1_SPE | SPI_CR1_SSM | SPI_CR1_SSI | (LCD_SPI_SPD_WRITE << SPI_CR1_BR_Pos);
+  SPIX->CR1 = SPI_CR1_CPHA | SPI_CR1_CPOL | SPI_CR1_MSTR | SPI_CR1_SPE | SPI_CR1_SSM | SPI_CR1_SSI | (LcdSpiSpdWrite << SPI_CR1_BR_Pos);
 
   #endif // #else LCD_SPI_MODE == 1
 
@@ -1156,6 +1197,25 @@ void LCD_IO_Init(void)
   #endif  // #if DMANUM(LCD_DMA_RX) > 0
 } // void LCD_IO_Init(void)
 
+//-----------------------------------------------------------------------------
+/* Hardware SPI clock dividers (0=/2, 1=/4 .. 7=/256), the software SPI delays are fix */
+void LCD_IO_SetSpeed(uint32_t SpdWrite, uint32_t SpdRead)
+{
+  #if LCD_SPI > 0
+  WaitForDmaEnd();
+  while(!BITBAND_ACCESS(SPIX->SR, SPI_SR_TXE_Pos));
+  while(BITBAND_ACCESS(SPIX->SR, SPI_SR_BSY_Pos));
+  LcdSpiSpdWrite = SpdWrite & 0x07;
+  LcdSpiSpdRead  = SpdRead & 0x07;
+  SPIX->CR1 &= ~SPI_CR1_SPE;
+  SPIX->CR1 = (SPIX->CR1 & ~SPI_CR1_BR) | (LcdSpiSpdWrite << SPI_CR1_BR_Pos);
+  SPIX->CR1 |= SPI_CR1_SPE;
+  #else
+  (void)SpdWrite;
+  (void)SpdRead;
+  #endif
+}
+
 //-----------------------------------------------------------------------------
 void LCD_IO_WriteCmd8(uint8_t Cmd)
 {
@@ -94,9 +94,8 @@ EndDependencies */
 #define POLY_Y(Z)             ((int32_t)((Points + (Z))->Y))
 //#define NULL                  (void *)0
 
-#define MAX_HEIGHT_FONT       51
-#define MAX_WIDTH_FONT        51
-#define OFFSET_BITMAP         54
+/* Text output line buffer size [pixel]: the longer side of the display */
+#define LINE_BUFFER_SIZE      320
 
 
 /* @defgroup STM32_ADAFRUIT_LCD_Private_Macros */
@@ -108,12 +107,13 @@ LCD_DrawPropTypeDef DrawProp;
 
 extern LCD_DrvTypeDef  *lcd_drv;
 
-/* Max size of bitmap will based on a font24 (17x24) */
-static uint8_t bitmap[MAX_HEIGHT_FONT * MAX_WIDTH_FONT * 2 + OFFSET_BITMAP] = {0};
+/* One display line of the expanded glyph pixels */
+static uint16_t LineBuffer[LINE_BUFFER_SIZE];
 
 
 /* @defgroup STM32_ADAFRUIT_LCD_Private_FunctionPrototypes */ 
-static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint32_t bit_start, const uint32_t scale);
+static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t Ascii, const uint32_t scale);
+static uint16_t* ExpandGlyphLine(uint16_t *pLine, const uint8_t Ascii, const uint32_t line, const uint32_t scale);
 static void SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
   
 /**
@@ -264,12 +264,51 @@ void BSP_LCD_ClearStringLine(uint16_t Line)
   */
 void BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii, uint32_t scale)
 {
-	DrawChar(
-		Xpos,
-		Ypos,
-		(uint32_t)(Ascii - ' ') * DrawProp.pFont->Height * DrawProp.pFont->Width,
-		scale
-	);
+	DrawChar(Xpos, Ypos, Ascii, scale);
+}
+
+/**
+  * @brief  Displays characters in one display window (text run).
+  *         All the glyphs of the line are expanded into the line buffer
+  *         and sent with one RAMWR sequence, the run is split only
+  *         if it is longer than the line buffer.
+  * @param  Xpos: X position of the first character (in pixel)
+  * @param  Ypos: Y position of the characters top (in pixel)
+  * @param  Text: Characters
+  * @param  Len: Characters count
+  * @param  scale: Characters scale
+  * @retval None
+  */
+void BSP_LCD_DisplayStringRun(uint16_t Xpos, uint16_t Ypos, const char *Text, uint32_t Len, uint32_t scale)
+{
+  uint32_t char_height = DrawProp.pFont->Height;
+  uint32_t char_width  = DrawProp.pFont->Width;
+  uint32_t glyph_width = char_width * scale;
+
+  if(!scale || !Len || glyph_width > LINE_BUFFER_SIZE)
+    return;
+
+  uint32_t run_len = LINE_BUFFER_SIZE / glyph_width;
+  while(Len)
+  {
+    uint32_t count = (Len < run_len) ? Len : run_len;
+    uint32_t run_width = count * glyph_width;
+
+    SetDisplayWindow(Xpos, Ypos, run_width, char_height * scale);
+
+    for(uint32_t counterh = 0; counterh < char_height; counterh++)
+    {
+      uint16_t *pLine = LineBuffer;
+      for(uint32_t c = 0; c < count; c++)
+        pLine = ExpandGlyphLine(pLine, (uint8_t)Text[c], counterh, scale);
+      for(uint32_t i = 0; i < scale; i++)
+        lcd_drv->WriteWindow(LineBuffer, run_width, counterh || i);
+    }
+
+    Text += count;
+    Len  -= count;
+    Xpos += run_width;
+  }
 }
 
 /**
@@ -822,76 +861,53 @@ void BSP_LCD_DisplayOff(void)
 
 /**
   * @brief  Draws a character on LCD.
+  *         The glyph lines are expanded and scaled into the line buffer
+  *         and streamed into one display window.
   * @param  Xpos: Line where to display the character shape
   * @param  Ypos: Start column address
-  * @param  pChar: Pointer to the character data
+  * @param  Ascii: Character code
+  * @param  scale: Character scale
   * @retval None
   */
-static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint32_t bit_start, const uint32_t scale)
+static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t Ascii, const uint32_t scale)
+{
+  uint32_t char_height = DrawProp.pFont->Height;
+  uint32_t char_width  = DrawProp.pFont->Width;
+  uint32_t real_width  = char_width * scale;
+
+  if(!scale || real_width > LINE_BUFFER_SIZE)
+    return;
+
+  SetDisplayWindow(Xpos, Ypos, real_width, char_height * scale);
+
+  for(uint32_t counterh = 0; counterh < char_height; counterh++)
+  {
+    ExpandGlyphLine(LineBuffer, Ascii, counterh, scale);
+    for(uint32_t i = 0; i < scale; i++)
+      lcd_drv->WriteWindow(LineBuffer, real_width, counterh || i);
+  }
+}
+
+/**
+  * @brief  Expands one line of the font glyph to the text and back colors.
+  * @param  pLine: Output pixels (font width * scale)
+  * @param  Ascii: Character code
+  * @param  line: Glyph line
+  * @param  scale: Horizontal scale
+  * @retval Next pixel after the expanded line
+  */
+static uint16_t* ExpandGlyphLine(uint16_t *pLine, const uint8_t Ascii, const uint32_t line, const uint32_t scale)
 {
-	uint32_t char_height = DrawProp.pFont->Height;
-	uint32_t char_width  = DrawProp.pFont->Width;
-
-	uint32_t real_height = 0;
-	uint32_t real_width  = 0;
-
-	unsigned count = 0;
-	for (; count < scale; count++) {
-		real_height += char_height ;
-		real_width  += char_width;
-		if (real_height > MAX_HEIGHT_FONT || real_width > MAX_WIDTH_FONT) {
-			real_height -= char_height;
-			real_width  -= char_width;
-			break;
-		}
-	}
-
-	memset(bitmap, 0, real_height * real_width);
-
-	/* Fill bitmap header*/
-	*(uint16_t *) (bitmap + 2) = (uint16_t)(real_height*real_width*2+OFFSET_BITMAP);
-	*(uint16_t *) (bitmap + 4) = (uint16_t)((real_height*real_width*2+OFFSET_BITMAP)>>16);
-	*(uint16_t *) (bitmap + 10) = OFFSET_BITMAP;
-	*(uint16_t *) (bitmap + 18) = (uint16_t)(real_width);
-	*(uint16_t *) (bitmap + 20) = (uint16_t)((real_width)>>16);
-	*(uint16_t *) (bitmap + 22) = (uint16_t)(real_height);
-	*(uint16_t *) (bitmap + 24) = (uint16_t)((real_height)>>16);
-
-	for(uint32_t counterh = 0; counterh < char_height; counterh++)
-	{
-		uint32_t bit_num = bit_start + (uint32_t)char_width * counterh;
-		uint8_t line[MAX_WIDTH_FONT] = {0,};
-		for (uint32_t i = 0; i < char_width; i++) {
-			uint8_t pix = (((DrawProp.pFont->table[bit_num / 8] >> (7 - bit_num % 8)) & 0x01));
-			for (uint32_t j = 0; j < count; j++) {
-				line[real_width - i * count - j] = pix;
-			}
-			bit_num++;
-		}
-
-		for (uint32_t counterw = 0; counterw < real_width; counterw++)
-		{
-			/* Image in the bitmap is written from the bottom to the top */
-			/* Need to invert image in the bitmap */
-			uint32_t index = (((real_height - counterh * count - 1) * real_width) + (counterw)) * 2 + OFFSET_BITMAP;
-			if(line[real_width - counterw]) {
-				bitmap[index]     = (uint8_t)DrawProp.TextColor;
-				bitmap[index + 1] = (uint8_t)(DrawProp.TextColor >> 8);
-			} else {
-				bitmap[index]     = (uint8_t)DrawProp.BackColor;
-				bitmap[index + 1] = (uint8_t)(DrawProp.BackColor >> 8);
-			}
-		}
-
-		for (uint32_t i = 1; i < count; i++) {
-			memcpy(
-				&bitmap[(((real_height - counterh * count + i - 1) * real_width)) * 2 + OFFSET_BITMAP],
-				&bitmap[(((real_height - counterh * count - 1) * real_width)) * 2 + OFFSET_BITMAP],
-				real_width * 2
-			);
-		}
-	}
-	BSP_LCD_DrawBitmap(Xpos, Ypos, bitmap);
+  uint32_t bits = FONT_GetGlyphLine(DrawProp.pFont, Ascii, line);
+  for(uint32_t mask = 1UL << (DrawProp.pFont->Width - 1); mask; mask >>= 1)
+  {
+    uint16_t color = (bits & mask) ?
+      DrawProp.TextColor :
+      DrawProp.BackColor;
+    for(uint32_t j = 0; j < scale; j++)
+      *pLine++ = color;
+  }
+  return pLine;
 }
 
 /**
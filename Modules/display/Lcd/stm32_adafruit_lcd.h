@@ -59,8 +59,8 @@
 //-----------------------------------------------------------------------------
 /* Config section (you can change this defines) */
 
-/* LCD default font (Font8 or Font12 or Font16 or Font20 or Font24) */
-#define LCD_DEFAULT_FONT         Font8
+/* LCD default font (one of the fonts.h fonts) */
+#define LCD_DEFAULT_FONT         u8g2_font_8x13_t_cyrillic
 
 /* LCD default colors */
 #define LCD_DEFAULT_BACKCOLOR    LCD_COLOR_BLACK
@@ -151,6 +151,7 @@ void     BSP_LCD_ClearStringLine(uint16_t Line);
 void     BSP_LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr);
 void     BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Line_ModeTypdef Mode);
 void     BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii, uint32_t scale);
+void     BSP_LCD_DisplayStringRun(uint16_t Xpos, uint16_t Ypos, const char *Text, uint32_t Len, uint32_t scale);
 
 void     BSP_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint16_t RGB_Code);
 void     BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length);
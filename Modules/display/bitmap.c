@@ -1,447 +0,0 @@
-/* Copyright © 2024 Georgy E. All rights reserved. */
-
-
-#include <stdint.h>
-
-#include "bmp.h"
-#include "fonts.h"
-#include "display.h"
-
-
-#define BMP_UP_15x15_HEIGHT (15)
-#define BMP_UP_15x15_WIDTH  (15)
-#define _COLOR              (DISPLAY_COLOR_BLACK)
-#define _BCKGR              (DISPLAY_COLOR_WHITE)
-
-const BITMAPSTRUCT bmp_up_15x15 __attribute__((aligned)) =
-{
-	{
-		0x4d42u,
-		sizeof(BITMAPINFOHEADER) + sizeof(BITMAPFILEHEADER) + (BMP_UP_15x15_WIDTH * BMP_UP_15x15_HEIGHT * 2),
-		0x0000u,
-		0x0000u,
-		sizeof(BITMAPINFOHEADER) + sizeof(BITMAPFILEHEADER)
-	},
-	{
-		sizeof(BITMAPINFOHEADER),
-		BMP_UP_15x15_WIDTH,
-		BMP_UP_15x15_HEIGHT,
-		1u,
-		16,
-		0x00000003u,
-		(BMP_UP_15x15_WIDTH * BMP_UP_15x15_HEIGHT),
-		0x00000000ul,
-		0x00000000ul,
-		0x00000000ul,
-		0x00000000ul
-	},
-	{
-		_COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR,
-		_COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR,
-		_BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR,
-		_BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR,
-		_BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _COLOR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR
-	}
-};
-
-#undef _COLOR
-
-
-#define BMP_DOWN_15x15_HEIGHT (15)
-#define BMP_DOWN_15x15_WIDTH  (15)
-#define _COLOR                (DISPLAY_COLOR_BLACK)
-
-const BITMAPSTRUCT bmp_down_15x15 __attribute__((aligned)) =
-{
-	{
-		0x4d42u,
-		sizeof(BITMAPINFOHEADER) + sizeof(BITMAPFILEHEADER) + (BMP_UP_15x15_WIDTH * BMP_UP_15x15_HEIGHT * 2),
-		0x0000u,
-		0x0000u,
-		sizeof(BITMAPINFOHEADER) + sizeof(BITMAPFILEHEADER)
-	},
-	{
-		sizeof(BITMAPINFOHEADER),
-		BMP_UP_15x15_WIDTH,
-		BMP_UP_15x15_HEIGHT,
-		1u,
-		16,
-		0x00000003u,
-		(BMP_UP_15x15_WIDTH * BMP_UP_15x15_HEIGHT),
-		0x00000000ul,
-		0x00000000ul,
-		0x00000000ul,
-		0x00000000ul
-	},
-	{
-		_BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _COLOR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR,
-		_BCKGR, _BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR, _BCKGR,
-		_BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR,
-		_BCKGR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _BCKGR,
-		_COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR,
-		_COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR, _COLOR
-	}
-};
-
-#undef _COLOR
-
-
-const uint8_t settings_bitmap_table[] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0xC0, 0xC0, 0x30, 0x00, 0x01, 0xE0, 0x60, 0x18, 0x1E,
-    0x00, 0x00, 0xC6, 0x70, 0x03, 0x98, 0xC0, 0x00, 0x60, 0xE0,
-    0x00, 0x1C, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0xE0,
-    0x00, 0x20, 0x00, 0x20, 0x03, 0x87, 0x00, 0x10, 0x00, 0x0C,
-    0x03, 0x80, 0x70, 0x0C, 0x00, 0x01, 0x01, 0x80, 0x06, 0x02,
-    0x00, 0x00, 0x40, 0x80, 0x00, 0x40, 0x80, 0x00, 0x20, 0x40,
-    0x00, 0x08, 0x10, 0x00, 0x08, 0x30, 0x00, 0x03, 0x04, 0x00,
-    0x06, 0x08, 0x00, 0x00, 0x41, 0x80, 0x07, 0x06, 0x00, 0x00,
-    0x18, 0x38, 0x0F, 0x81, 0x00, 0x00, 0x02, 0x07, 0xC6, 0x00,
-    0x40, 0x00, 0x00, 0x40, 0x19, 0x00, 0x20, 0x00, 0x00, 0x10,
-    0x02, 0x40, 0x08, 0x00, 0x00, 0x04, 0x00, 0x90, 0x02, 0x00,
-    0x00, 0x01, 0x00, 0x24, 0x00, 0x80, 0x00, 0x00, 0x40, 0x09,
-    0x80, 0x10, 0x00, 0x00, 0x10, 0x06, 0x3E, 0x04, 0x00, 0x00,
-    0x08, 0x1F, 0x01, 0xC1, 0x80, 0x00, 0x02, 0x0E, 0x00, 0x18,
-    0x20, 0x00, 0x01, 0x06, 0x00, 0x02, 0x0C, 0x00, 0x00, 0xC1,
-    0x00, 0x00, 0x81, 0x00, 0x00, 0x20, 0x40, 0x00, 0x10, 0x20,
-    0x00, 0x10, 0x20, 0x00, 0x04, 0x06, 0x00, 0x18, 0x08, 0x00,
-    0x03, 0x00, 0xE0, 0x0C, 0x03, 0x00, 0x00, 0x80, 0x0E, 0x1C,
-    0x00, 0x40, 0x00, 0x40, 0x00, 0x78, 0x00, 0x08, 0x00, 0x30,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-    0xC0, 0x01, 0x83, 0x80, 0x00, 0x70, 0x60, 0x00, 0x31, 0x9C,
-    0x00, 0xE6, 0x30, 0x00, 0x07, 0xC1, 0x80, 0x60, 0x78, 0x00,
-    0x00, 0xC0, 0x30, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x0C,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x18, 0x60, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00
-};
-
-sFONT settings_bitmap = {
-	settings_bitmap_table,
-	50,
-	50
-};
-
-
-const uint8_t back_bitmap_table[] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x81, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x20, 0x40, 0x00, 0x38, 0x00, 0x00,
-    0x08, 0x10, 0x00, 0x1A, 0x00, 0x00, 0x02, 0x04, 0x00, 0x0C,
-    0x80, 0x00, 0x00, 0x81, 0x00, 0x06, 0x20, 0x00, 0x00, 0x20,
-    0x40, 0x03, 0x08, 0x00, 0x00, 0x08, 0x10, 0x01, 0x82, 0x00,
-    0x00, 0x02, 0x04, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x81, 0x00,
-    0x60, 0x00, 0x00, 0x30, 0x20, 0x40, 0x30, 0x00, 0x00, 0x04,
-    0x08, 0x10, 0x18, 0x00, 0x00, 0x00, 0x82, 0x04, 0x0C, 0x00,
-    0x00, 0x00, 0x20, 0x81, 0x01, 0x80, 0x00, 0x00, 0x08, 0x20,
-    0x40, 0x30, 0x00, 0x00, 0x02, 0x08, 0x10, 0x06, 0x00, 0x00,
-    0x01, 0x02, 0x04, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x81, 0x00,
-    0x18, 0x1F, 0xFF, 0xC0, 0x20, 0x40, 0x03, 0x04, 0x00, 0x00,
-    0x08, 0x10, 0x00, 0x61, 0x00, 0x00, 0x02, 0x04, 0x00, 0x0C,
-    0x40, 0x00, 0x00, 0x81, 0x00, 0x01, 0x90, 0x00, 0x00, 0x20,
-    0x40, 0x00, 0x34, 0x00, 0x00, 0x08, 0x10, 0x00, 0x07, 0x00,
-    0x00, 0x02, 0x04, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x81, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x01, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00
-};
-
-sFONT back_bitmap = {
-	back_bitmap_table,
-	50,
-	50
-};
-
-
-const uint8_t save_bitmap_table[] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0C, 0x00, 0x80, 0x00,
-    0x46, 0x00, 0x06, 0x00, 0x20, 0x00, 0x10, 0xC0, 0x01, 0x00,
-    0x08, 0x00, 0x04, 0x18, 0x00, 0x40, 0x02, 0x00, 0x01, 0x03,
-    0x00, 0x10, 0x00, 0x80, 0x00, 0x40, 0x60, 0x04, 0x00, 0x20,
-    0x00, 0x10, 0x0C, 0x01, 0x00, 0x08, 0x00, 0x04, 0x01, 0x80,
-    0x40, 0x02, 0x00, 0x01, 0x00, 0x30, 0x10, 0x00, 0x80, 0x00,
-    0x40, 0x06, 0x04, 0x00, 0x20, 0x00, 0x10, 0x00, 0x81, 0x00,
-    0x08, 0x00, 0x04, 0x00, 0x20, 0x40, 0x03, 0x00, 0x03, 0x00,
-    0x08, 0x10, 0x00, 0x60, 0x01, 0x80, 0x02, 0x04, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x20, 0x40, 0x60, 0x00, 0x00, 0x18,
-    0x08, 0x10, 0x10, 0x00, 0x00, 0x03, 0x02, 0x04, 0x0C, 0x00,
-    0x00, 0x00, 0x40, 0x81, 0x02, 0x00, 0x00, 0x00, 0x10, 0x20,
-    0x40, 0x80, 0x00, 0x00, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00,
-    0x01, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x40, 0x81, 0x02,
-    0x00, 0x00, 0x00, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x04,
-    0x08, 0x10, 0x20, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x00,
-    0x00, 0x00, 0x40, 0x81, 0x02, 0x00, 0x00, 0x00, 0x10, 0x20,
-    0x40, 0x80, 0x00, 0x00, 0x04, 0x08, 0x18, 0x20, 0x00, 0x00,
-    0x01, 0x06, 0x03, 0x08, 0x00, 0x00, 0x00, 0x43, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00
-};
-
-sFONT save_bitmap = {
-	save_bitmap_table,
-	50,
-	50
-};
-
-
-const uint8_t surface_bitmap_table[] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x71,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xC3, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x20,
-    0x40, 0x80, 0x00, 0x00, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00,
-    0x01, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x40, 0x81, 0x02,
-    0x00, 0x00, 0x00, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x04,
-    0x08, 0x10, 0x20, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x00,
-    0x00, 0x00, 0x40, 0x81, 0x02, 0x00, 0x00, 0x00, 0x10, 0x20,
-    0x40, 0x80, 0x00, 0x00, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00,
-    0x01, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x40, 0x81, 0x02,
-    0x00, 0x00, 0x00, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x04,
-    0x08, 0x10, 0x20, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x00,
-    0x00, 0x00, 0x40, 0x81, 0x82, 0x00, 0x00, 0x00, 0x10, 0x60,
-    0x31, 0x80, 0x00, 0x00, 0x06, 0x30, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x40, 0x10,
-    0x04, 0x02, 0x80, 0xA0, 0x28, 0x0A, 0x02, 0x01, 0x10, 0x44,
-    0x11, 0x04, 0x41, 0x00, 0x82, 0x20, 0x88, 0x22, 0x08, 0x80,
-    0x40, 0x50, 0x14, 0x05, 0x01, 0x40, 0x20, 0x08, 0x02, 0x00,
-    0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00
-};
-
-sFONT surface_bitmap = {
-	surface_bitmap_table,
-	50,
-	50
-};
-
-
-const uint8_t string_bitmap_table[] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x71,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xC3, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x20,
-    0x40, 0x80, 0x00, 0x00, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00,
-    0x01, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x40, 0x81, 0x02,
-    0x00, 0x1E, 0x00, 0x10, 0x20, 0x40, 0x80, 0x18, 0x60, 0x04,
-    0x08, 0x10, 0x20, 0x04, 0x08, 0x01, 0x02, 0x04, 0x08, 0x02,
-    0x01, 0x00, 0x40, 0x81, 0x02, 0x00, 0x80, 0x40, 0x10, 0x20,
-    0x40, 0x80, 0x20, 0x10, 0x04, 0x08, 0x10, 0x20, 0x08, 0x04,
-    0x01, 0x02, 0x04, 0x08, 0x01, 0x02, 0x00, 0x40, 0x81, 0x02,
-    0x00, 0x61, 0x80, 0x10, 0x20, 0x40, 0x80, 0x07, 0x80, 0x04,
-    0x08, 0x10, 0x20, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x00,
-    0x00, 0x00, 0x40, 0x81, 0x82, 0x00, 0x00, 0x00, 0x10, 0x60,
-    0x31, 0x80, 0x00, 0x00, 0x06, 0x30, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00
-};
-
-sFONT string_bitmap = {
-	string_bitmap_table,
-	50,
-	50
-};
-
-
-const uint8_t bigski_bitmap_table[] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x71,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xC3, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x20,
-    0x40, 0x80, 0x00, 0x00, 0x04, 0x08, 0x10, 0x20, 0x03, 0xF0,
-    0x01, 0x02, 0x04, 0x08, 0x01, 0x02, 0x00, 0x40, 0x81, 0x02,
-    0x00, 0x80, 0x40, 0x10, 0x20, 0x40, 0x80, 0x20, 0x10, 0x04,
-    0x08, 0x10, 0x20, 0x00, 0x02, 0x01, 0x02, 0x04, 0x08, 0x00,
-    0x01, 0x00, 0x40, 0x81, 0x02, 0x00, 0x00, 0x40, 0x10, 0x20,
-    0x40, 0x80, 0x00, 0x20, 0x04, 0x08, 0x10, 0x20, 0x03, 0xF0,
-    0x01, 0x02, 0x04, 0x08, 0x00, 0x02, 0x00, 0x40, 0x81, 0x02,
-    0x00, 0x00, 0x40, 0x10, 0x20, 0x40, 0x80, 0x00, 0x10, 0x04,
-    0x08, 0x10, 0x20, 0x00, 0x02, 0x01, 0x02, 0x04, 0x08, 0x02,
-    0x01, 0x00, 0x40, 0x81, 0x82, 0x00, 0x80, 0x40, 0x10, 0x60,
-    0x31, 0x80, 0x10, 0x20, 0x06, 0x30, 0x07, 0xC0, 0x03, 0xF0,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00
-};
-
-sFONT bigski_bitmap = {
-	bigski_bitmap_table,
-	50,
-	50
-};
-
-
-const uint8_t left_bitmap_table[] = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
-	0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-	0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-	0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-	0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-	0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-	0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-	0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-	0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF,
-	0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-	0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF,
-	0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00,
-	0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF,
-	0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-	0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-	0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-	0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-	0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-	0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-	0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00
-};
-
-sFONT left_bitmap = {
-	left_bitmap_table,
-	50,
-	50
-};
-
-
-const uint8_t right_bitmap_table[] = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F,
-	0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-	0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-	0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-	0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-	0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80,
-	0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-	0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F,
-	0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE,
-	0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-	0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-	0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE,
-	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-	0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00,
-	0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-	0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-	0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00
-};
-
-sFONT right_bitmap = {
-	right_bitmap_table,
-	50,
-	50
-};
@@ -3,19 +3,167 @@
 #include "display.h"
 
 #include <stdint.h>
+#include <stddef.h>
+#include <string.h>
 
 #include "cmsis_gcc.h"
 
+#include "system.h"
 #include "bmacro.h"
 #include "hal_defs.h"
+#include "lcd_mirror.h"
 #include "stm32_adafruit_lcd.h"
 
 
+/* Bytes of the widest 4 bpp icon row */
+#define DISPLAY_ICON_ROW_SIZE ((uint16_t)(DISPLAY_WIDTH / 2))
+/* Pixels of one DMA transfer (DMA_MAXSIZE of lcd_io_spi.c) */
+#define DISPLAY_TRANSFER_MAX  ((uint32_t)0xFFFE)
+/* Probe tiles grid of the display self-check */
+#define DISPLAY_PROBES_X      (4)
+#define DISPLAY_PROBES_Y      (4)
+#define DISPLAY_PROBES_COUNT  (DISPLAY_PROBES_X * DISPLAY_PROBES_Y)
+#define DISPLAY_PROBE_SIZE    ((uint16_t)8)
+
+
+/* PackBits decoder of the icon data */
+typedef struct _display_rle_t {
+	const uint8_t* data;
+	const uint8_t* end;
+	uint8_t        count;
+	bool           repeat;
+	uint8_t        value;
+} display_rle_t;
+
+typedef struct _display_layer_t {
+	uint16_t              x;
+	uint16_t              y;
+	uint16_t              w;
+	uint16_t              h;
+	uint16_t              color;
+	/* The layer is filled if there are no font and icon */
+	sFONT*                font;
+	const char*           text;
+	uint32_t              scale;
+	const display_icon_t* icon;
+	const uint16_t*       palette;
+	display_rle_t         rle;
+	uint16_t              next_row;
+} display_layer_t;
+
+typedef enum _DISPLAY_COMMAND {
+	DISPLAY_COMMAND_FILL = 1,
+	DISPLAY_COMMAND_GLYPHS,
+	DISPLAY_COMMAND_ICON
+} DISPLAY_COMMAND;
+
+typedef struct _display_command_t {
+	uint8_t  type;
+	uint16_t x;
+	uint16_t y;
+	uint16_t w;
+	uint16_t h;
+	/* Sent rows of the glyph run and the icon, 1 for the started fill */
+	uint16_t progress;
+	uint32_t time_us;
+	union {
+		uint16_t color;
+		struct {
+			const sFONT* font;
+			uint16_t     color;
+			uint16_t     background;
+			uint8_t      scale;
+			uint8_t      len;
+			char         text[DISPLAY_QUEUE_TEXT_SIZE];
+		} glyphs;
+		struct {
+			const display_icon_t* icon;
+			display_rle_t         rle;
+			uint16_t              palette[DISPLAY_QUEUE_PALETTE_SIZE];
+		} icon;
+	};
+} display_command_t;
+
+
+extern volatile uint32_t LCD_IO_DmaTransferStatus;
+extern volatile uint32_t LCD_IO_DmaTxNoWait;
+extern void LCD_IO_DmaTxIrqMask(uint32_t mask);
+extern LCD_DrvTypeDef* lcd_drv;
+
+static display_transfer_callback_t display_transfer_callback = NULL;
+
+static struct {
+	uint16_t                x;
+	uint16_t                y;
+	uint16_t                w;
+	uint16_t                h;
+	display_layer_t         layers[DISPLAY_LAYERS_MAX];
+	unsigned                count;
+	display_compose_stats_t stats;
+} display_compose = {0};
+
+/*
+ * The commands are added by the main loop and executed by the DMA interrupt,
+ * the queue is not empty until the end of the last command transfer
+ */
+static struct {
+	display_command_t     commands[DISPLAY_QUEUE_SIZE];
+	unsigned              head;
+	unsigned              tail;
+	volatile unsigned     count;
+	display_queue_stats_t stats;
+} display_queue = {0};
+
+/*
+ * The probe tile color is known if the last drawing over the tile
+ * has been a fill of the whole tile, the display RAM is checked by the tile center pixel
+ */
+static struct {
+	struct {
+		uint16_t color;
+		bool     known;
+	} tiles[DISPLAY_PROBES_COUNT];
+	unsigned                next;
+	display_refresh_stats_t stats;
+} display_probes = {0};
+
+/* Composition strip, the queue uses it for the glyph runs and icons */
+static uint16_t display_strip[DISPLAY_STRIP_SIZE] = {0};
+
+
+static void _display_align(uint16_t* x, uint16_t* y, const uint16_t w, const uint16_t h, DISPLAY_ALIGN_MODE mode);
+static void _display_text_position(
+	uint16_t* x,
+	uint16_t* y,
+	const sFONT* font,
+	DISPLAY_ALIGN_MODE mode,
+	const unsigned len,
+	const uint32_t scale
+);
+static display_layer_t* _display_compose_add();
+static void _display_compose_layer(display_layer_t* layer, const uint16_t top, const uint16_t rows);
+static bool _display_icon_valid(const display_icon_t* icon);
+static void _display_rle_init(display_rle_t* rle, const display_icon_t* icon);
+static uint8_t _display_rle_next(display_rle_t* rle);
+static void _display_icon_row(display_rle_t* rle, const display_icon_t* icon, uint8_t* row);
+static uint8_t _display_icon_index(const uint8_t* row, const uint8_t bpp, const uint16_t x);
+static void _display_queue_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+static void _display_queue_push(display_command_t* command);
+static void _display_queue_run();
+static bool _display_command_step(display_command_t* command);
+static void _display_command_rows(display_command_t* command, const uint16_t rows);
+static void _display_probe_tile(const unsigned index, uint16_t* x, uint16_t* y);
+static void _display_probes_draw(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const bool fill, const uint16_t color);
+
 
 void display_init()
 {
+#if LCD_MIRROR
+	lcd_mirror_init();
+#endif
 	BSP_LCD_Init();
 	BSP_LCD_Clear(DISPLAY_COLOR_WHITE);
+	_display_probes_draw(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, true, DISPLAY_COLOR_WHITE);
 }
 
 uint16_t display_height()
@@ -30,7 +178,7 @@ uint16_t display_width()
 
 void display_clear()
 {
-	BSP_LCD_Clear(DISPLAY_COLOR_WHITE);
+	_display_queue_fill(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, DISPLAY_COLOR_WHITE);
 }
 
 void display_clear_header()
@@ -55,25 +203,30 @@ void display_clear_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 
 void display_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
 {
-    BSP_LCD_SetTextColor(color);
-    BSP_LCD_FillRect(x, y, w, h);
+    _display_queue_fill(x, y, w, h, color);
 }
 
 void display_sections_show()
 {
+    display_queue_wait();
+
     BSP_LCD_SetTextColor(DISPLAY_COLOR_BLACK);
 
     uint16_t y = (uint16_t)DISPLAY_HEADER_HEIGHT;
     BSP_LCD_DrawLine(0, y, DISPLAY_WIDTH, y);
+    _display_probes_draw(0, y, DISPLAY_WIDTH, 1, true, DISPLAY_COLOR_BLACK);
 
     y = DISPLAY_HEADER_HEIGHT + DISPLAY_CONTENT_HEIGHT;
     BSP_LCD_DrawLine(0, y, DISPLAY_WIDTH, y);
+    _display_probes_draw(0, y, DISPLAY_WIDTH, 1, true, DISPLAY_COLOR_BLACK);
 
     uint16_t x = DISPLAY_WIDTH / 3;
     BSP_LCD_DrawLine(x, y, x, DISPLAY_HEIGHT);
+    _display_probes_draw(x, y, 1, (uint16_t)(DISPLAY_HEIGHT - y), true, DISPLAY_COLOR_BLACK);
 
     x = 2 * DISPLAY_WIDTH / 3;
 	BSP_LCD_DrawLine(x, y, x, DISPLAY_HEIGHT);
+    _display_probes_draw(x, y, 1, (uint16_t)(DISPLAY_HEIGHT - y), true, DISPLAY_COLOR_BLACK);
 }
 
 void display_set_background(uint16_t color)
@@ -97,38 +250,695 @@ void display_text_show(
 ) {
     BSP_LCD_SetFont(font);
 
-    uint16_t tmp_x = x, tmp_y = y - font->Height * scale;
+    uint16_t tmp_x = x, tmp_y = y;
+    _display_text_position(&tmp_x, &tmp_y, font, mode, len, scale);
+
+    /* Characters of one glyph run command: the run row is in the strip */
+    unsigned run_len = 0;
+    if (scale && scale <= UINT8_MAX && font->Width && font->Width <= FONT_WIDTH_MAX) {
+        run_len = DISPLAY_STRIP_SIZE / (font->Width * scale);
+    }
+    if (run_len > DISPLAY_QUEUE_TEXT_SIZE) {
+        run_len = DISPLAY_QUEUE_TEXT_SIZE;
+    }
+    /* The glyph row is wider than the strip: the text is drawn by the driver */
+    if (!run_len) {
+        display_text_run(x, y, font, mode, text, len, scale);
+        return;
+    }
+
+    for (unsigned i = 0; i < len; i += run_len) {
+        display_command_t command = {0};
+        command.type              = DISPLAY_COMMAND_GLYPHS;
+        command.glyphs.len        = (uint8_t)(len - i < run_len ? len - i : run_len);
+        command.x                 = (uint16_t)(tmp_x + i * font->Width * scale);
+        command.y                 = tmp_y;
+        command.w                 = (uint16_t)(command.glyphs.len * font->Width * scale);
+        command.h                 = (uint16_t)(font->Height * scale);
+        command.glyphs.font       = font;
+        command.glyphs.color      = BSP_LCD_GetTextColor();
+        command.glyphs.background = BSP_LCD_GetBackColor();
+        command.glyphs.scale      = (uint8_t)scale;
+        memcpy(command.glyphs.text, &text[i], command.glyphs.len);
+        _display_queue_push(&command);
+    }
+
+    BSP_LCD_SetBackColor(DISPLAY_COLOR_WHITE);
+    BSP_LCD_SetTextColor(DISPLAY_DEFAULT_COLOR);
+}
+
+void display_text_run(
+	const uint16_t x,
+	const uint16_t y,
+	sFONT* font,
+	DISPLAY_ALIGN_MODE mode,
+	const char* text,
+	const unsigned len,
+	const uint32_t scale
+) {
+    display_queue_wait();
+
+    BSP_LCD_SetFont(font);
+
+    uint16_t tmp_x = x, tmp_y = y;
+    _display_text_position(&tmp_x, &tmp_y, font, mode, len, scale);
+
+    BSP_LCD_DisplayStringRun(tmp_x, tmp_y, text, len, scale);
+    _display_probes_draw(
+        tmp_x,
+        tmp_y,
+        (uint16_t)(len * font->Width * scale),
+        (uint16_t)(font->Height * scale),
+        false,
+        0
+    );
+
+    BSP_LCD_SetBackColor(DISPLAY_COLOR_WHITE);
+    BSP_LCD_SetTextColor(DISPLAY_DEFAULT_COLOR);
+}
 
+void display_draw_bitmap(uint16_t x, uint16_t y, const BITMAPSTRUCT* bmp)
+{
+	BEDUG_ASSERT(x + bmp->infoHeader.biWidth <= DISPLAY_WIDTH, "Bitmap x position is out of display size");
+	BEDUG_ASSERT(y + bmp->infoHeader.biHeight <= DISPLAY_HEIGHT, "Bitmap y position is out of display size");
+	display_queue_wait();
+	BSP_LCD_DrawBitmap(x, y, (uint8_t *)bmp);
+	_display_probes_draw(x, y, (uint16_t)bmp->infoHeader.biWidth, (uint16_t)bmp->infoHeader.biHeight, false, 0);
+}
+
+void display_draw_icon(
+	const uint16_t x,
+	const uint16_t y,
+	DISPLAY_ALIGN_MODE mode,
+	const display_icon_t* icon,
+	const uint16_t* palette
+) {
+	if (!_display_icon_valid(icon)) {
+		return;
+	}
+	if (!palette) {
+		palette = icon->palette;
+	}
+
+	uint16_t tmp_x = x, tmp_y = y;
+	_display_align(&tmp_x, &tmp_y, icon->width, icon->height, mode);
+
+	if (icon->colors <= DISPLAY_QUEUE_PALETTE_SIZE) {
+		display_command_t command = {0};
+		command.type      = DISPLAY_COMMAND_ICON;
+		command.x         = tmp_x;
+		command.y         = tmp_y;
+		command.w         = icon->width;
+		command.h         = icon->height;
+		command.icon.icon = icon;
+		memcpy(command.icon.palette, palette, icon->colors * sizeof(uint16_t));
+		_display_rle_init(&command.icon.rle, icon);
+		_display_queue_push(&command);
+		return;
+	}
+
+	display_queue_wait();
+
+	display_rle_t rle;
+	_display_rle_init(&rle, icon);
+	uint8_t row[DISPLAY_ICON_ROW_SIZE];
+	uint16_t rows = DISPLAY_STRIP_SIZE / icon->width;
+
+	_display_probes_draw(tmp_x, tmp_y, icon->width, icon->height, false, 0);
+
+	lcd_drv->SetDisplayWindow(tmp_x, tmp_y, icon->width, icon->height);
+	for (uint16_t top = 0; top < icon->height; top += rows) {
+		uint16_t strip_rows = (uint16_t)(icon->height - top < rows ? icon->height - top : rows);
+		uint16_t* pixel = display_strip;
+		for (uint16_t i = 0; i < strip_rows; i++) {
+			_display_icon_row(&rle, icon, row);
+			for (uint16_t col = 0; col < icon->width; col++) {
+				*pixel++ = palette[_display_icon_index(row, icon->bpp, col)];
+			}
+		}
+		lcd_drv->WriteWindow(display_strip, (uint32_t)icon->width * strip_rows, top != 0);
+	}
+}
+
+void display_scroll(int16_t scroll, uint16_t top_fix, uint16_t bottom_fix)
+{
+	display_queue_wait();
+	BSP_LCD_Scroll(scroll, top_fix, bottom_fix);
+}
+
+void display_compose_begin(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	BEDUG_ASSERT(w && w <= DISPLAY_STRIP_SIZE, "Composition region is wider than the strip");
+	display_compose.x     = x;
+	display_compose.y     = y;
+	display_compose.w     = w;
+	display_compose.h     = h;
+	display_compose.count = 0;
+}
+
+void display_compose_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+	display_layer_t* layer = _display_compose_add();
+	if (!layer) {
+		return;
+	}
+	layer->x     = x;
+	layer->y     = y;
+	layer->w     = w;
+	layer->h     = h;
+	layer->color = color;
+}
+
+void display_compose_text(
+	const uint16_t x,
+	const uint16_t y,
+	sFONT* font,
+	DISPLAY_ALIGN_MODE mode,
+	const char* text,
+	const unsigned len,
+	const uint32_t scale,
+	const uint16_t color
+) {
+	if (!scale || !len) {
+		return;
+	}
+	display_layer_t* layer = _display_compose_add();
+	if (!layer) {
+		return;
+	}
+
+	uint16_t tmp_x = x, tmp_y = y;
+	_display_text_position(&tmp_x, &tmp_y, font, mode, len, scale);
+
+	layer->x     = tmp_x;
+	layer->y     = tmp_y;
+	layer->w     = (uint16_t)(len * font->Width * scale);
+	layer->h     = (uint16_t)(font->Height * scale);
+	layer->color = color;
+	layer->font  = font;
+	layer->text  = text;
+	layer->scale = scale;
+}
+
+void display_compose_icon(
+	const uint16_t x,
+	const uint16_t y,
+	DISPLAY_ALIGN_MODE mode,
+	const display_icon_t* icon,
+	const uint16_t* palette
+) {
+	if (!_display_icon_valid(icon)) {
+		return;
+	}
+	display_layer_t* layer = _display_compose_add();
+	if (!layer) {
+		return;
+	}
+
+	uint16_t tmp_x = x, tmp_y = y;
+	_display_align(&tmp_x, &tmp_y, icon->width, icon->height, mode);
+
+	layer->x       = tmp_x;
+	layer->y       = tmp_y;
+	layer->w       = icon->width;
+	layer->h       = icon->height;
+	layer->icon    = icon;
+	layer->palette = palette ? palette : icon->palette;
+	_display_rle_init(&layer->rle, icon);
+}
+
+void display_compose_end()
+{
+	uint16_t rows = display_compose.w ? DISPLAY_STRIP_SIZE / display_compose.w : 0;
+	if (!rows || !display_compose.h) {
+		display_compose.count = 0;
+		return;
+	}
+
+	display_queue_wait();
+
+	_display_probes_draw(display_compose.x, display_compose.y, display_compose.w, display_compose.h, false, 0);
+
+	lcd_drv->SetDisplayWindow(display_compose.x, display_compose.y, display_compose.w, display_compose.h);
+
+	uint16_t bottom = (uint16_t)(display_compose.y + display_compose.h);
+	for (uint16_t top = display_compose.y; top < bottom; top += rows) {
+		uint16_t strip_rows = (uint16_t)(bottom - top < rows ? bottom - top : rows);
+		uint32_t size = (uint32_t)display_compose.w * strip_rows;
+
+		for (uint32_t i = 0; i < size; i++) {
+			display_strip[i] = DISPLAY_COLOR_WHITE;
+		}
+		for (unsigned i = 0; i < display_compose.count; i++) {
+			_display_compose_layer(&display_compose.layers[i], top, strip_rows);
+		}
+
+		lcd_drv->WriteWindow(display_strip, size, top != display_compose.y);
+		display_compose.stats.sent += size;
+	}
+
+	display_compose.count = 0;
+}
+
+const display_compose_stats_t* display_compose_stats()
+{
+	return &display_compose.stats;
+}
+
+void display_queue_wait()
+{
+	while (display_queue.count);
+}
+
+unsigned display_queue_depth()
+{
+	return display_queue.count;
+}
+
+const display_queue_stats_t* display_queue_stats()
+{
+	return &display_queue.stats;
+}
+
+bool display_refresh_config()
+{
+	display_queue_wait();
+	display_probes.stats.configs++;
+	return lcd_drv->Refresh() != 0;
+}
+
+bool display_refresh_check(unsigned count)
+{
+	display_queue_wait();
+
+	bool result = true;
+	for (unsigned i = 0; count && i < DISPLAY_PROBES_COUNT; i++) {
+		unsigned index = display_probes.next;
+		display_probes.next = (display_probes.next + 1) % DISPLAY_PROBES_COUNT;
+		if (!display_probes.tiles[index].known) {
+			continue;
+		}
+		count--;
+
+		uint16_t x = 0, y = 0;
+		_display_probe_tile(index, &x, &y);
+
+		uint16_t color = display_probes.tiles[index].color;
+		display_probes.stats.checked++;
+		if (lcd_drv->ReadPixel((uint16_t)(x + DISPLAY_PROBE_SIZE / 2), (uint16_t)(y + DISPLAY_PROBE_SIZE / 2)) == color) {
+			continue;
+		}
+
+		display_probes.stats.failed++;
+		_display_queue_fill(x, y, DISPLAY_PROBE_SIZE, DISPLAY_PROBE_SIZE, color);
+		result = false;
+	}
+
+	return result;
+}
+
+const display_refresh_stats_t* display_refresh_stats()
+{
+	return &display_probes.stats;
+}
+
+bool display_busy()
+{
+	return display_queue.count || LCD_IO_DmaTransferStatus != 0;
+}
+
+void display_set_transfer_callback(display_transfer_callback_t callback)
+{
+	display_transfer_callback = callback;
+}
+
+void LCD_IO_DmaTxCpltCallback(void)
+{
+	if (display_queue.count) {
+		_display_queue_run();
+	}
+	if (display_transfer_callback) {
+		display_transfer_callback();
+	}
+}
+
+/* Top left corner of the w x h rectangle by the align mode */
+void _display_align(uint16_t* x, uint16_t* y, const uint16_t w, const uint16_t h, DISPLAY_ALIGN_MODE mode)
+{
     switch (mode) {
     case DISPLAY_ALIGN_CENTER:
-    	tmp_x -= (uint16_t)((len * font->Width * scale) / 2);
-    	tmp_y -= (uint16_t)(font->Height * scale / 2);
+    	*x -= (uint16_t)(w / 2);
+    	*y -= (uint16_t)(h / 2);
     	break;
     case DISPLAY_ALIGN_LEFT:
     	break;
     case DISPLAY_ALIGN_RIGHT:
-    	tmp_x -= (uint16_t)(len * font->Width * scale);
+    	*x -= w;
     	break;
     default:
     	break;
     }
+}
 
-    for (unsigned i = 0; i < len; i++) {
-        BSP_LCD_DisplayChar(
-			(uint16_t)(tmp_x + i * font->Width * scale),
-			(uint16_t)(tmp_y + font->Height * scale),
-			(uint8_t)text[i],
-			scale
-        );
-    }
+/* Top left corner of the text by the align mode */
+void _display_text_position(
+	uint16_t* x,
+	uint16_t* y,
+	const sFONT* font,
+	DISPLAY_ALIGN_MODE mode,
+	const unsigned len,
+	const uint32_t scale
+) {
+	_display_align(
+		x,
+		y,
+		(uint16_t)(len * font->Width * scale),
+		(uint16_t)(font->Height * scale),
+		mode
+	);
+}
 
-    BSP_LCD_SetBackColor(DISPLAY_COLOR_WHITE);
-    BSP_LCD_SetTextColor(DISPLAY_DEFAULT_COLOR);
+display_layer_t* _display_compose_add()
+{
+	if (display_compose.count >= DISPLAY_LAYERS_MAX) {
+		BEDUG_ASSERT(false, "Composition layers overflow");
+		return NULL;
+	}
+	display_layer_t* layer = &display_compose.layers[display_compose.count++];
+	memset(layer, 0, sizeof(display_layer_t));
+	layer->scale = 1;
+	return layer;
 }
 
-void display_draw_bitmap(uint16_t x, uint16_t y, const BITMAPSTRUCT* bmp)
+/* Paints the layer part that is inside the strip rows */
+void _display_compose_layer(display_layer_t* layer, const uint16_t top, const uint16_t rows)
 {
-	BEDUG_ASSERT(x + bmp->infoHeader.biWidth <= DISPLAY_WIDTH, "Bitmap x position is out of display size");
-	BEDUG_ASSERT(y + bmp->infoHeader.biHeight <= DISPLAY_HEIGHT, "Bitmap y position is out of display size");
-	BSP_LCD_DrawBitmap(x, y, (uint8_t *)bmp);
+	uint16_t x0 = layer->x > display_compose.x ? layer->x : display_compose.x;
+	uint16_t x1 = (uint16_t)(layer->x + layer->w);
+	if (x1 > display_compose.x + display_compose.w) {
+		x1 = (uint16_t)(display_compose.x + display_compose.w);
+	}
+	uint16_t y0 = layer->y > top ? layer->y : top;
+	uint16_t y1 = (uint16_t)(layer->y + layer->h);
+	if (y1 > top + rows) {
+		y1 = (uint16_t)(top + rows);
+	}
+	if (x0 >= x1 || y0 >= y1) {
+		return;
+	}
+
+	display_compose.stats.painted += (uint32_t)(x1 - x0) * (y1 - y0);
+
+	for (uint16_t y = y0; y < y1; y++) {
+		uint16_t* pixel = &display_strip[(y - top) * display_compose.w + (x0 - display_compose.x)];
+
+		if (layer->icon) {
+			uint8_t row[DISPLAY_ICON_ROW_SIZE];
+			do {
+				_display_icon_row(&layer->rle, layer->icon, row);
+			} while (layer->next_row++ < y - layer->y);
+
+			for (uint16_t x = x0; x < x1; x++, pixel++) {
+				uint8_t index = _display_icon_index(row, layer->icon->bpp, (uint16_t)(x - layer->x));
+				if (index) {
+					*pixel = layer->palette[index];
+				}
+			}
+			continue;
+		}
+
+		if (!layer->font) {
+			for (uint16_t x = x0; x < x1; x++) {
+				*pixel++ = layer->color;
+			}
+			continue;
+		}
+
+		const sFONT* font = layer->font;
+		uint32_t glyph_row = (uint32_t)(y - layer->y) / layer->scale;
+		uint32_t char_index = (uint32_t)-1;
+		uint32_t bits = 0;
+		for (uint16_t x = x0; x < x1; x++, pixel++) {
+			uint32_t column = (uint32_t)(x - layer->x) / layer->scale;
+			if (column / font->Width != char_index) {
+				char_index = column / font->Width;
+				bits = FONT_GetGlyphLine(font, (uint8_t)layer->text[char_index], glyph_row);
+			}
+			if ((bits >> (font->Width - 1 - column % font->Width)) & 0x01) {
+				*pixel = layer->color;
+			}
+		}
+	}
+}
+
+bool _display_icon_valid(const display_icon_t* icon)
+{
+	if (!icon || !icon->width || !icon->height) {
+		BEDUG_ASSERT(false, "Icon is empty");
+		return false;
+	}
+	if (icon->width > DISPLAY_STRIP_SIZE || (icon->width * icon->bpp + 7) / 8 > DISPLAY_ICON_ROW_SIZE) {
+		BEDUG_ASSERT(false, "Icon is wider than the display");
+		return false;
+	}
+	return true;
+}
+
+void _display_rle_init(display_rle_t* rle, const display_icon_t* icon)
+{
+	rle->data   = icon->data;
+	rle->end    = icon->data + icon->size;
+	rle->count  = 0;
+	rle->repeat = false;
+	rle->value  = 0;
+}
+
+uint8_t _display_rle_next(display_rle_t* rle)
+{
+	while (!rle->count) {
+		if (rle->data >= rle->end) {
+			return 0;
+		}
+		uint8_t header = *rle->data++;
+		if (header < 128) {
+			rle->count  = (uint8_t)(header + 1);
+			rle->repeat = false;
+		} else if (header > 128) {
+			rle->count  = (uint8_t)(257 - header);
+			rle->repeat = true;
+			rle->value  = *rle->data++;
+		}
+	}
+	rle->count--;
+	return rle->repeat ? rle->value : *rle->data++;
+}
+
+void _display_icon_row(display_rle_t* rle, const display_icon_t* icon, uint8_t* row)
+{
+	uint16_t size = (uint16_t)((icon->width * icon->bpp + 7) / 8);
+	for (uint16_t i = 0; i < size; i++) {
+		row[i] = _display_rle_next(rle);
+	}
+}
+
+uint8_t _display_icon_index(const uint8_t* row, const uint8_t bpp, const uint16_t x)
+{
+	uint32_t bit = (uint32_t)x * bpp;
+	uint8_t mask = (uint8_t)((1 << bpp) - 1);
+	return (uint8_t)((row[bit >> 3] >> (8 - bpp - (bit & 0x07))) & mask);
+}
+
+/* Splits the fill by the DMA transfer size */
+void _display_queue_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+	if (!w || !h) {
+		return;
+	}
+	_display_probes_draw(x, y, w, h, true, color);
+
+	uint16_t rows = (uint16_t)(DISPLAY_TRANSFER_MAX / w);
+	for (uint16_t top = 0; top < h; top = (uint16_t)(top + rows)) {
+		display_command_t command = {0};
+		command.type  = DISPLAY_COMMAND_FILL;
+		command.x     = x;
+		command.y     = (uint16_t)(y + top);
+		command.w     = w;
+		command.h     = (uint16_t)(h - top < rows ? h - top : rows);
+		command.color = color;
+		_display_queue_push(&command);
+	}
+}
+
+/* Back-pressure: the full queue waits for the end of the oldest command */
+void _display_queue_push(display_command_t* command)
+{
+	/* The fills are checked by _display_queue_fill */
+	if (command->type != DISPLAY_COMMAND_FILL) {
+		_display_probes_draw(command->x, command->y, command->w, command->h, false, 0);
+	}
+
+	if (display_queue.count >= DISPLAY_QUEUE_SIZE) {
+		display_queue.stats.stalls++;
+		while (display_queue.count >= DISPLAY_QUEUE_SIZE);
+	}
+	/* The direct drawing transfer ends before the queue start */
+	while (!display_queue.count && LCD_IO_DmaTransferStatus);
+
+	command->progress = 0;
+	command->time_us  = system_micros();
+
+	/* The head slot is free: the DMA interrupt reads the commands from the tail up to the count */
+	memcpy(&display_queue.commands[display_queue.head], command, sizeof(display_command_t));
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	display_queue.head = (display_queue.head + 1) % DISPLAY_QUEUE_SIZE;
+	display_queue.count++;
+	if (display_queue.count > display_queue.stats.max_depth) {
+		display_queue.stats.max_depth = display_queue.count;
+	}
+	bool start = display_queue.count == 1;
+
+	__set_PRIMASK(primask);
+
+	/*
+	 * The empty queue has no transfer in progress, the first command is started here
+	 * with the DMA interrupt masked only: the interrupt of the started transfer continues the queue
+	 */
+	if (start) {
+		LCD_IO_DmaTxIrqMask(1);
+		_display_queue_run();
+		LCD_IO_DmaTxIrqMask(0);
+	}
+}
+
+/* Executes the commands until one of them starts a DMA transfer */
+void _display_queue_run()
+{
+	uint32_t no_wait = LCD_IO_DmaTxNoWait;
+	LCD_IO_DmaTxNoWait = 1;
+
+	while (display_queue.count) {
+		display_command_t* command = &display_queue.commands[display_queue.tail];
+		if (_display_command_step(command)) {
+			/* The driver without DMA has sent the part already */
+			if (LCD_IO_DmaTransferStatus) {
+				break;
+			}
+			continue;
+		}
+
+		uint32_t latency = system_micros() - command->time_us;
+		display_queue.stats.commands++;
+		display_queue.stats.last_latency_us   = latency;
+		display_queue.stats.total_latency_us += latency;
+		if (latency > display_queue.stats.max_latency_us) {
+			display_queue.stats.max_latency_us = latency;
+		}
+
+		display_queue.tail = (display_queue.tail + 1) % DISPLAY_QUEUE_SIZE;
+		display_queue.count--;
+	}
+
+	LCD_IO_DmaTxNoWait = no_wait;
+}
+
+/*
+ * Sends the next part of the command
+ * @retval true if the part has been sent (or its DMA transfer started), false if the command is done
+ */
+bool _display_command_step(display_command_t* command)
+{
+	switch (command->type) {
+	case DISPLAY_COMMAND_FILL:
+		if (command->progress) {
+			return false;
+		}
+		command->progress = 1;
+		lcd_drv->FillRect(command->x, command->y, command->w, command->h, command->color);
+		break;
+	case DISPLAY_COMMAND_GLYPHS:
+	case DISPLAY_COMMAND_ICON:
+	{
+		if (command->progress >= command->h) {
+			return false;
+		}
+		uint16_t rows = (uint16_t)(DISPLAY_STRIP_SIZE / command->w);
+		if (rows > command->h - command->progress) {
+			rows = (uint16_t)(command->h - command->progress);
+		}
+		_display_command_rows(command, rows);
+
+		bool next = command->progress != 0;
+		if (!next) {
+			lcd_drv->SetDisplayWindow(command->x, command->y, command->w, command->h);
+		}
+		command->progress = (uint16_t)(command->progress + rows);
+		lcd_drv->WriteWindow(display_strip, (uint32_t)command->w * rows, next);
+		break;
+	}
+	default:
+		BEDUG_ASSERT(false, "Unknown display command");
+		return false;
+	}
+
+	return true;
+}
+
+/* Expands the next rows of the glyph run or the icon into the strip */
+void _display_command_rows(display_command_t* command, const uint16_t rows)
+{
+	uint16_t* pixel = display_strip;
+
+	if (command->type == DISPLAY_COMMAND_ICON) {
+		const display_icon_t* icon = command->icon.icon;
+		uint8_t row[DISPLAY_ICON_ROW_SIZE];
+		for (uint16_t i = 0; i < rows; i++) {
+			_display_icon_row(&command->icon.rle, icon, row);
+			for (uint16_t col = 0; col < icon->width; col++) {
+				*pixel++ = command->icon.palette[_display_icon_index(row, icon->bpp, col)];
+			}
+		}
+		return;
+	}
+
+	const sFONT* font = command->glyphs.font;
+	for (uint16_t i = 0; i < rows; i++) {
+		uint32_t line = (uint32_t)(command->progress + i) / command->glyphs.scale;
+		for (unsigned c = 0; c < command->glyphs.len; c++) {
+			uint32_t bits = FONT_GetGlyphLine(font, (uint8_t)command->glyphs.text[c], line);
+			for (uint32_t mask = 1UL << (font->Width - 1); mask; mask >>= 1) {
+				uint16_t color = (bits & mask) ? command->glyphs.color : command->glyphs.background;
+				for (uint8_t j = 0; j < command->glyphs.scale; j++) {
+					*pixel++ = color;
+				}
+			}
+		}
+	}
+}
+
+/* Top left corner of the probe tile, the tiles are in the centers of the grid cells */
+void _display_probe_tile(const unsigned index, uint16_t* x, uint16_t* y)
+{
+	*x = (uint16_t)((2 * (index % DISPLAY_PROBES_X) + 1) * DISPLAY_WIDTH / (2 * DISPLAY_PROBES_X) - DISPLAY_PROBE_SIZE / 2);
+	*y = (uint16_t)((2 * (index / DISPLAY_PROBES_X) + 1) * DISPLAY_HEIGHT / (2 * DISPLAY_PROBES_Y) - DISPLAY_PROBE_SIZE / 2);
+}
+
+/* The fill of the whole tile sets its color, the other drawings over the tile make it unknown */
+void _display_probes_draw(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const bool fill, const uint16_t color)
+{
+	for (unsigned i = 0; i < DISPLAY_PROBES_COUNT; i++) {
+		uint16_t tile_x = 0, tile_y = 0;
+		_display_probe_tile(i, &tile_x, &tile_y);
+		if (x >= tile_x + DISPLAY_PROBE_SIZE || x + w <= tile_x ||
+			y >= tile_y + DISPLAY_PROBE_SIZE || y + h <= tile_y
+		) {
+			continue;
+		}
+		display_probes.tiles[i].known = fill &&
+			x <= tile_x && x + w >= tile_x + DISPLAY_PROBE_SIZE &&
+			y <= tile_y && y + h >= tile_y + DISPLAY_PROBE_SIZE;
+		display_probes.tiles[i].color = color;
+	}
 }
@@ -9,6 +9,8 @@ extern "C" {
 #endif
 
 
+#include <stdbool.h>
+
 #include "bmp.h"
 #include "fonts.h"
 #include "ili9341.h"
@@ -38,6 +40,29 @@ extern "C" {
 #define DISPLAY_DEFAULT_COLOR     DISPLAY_COLOR_WHITE
 
 
+/* Pixels of the composition strip buffer (1440 bytes of RAM) */
+#define DISPLAY_STRIP_SIZE        ((uint16_t)(DISPLAY_WIDTH * 3))
+#define DISPLAY_LAYERS_MAX        (8)
+
+/* Commands of the display queue */
+#define DISPLAY_QUEUE_SIZE         (16)
+/* Characters of one glyph run command, the longer texts take several commands */
+#define DISPLAY_QUEUE_TEXT_SIZE    (16)
+/* Colors of the queued icon, the icons with more colors are drawn at once */
+#define DISPLAY_QUEUE_PALETTE_SIZE (4)
+
+/* Hardware SPI clock dividers: 0=/2, 1=/4 .. 7=/256 */
+#define DISPLAY_SPI_DIVIDER_MAX    ((uint8_t)7)
+#define DISPLAY_SPI_DIVIDER_NONE   ((uint8_t)0xFF)
+
+/* Sleep Out to Display On time of the panel */
+#define DISPLAY_WAKE_MS            ((uint32_t)5)
+
+
+/* Called from the DMA interrupt when the display transfer has ended */
+typedef void (*display_transfer_callback_t)(void);
+
+
 typedef enum _DISPLAY_ALIGN_MODE
 {
 	DISPLAY_ALIGN_CENTER = 1,
@@ -46,14 +71,70 @@ typedef enum _DISPLAY_ALIGN_MODE
 } DISPLAY_ALIGN_MODE;
 
 
-extern sFONT settings_bitmap;
-extern sFONT back_bitmap;
-extern sFONT save_bitmap;
-extern sFONT surface_bitmap;
-extern sFONT string_bitmap;
-extern sFONT bigski_bitmap;
-extern sFONT left_bitmap;
-extern sFONT right_bitmap;
+/*
+ * Icon of 1/2/4 bits per pixel palette indexes: the rows are packed MSB first,
+ * padded to a byte and compressed with PackBits (see tools/icon_converter.py)
+ */
+typedef struct _display_icon_t {
+	uint16_t        width;
+	uint16_t        height;
+	uint8_t         bpp;
+	uint8_t         colors;
+	const uint16_t* palette;
+	const uint8_t*  data;
+	uint16_t        size;
+} display_icon_t;
+
+
+typedef struct _display_compose_stats_t {
+	/* Pixels of the layers (sent to the display without the composition) */
+	uint32_t painted;
+	/* Pixels sent to the display */
+	uint32_t sent;
+} display_compose_stats_t;
+
+
+typedef struct _display_queue_stats_t {
+	/* Executed commands */
+	uint32_t commands;
+	/* Commands that have waited for a free slot of the full queue */
+	uint32_t stalls;
+	uint32_t max_depth;
+	/* Time from the enqueue to the end of the command transfer */
+	uint32_t last_latency_us;
+	uint32_t max_latency_us;
+	uint64_t total_latency_us;
+} display_queue_stats_t;
+
+
+typedef struct _display_refresh_stats_t {
+	/* Probe pixels read back */
+	uint32_t checked;
+	/* Probe pixels with a wrong color (the probe tile has been filled again) */
+	uint32_t failed;
+	/* Panel configuration sends */
+	uint32_t configs;
+} display_refresh_stats_t;
+
+
+typedef struct _display_spi_t {
+	uint8_t  write_divider;
+	uint8_t  read_divider;
+	/* Pixel bytes per second of a fill at the write divider */
+	uint32_t bandwidth;
+} display_spi_t;
+
+
+extern const display_icon_t settings_icon;
+extern const display_icon_t back_icon;
+extern const display_icon_t save_icon;
+extern const display_icon_t surface_icon;
+extern const display_icon_t string_icon;
+extern const display_icon_t bigski_icon;
+extern const display_icon_t left_icon;
+extern const display_icon_t right_icon;
+extern const display_icon_t up_icon;
+extern const display_icon_t down_icon;
 
 
 void display_init();
@@ -81,7 +162,108 @@ void display_text_show(
 	const uint32_t scale
 );
 
+/*
+ * Same as display_text_show, but the whole string is drawn in one display window
+ */
+void display_text_run(
+	const uint16_t x,
+	const uint16_t y,
+	sFONT* font,
+	DISPLAY_ALIGN_MODE mode,
+	const char* text,
+	const unsigned len,
+	const uint32_t scale
+);
+
 void display_draw_bitmap(uint16_t x, uint16_t y, const BITMAPSTRUCT* bmp);
+/*
+ * Expands the icon straight into the display window,
+ * palette replaces the icon colors if it is not NULL
+ */
+void display_draw_icon(
+	const uint16_t x,
+	const uint16_t y,
+	DISPLAY_ALIGN_MODE mode,
+	const display_icon_t* icon,
+	const uint16_t* palette
+);
+
+/*
+ * Vertical scrolling of the rows between top_fix and bottom_fix:
+ * the screen row y shows the display row top_fix + (y - top_fix - scroll) % area
+ */
+void display_scroll(int16_t scroll, uint16_t top_fix, uint16_t bottom_fix);
+
+/*
+ * Composition of the region in RAM: fills and texts are layered in the call order
+ * and the region is sent by strips of DISPLAY_STRIP_SIZE pixels in one display window.
+ * The text of the layer must be valid until display_compose_end
+ */
+void display_compose_begin(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void display_compose_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+void display_compose_text(
+	const uint16_t x,
+	const uint16_t y,
+	sFONT* font,
+	DISPLAY_ALIGN_MODE mode,
+	const char* text,
+	const unsigned len,
+	const uint32_t scale,
+	const uint16_t color
+);
+/* The icon color 0 is transparent in the composition */
+void display_compose_icon(
+	const uint16_t x,
+	const uint16_t y,
+	DISPLAY_ALIGN_MODE mode,
+	const display_icon_t* icon,
+	const uint16_t* palette
+);
+void display_compose_end();
+const display_compose_stats_t* display_compose_stats();
+
+/*
+ * Display command queue: fills, texts (display_text_show) and icons with up to
+ * DISPLAY_QUEUE_PALETTE_SIZE colors are enqueued and the functions return at once.
+ * The first command is started by the enqueue and the next ones by the DMA interrupt
+ * at the end of the previous transfer, the full queue waits for a free slot.
+ * The other drawing functions wait for the empty queue and draw directly
+ */
+/* Waits for the end of all the queued commands */
+void display_queue_wait();
+unsigned display_queue_depth();
+const display_queue_stats_t* display_queue_stats();
+
+/*
+ * Display self-check: the tiles of a 4 x 4 grid remember the color of the last fill
+ * that has covered the whole tile (the other drawings make the tile color unknown).
+ * display_refresh_check reads back the center pixels of the next count tiles with the known color
+ * and fills the tiles with a wrong pixel again, false - a wrong pixel has been found.
+ */
+bool display_refresh_check(unsigned count);
+/*
+ * Sends the panel configuration again, the display RAM and the scrolling are kept.
+ * true - the panel reset by noise has got Sleep Out, the Display On is sent by a call
+ * after DISPLAY_WAKE_MS
+ */
+bool display_refresh_config();
+const display_refresh_stats_t* display_refresh_stats();
+
+/*
+ * SPI clock calibration: the test patterns are written to a 48 x 2 window at the display
+ * top left corner and read back at the faster and faster dividers, the fastest divider
+ * without errors is slowed down by one step margin. The functions restore the window pixels.
+ */
+/* Checks and sets the stored dividers, false - the dividers are invalid or have failed (the defaults are set) */
+bool display_spi_apply(display_spi_t* spi);
+bool display_spi_calibrate(display_spi_t* spi);
+
+/*
+ * Fills are sent by DMA and the functions return before the end of the transfer,
+ * the next display call waits for it
+ */
+bool display_busy();
+void display_set_transfer_callback(display_transfer_callback_t callback);
 
 
 #ifdef __cplusplus
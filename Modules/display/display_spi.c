@@ -0,0 +1,206 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#include "display.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "glog.h"
+#include "system.h"
+#include "gutils.h"
+#include "lcd_io_spi.h"
+
+
+/* Test window at the display top left corner, one read back call reads one window row */
+#define DISPLAY_SPI_CHUNK      ((uint16_t)48)
+#define DISPLAY_SPI_ROWS       ((uint16_t)2)
+#define DISPLAY_SPI_PIXELS     ((uint16_t)(DISPLAY_SPI_CHUNK * DISPLAY_SPI_ROWS))
+#define DISPLAY_SPI_PATTERNS   (4)
+/* The writes are checked by the reads at the divider that is in the panel read clock limit */
+#define DISPLAY_SPI_REFERENCE  ((uint8_t)3)
+/* Dividers slower than the fastest passed one */
+#define DISPLAY_SPI_MARGIN     ((uint8_t)1)
+/* Fills of the test window that measure the write bandwidth (4800 pixels) */
+#define DISPLAY_SPI_BANDWIDTH_FILLS ((uint16_t)50)
+
+
+extern volatile uint32_t LCD_IO_DmaTransferStatus;
+extern LCD_DrvTypeDef* lcd_drv;
+
+void LCD_IO_SetSpeed(uint32_t SpdWrite, uint32_t SpdRead);
+
+
+static const char DISPLAY_SPI_TAG[] = "DSPI";
+
+
+static void _display_spi_save(uint16_t* saved);
+static void _display_spi_restore(const uint16_t* saved);
+static bool _display_spi_check(const uint8_t write_divider, const uint8_t read_divider);
+static uint16_t _display_spi_pattern(const unsigned pattern, const uint32_t index);
+static uint32_t _display_spi_bandwidth();
+static void _display_spi_set(display_spi_t* spi, const uint8_t write_divider, const uint8_t read_divider);
+
+
+bool display_spi_apply(display_spi_t* spi)
+{
+	display_queue_wait();
+
+	uint16_t saved[DISPLAY_SPI_PIXELS];
+	_display_spi_save(saved);
+
+	if (spi->write_divider > DISPLAY_SPI_DIVIDER_MAX || spi->read_divider > DISPLAY_SPI_DIVIDER_MAX) {
+		_display_spi_set(spi, LCD_SPI_SPD_WRITE, LCD_SPI_SPD_READ);
+		_display_spi_restore(saved);
+		return false;
+	}
+
+	bool result = _display_spi_check(spi->write_divider, spi->read_divider);
+	if (result) {
+		_display_spi_set(spi, spi->write_divider, spi->read_divider);
+	} else {
+		printTagLog(
+			DISPLAY_SPI_TAG,
+			"dividers write=%u read=%u have failed the read back",
+			spi->write_divider,
+			spi->read_divider
+		);
+		_display_spi_set(spi, LCD_SPI_SPD_WRITE, LCD_SPI_SPD_READ);
+	}
+
+	_display_spi_restore(saved);
+	return result;
+}
+
+bool display_spi_calibrate(display_spi_t* spi)
+{
+	display_queue_wait();
+
+	uint16_t saved[DISPLAY_SPI_PIXELS];
+	_display_spi_save(saved);
+
+	/* The writes from the slowest divider while the reads are at the reference */
+	uint8_t write_divider = DISPLAY_SPI_DIVIDER_NONE;
+	for (int divider = DISPLAY_SPI_DIVIDER_MAX; divider >= 0; divider--) {
+		if (!_display_spi_check((uint8_t)divider, DISPLAY_SPI_REFERENCE)) {
+			break;
+		}
+		write_divider = (uint8_t)divider;
+	}
+	if (write_divider == DISPLAY_SPI_DIVIDER_NONE) {
+		printTagLog(DISPLAY_SPI_TAG, "calibration error: no divider has passed the read back");
+		_display_spi_set(spi, LCD_SPI_SPD_WRITE, LCD_SPI_SPD_READ);
+		_display_spi_restore(saved);
+		return false;
+	}
+	write_divider = (uint8_t)__min(write_divider + DISPLAY_SPI_MARGIN, DISPLAY_SPI_DIVIDER_MAX);
+
+	/* The reads from the reference with the writes at the found divider */
+	uint8_t read_divider = DISPLAY_SPI_REFERENCE;
+	for (int divider = DISPLAY_SPI_REFERENCE - 1; divider >= 0; divider--) {
+		if (!_display_spi_check(write_divider, (uint8_t)divider)) {
+			break;
+		}
+		read_divider = (uint8_t)divider;
+	}
+	read_divider = (uint8_t)__min(read_divider + DISPLAY_SPI_MARGIN, DISPLAY_SPI_DIVIDER_MAX);
+
+	_display_spi_set(spi, write_divider, read_divider);
+	_display_spi_restore(saved);
+
+	printTagLog(
+		DISPLAY_SPI_TAG,
+		"calibrated dividers: write=%u read=%u, bandwidth=%lu B/s",
+		spi->write_divider,
+		spi->read_divider,
+		spi->bandwidth
+	);
+
+	return true;
+}
+
+/* The test window pixels are read at the current dividers: the defaults or the checked ones */
+void _display_spi_save(uint16_t* saved)
+{
+	for (uint16_t row = 0; row < DISPLAY_SPI_ROWS; row++) {
+		lcd_drv->ReadRGBImage(0, row, DISPLAY_SPI_CHUNK, 1, &saved[row * DISPLAY_SPI_CHUNK]);
+	}
+}
+
+void _display_spi_restore(const uint16_t* saved)
+{
+	lcd_drv->SetDisplayWindow(0, 0, DISPLAY_SPI_CHUNK, DISPLAY_SPI_ROWS);
+	lcd_drv->WriteWindow((uint16_t*)saved, DISPLAY_SPI_PIXELS, false);
+	while (LCD_IO_DmaTransferStatus);
+}
+
+/* Writes the test patterns at write_divider and compares the pixels read back at read_divider */
+bool _display_spi_check(const uint8_t write_divider, const uint8_t read_divider)
+{
+	LCD_IO_SetSpeed(write_divider, read_divider);
+
+	uint16_t pixels[DISPLAY_SPI_CHUNK];
+	bool result = true;
+	for (unsigned pattern = 0; result && pattern < DISPLAY_SPI_PATTERNS; pattern++) {
+		lcd_drv->SetDisplayWindow(0, 0, DISPLAY_SPI_CHUNK, DISPLAY_SPI_ROWS);
+		for (uint32_t i = 0; i < DISPLAY_SPI_PIXELS; i += DISPLAY_SPI_CHUNK) {
+			for (uint16_t j = 0; j < DISPLAY_SPI_CHUNK; j++) {
+				pixels[j] = _display_spi_pattern(pattern, i + j);
+			}
+			lcd_drv->WriteWindow(pixels, DISPLAY_SPI_CHUNK, i != 0);
+			while (LCD_IO_DmaTransferStatus);
+		}
+
+		for (uint16_t row = 0; result && row < DISPLAY_SPI_ROWS; row++) {
+			lcd_drv->ReadRGBImage(0, row, DISPLAY_SPI_CHUNK, 1, pixels);
+			for (uint16_t j = 0; j < DISPLAY_SPI_CHUNK; j++) {
+				if (pixels[j] != _display_spi_pattern(pattern, (uint32_t)row * DISPLAY_SPI_CHUNK + j)) {
+					result = false;
+					break;
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+/* Every bit toggles, alternating bits, walking one and pseudo random pixels */
+uint16_t _display_spi_pattern(const unsigned pattern, const uint32_t index)
+{
+	switch (pattern) {
+	case 0:
+		return (index & 0x01) ? 0xFFFF : 0x0000;
+	case 1:
+		return (index & 0x01) ? 0xAAAA : 0x5555;
+	case 2:
+		return (uint16_t)(1 << (index % 16));
+	default:
+		return (uint16_t)((index * 2654435761UL) >> 16);
+	}
+}
+
+/* Pixel bytes per second of the test window fills at the current write divider (with the window commands) */
+uint32_t _display_spi_bandwidth()
+{
+	uint32_t pixels = (uint32_t)DISPLAY_SPI_PIXELS * DISPLAY_SPI_BANDWIDTH_FILLS;
+
+	uint32_t start_us = system_micros();
+	for (uint16_t i = 0; i < DISPLAY_SPI_BANDWIDTH_FILLS; i++) {
+		lcd_drv->FillRect(0, 0, DISPLAY_SPI_CHUNK, DISPLAY_SPI_ROWS, DISPLAY_COLOR_WHITE);
+		while (LCD_IO_DmaTransferStatus);
+	}
+	uint32_t time_us = system_micros() - start_us;
+
+	if (!time_us) {
+		return 0;
+	}
+	return (uint32_t)((uint64_t)pixels * sizeof(uint16_t) * 1000000 / time_us);
+}
+
+void _display_spi_set(display_spi_t* spi, const uint8_t write_divider, const uint8_t read_divider)
+{
+	LCD_IO_SetSpeed(write_divider, read_divider);
+	spi->write_divider = write_divider;
+	spi->read_divider  = read_divider;
+	spi->bandwidth     = _display_spi_bandwidth();
+}
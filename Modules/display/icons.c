@@ -0,0 +1,386 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/* Generated by tools/icon_converter.py from icons/ */
+
+#include <stdint.h>
+
+#include "display.h"
+
+
+static const uint16_t back_icon_palette[] = {
+	DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLACK
+};
+
+static const uint8_t back_icon_data[] = {
+	0xEC, 0x00, 0x00, 0x01, 0xFD, 0xFF, 0x02, 0xE0, 0x00, 0x06, 0xFD, 0x00,
+	0x02, 0x18, 0x00, 0x08, 0xFD, 0x00, 0x02, 0x04, 0x00, 0x08, 0xFD, 0x00,
+	0x02, 0x04, 0x00, 0x10, 0xFD, 0x00, 0x02, 0x02, 0x00, 0x10, 0xFD, 0x00,
+	0x02, 0x02, 0x00, 0x10, 0xFD, 0x00, 0x02, 0x02, 0x00, 0x10, 0xFD, 0x00,
+	0x02, 0x02, 0x00, 0x10, 0xFD, 0x00, 0x02, 0x02, 0x00, 0x10, 0xFD, 0x00,
+	0x04, 0x02, 0x00, 0x10, 0x00, 0x02, 0xFF, 0x00, 0x04, 0x02, 0x00, 0x10,
+	0x00, 0x06, 0xFF, 0x00, 0x04, 0x02, 0x00, 0x10, 0x00, 0x0E, 0xFF, 0x00,
+	0x04, 0x02, 0x00, 0x10, 0x00, 0x1A, 0xFF, 0x00, 0x04, 0x02, 0x00, 0x10,
+	0x00, 0x32, 0xFF, 0x00, 0x04, 0x02, 0x00, 0x10, 0x00, 0x62, 0xFF, 0x00,
+	0x04, 0x02, 0x00, 0x10, 0x00, 0xC2, 0xFF, 0x00, 0x04, 0x02, 0x00, 0x10,
+	0x01, 0x82, 0xFF, 0x00, 0x02, 0x02, 0x00, 0x10, 0xFF, 0x03, 0x05, 0xFF,
+	0xFC, 0x02, 0x00, 0x10, 0x06, 0xFF, 0x00, 0x04, 0x03, 0x02, 0x00, 0x10,
+	0x0C, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x18, 0xFE, 0x00, 0x03,
+	0x82, 0x00, 0x10, 0x30, 0xFE, 0x00, 0x03, 0x82, 0x00, 0x10, 0x18, 0xFE,
+	0x00, 0x03, 0x82, 0x00, 0x10, 0x0C, 0xFE, 0x00, 0x03, 0x82, 0x00, 0x10,
+	0x06, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x03, 0xFF, 0x00, 0x0C,
+	0x03, 0x02, 0x00, 0x10, 0x01, 0x81, 0xFF, 0xFC, 0x02, 0x00, 0x10, 0x00,
+	0xC1, 0xFF, 0x00, 0x04, 0x02, 0x00, 0x10, 0x00, 0x61, 0xFF, 0x00, 0x04,
+	0x02, 0x00, 0x10, 0x00, 0x31, 0xFF, 0x00, 0x04, 0x02, 0x00, 0x10, 0x00,
+	0x19, 0xFF, 0x00, 0x04, 0x02, 0x00, 0x10, 0x00, 0x0D, 0xFF, 0x00, 0x04,
+	0x02, 0x00, 0x10, 0x00, 0x07, 0xFF, 0x00, 0x04, 0x02, 0x00, 0x10, 0x00,
+	0x03, 0xFF, 0x00, 0x04, 0x02, 0x00, 0x10, 0x00, 0x01, 0xFF, 0x00, 0x02,
+	0x02, 0x00, 0x10, 0xFD, 0x00, 0x02, 0x02, 0x00, 0x10, 0xFD, 0x00, 0x02,
+	0x02, 0x00, 0x10, 0xFD, 0x00, 0x02, 0x02, 0x00, 0x10, 0xFD, 0x00, 0x02,
+	0x02, 0x00, 0x08, 0xFD, 0x00, 0x02, 0x04, 0x00, 0x08, 0xFD, 0x00, 0x02,
+	0x04, 0x00, 0x06, 0xFD, 0x00, 0x02, 0x18, 0x00, 0x01, 0xFD, 0xFF, 0x00,
+	0xE0, 0xEB, 0x00,
+};
+
+const display_icon_t back_icon = {
+	50,
+	50,
+	1,
+	2,
+	back_icon_palette,
+	back_icon_data,
+	sizeof(back_icon_data)
+};
+
+
+static const uint16_t bigski_icon_palette[] = {
+	DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLACK
+};
+
+static const uint8_t bigski_icon_data[] = {
+	0xDC, 0x00, 0x01, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0x20, 0x01, 0xFC, 0x00,
+	0x01, 0x20, 0x01, 0xFC, 0x00, 0x01, 0x20, 0x01, 0xFE, 0x00, 0x00, 0x0F,
+	0xFD, 0xFF, 0x02, 0xFC, 0x00, 0x38, 0xFD, 0x00, 0x02, 0x07, 0x00, 0x60,
+	0xFD, 0x00, 0x02, 0x01, 0x80, 0x40, 0xFC, 0x00, 0x01, 0x80, 0x40, 0xFC,
+	0x00, 0x01, 0x80, 0x40, 0xFC, 0x00, 0x01, 0x80, 0x40, 0xFC, 0x00, 0x01,
+	0x80, 0x40, 0xFD, 0x00, 0x03, 0x01, 0x80, 0x60, 0x3F, 0xFE, 0xFF, 0x03,
+	0x03, 0x00, 0x30, 0x3F, 0xFE, 0xFF, 0x03, 0x02, 0x00, 0x10, 0x20, 0xFF,
+	0x00, 0x78, 0x01, 0x02, 0x00, 0x10, 0x20, 0x03, 0xF0, 0x01, 0x02, 0x00,
+	0x10, 0x20, 0x04, 0x08, 0x01, 0x02, 0x00, 0x10, 0x20, 0x08, 0x04, 0x01,
+	0x02, 0x00, 0x10, 0x20, 0x08, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0x00,
+	0x02, 0x01, 0x02, 0x00, 0x10, 0x20, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10,
+	0x20, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0x00, 0x08, 0x01, 0x02,
+	0x00, 0x10, 0x20, 0x03, 0xF0, 0x01, 0x02, 0x00, 0x10, 0x20, 0x00, 0x08,
+	0x01, 0x02, 0x00, 0x10, 0x20, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20,
+	0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0x00, 0x02, 0x01, 0x02, 0x00,
+	0x10, 0x20, 0x08, 0x04, 0x01, 0x02, 0x00, 0x18, 0x20, 0x08, 0x04, 0x01,
+	0x06, 0x00, 0x0C, 0x60, 0x04, 0x08, 0x01, 0x8C, 0x00, 0x07, 0xC0, 0x03,
+	0xF0, 0x00, 0xF8, 0xEB, 0x00, 0x00, 0x1F, 0xFD, 0xFF, 0x00, 0xFE, 0xF2,
+	0x00, 0x00, 0x1F, 0xFD, 0xFF, 0x00, 0xFE, 0xD6, 0x00,
+};
+
+const display_icon_t bigski_icon = {
+	50,
+	50,
+	1,
+	2,
+	bigski_icon_palette,
+	bigski_icon_data,
+	sizeof(bigski_icon_data)
+};
+
+
+static const uint16_t down_icon_palette[] = {
+	DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLACK
+};
+
+static const uint8_t down_icon_data[] = {
+	0x1D, 0xFF, 0xFE, 0xFF, 0xFE, 0x7F, 0xFC, 0x7F, 0xFC, 0x3F, 0xF8, 0x3F,
+	0xF8, 0x1F, 0xF0, 0x1F, 0xF0, 0x0F, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x07,
+	0xC0, 0x03, 0x80, 0x03, 0x80, 0x01, 0x00,
+};
+
+const display_icon_t down_icon = {
+	15,
+	15,
+	1,
+	2,
+	down_icon_palette,
+	down_icon_data,
+	sizeof(down_icon_data)
+};
+
+
+static const uint16_t left_icon_palette[] = {
+	DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLACK
+};
+
+static const uint8_t left_icon_data[] = {
+	0xEE, 0x00, 0x00, 0x70, 0xFC, 0x00, 0x01, 0x01, 0xF0, 0xFC, 0x00, 0x01,
+	0x07, 0xF0, 0xFC, 0x00, 0x01, 0x1F, 0xF0, 0xFC, 0x00, 0x01, 0x7F, 0xF0,
+	0xFD, 0x00, 0x02, 0x01, 0xFF, 0xF0, 0xFD, 0x00, 0x02, 0x07, 0xFF, 0xF0,
+	0xFD, 0x00, 0x02, 0x1F, 0xFF, 0xF0, 0xFD, 0x00, 0x02, 0x7F, 0xFF, 0xF0,
+	0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x07,
+	0xFF, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0xF0,
+	0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x01,
+	0xFE, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x00, 0xF0,
+	0xFF, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x7F,
+	0xFE, 0xFF, 0x02, 0xF0, 0x00, 0x01, 0xFD, 0xFF, 0x02, 0xF0, 0x00, 0x07,
+	0xFD, 0xFF, 0x02, 0xF0, 0x00, 0x1F, 0xFD, 0xFF, 0x02, 0xF0, 0x00, 0x3F,
+	0xFD, 0xFF, 0x02, 0xF0, 0x00, 0x7F, 0xFD, 0xFF, 0x02, 0xF0, 0x00, 0x7F,
+	0xFD, 0xFF, 0x02, 0xF0, 0x00, 0x7F, 0xFD, 0xFF, 0x02, 0xF0, 0x00, 0x7F,
+	0xFD, 0xFF, 0x02, 0xF0, 0x00, 0x3F, 0xFD, 0xFF, 0x02, 0xF0, 0x00, 0x1F,
+	0xFD, 0xFF, 0x02, 0xF0, 0x00, 0x07, 0xFD, 0xFF, 0x02, 0xF0, 0x00, 0x01,
+	0xFD, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0x00, 0xF0,
+	0xFF, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x07,
+	0xFE, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0xF0,
+	0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x1F,
+	0xFF, 0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0xF0,
+	0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0xF0, 0xFD, 0x00, 0x02, 0x7F,
+	0xFF, 0xF0, 0xFD, 0x00, 0x02, 0x1F, 0xFF, 0xF0, 0xFD, 0x00, 0x02, 0x07,
+	0xFF, 0xF0, 0xFD, 0x00, 0x02, 0x01, 0xFF, 0xF0, 0xFC, 0x00, 0x01, 0x7F,
+	0xF0, 0xFC, 0x00, 0x01, 0x1F, 0xF0, 0xFC, 0x00, 0x01, 0x07, 0xF0, 0xFC,
+	0x00, 0x01, 0x01, 0xF0, 0xFB, 0x00, 0x00, 0x70, 0xF2, 0x00,
+};
+
+const display_icon_t left_icon = {
+	50,
+	50,
+	1,
+	2,
+	left_icon_palette,
+	left_icon_data,
+	sizeof(left_icon_data)
+};
+
+
+static const uint16_t right_icon_palette[] = {
+	DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLACK
+};
+
+static const uint8_t right_icon_data[] = {
+	0xF3, 0x00, 0x01, 0x03, 0x80, 0xFC, 0x00, 0x01, 0x03, 0xE0, 0xFC, 0x00,
+	0x01, 0x03, 0xF8, 0xFC, 0x00, 0x01, 0x03, 0xFE, 0xFC, 0x00, 0x02, 0x03,
+	0xFF, 0x80, 0xFD, 0x00, 0x02, 0x03, 0xFF, 0xE0, 0xFD, 0x00, 0x02, 0x03,
+	0xFF, 0xF8, 0xFD, 0x00, 0x02, 0x03, 0xFF, 0xFE, 0xFD, 0x00, 0x00, 0x03,
+	0xFF, 0xFF, 0x00, 0x80, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0xE0,
+	0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0xF8, 0xFE, 0x00, 0x00, 0x03,
+	0xFF, 0xFF, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x80,
+	0xFF, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x03,
+	0xFE, 0xFF, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0xFE,
+	0xFF, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x02, 0x80, 0x00, 0x03, 0xFD, 0xFF,
+	0x02, 0xE0, 0x00, 0x03, 0xFD, 0xFF, 0x02, 0xF8, 0x00, 0x03, 0xFD, 0xFF,
+	0x02, 0xFE, 0x00, 0x03, 0xFC, 0xFF, 0x01, 0x00, 0x03, 0xFC, 0xFF, 0x01,
+	0x80, 0x03, 0xFC, 0xFF, 0x01, 0x80, 0x03, 0xFC, 0xFF, 0x01, 0x80, 0x03,
+	0xFC, 0xFF, 0x01, 0x80, 0x03, 0xFC, 0xFF, 0x01, 0x00, 0x03, 0xFD, 0xFF,
+	0x02, 0xFE, 0x00, 0x03, 0xFD, 0xFF, 0x02, 0xF8, 0x00, 0x03, 0xFD, 0xFF,
+	0x02, 0xE0, 0x00, 0x03, 0xFD, 0xFF, 0x02, 0x80, 0x00, 0x03, 0xFE, 0xFF,
+	0x00, 0xFE, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0xF8, 0xFF, 0x00,
+	0x00, 0x03, 0xFE, 0xFF, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0xFF,
+	0x00, 0x80, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0xFE, 0xFE, 0x00,
+	0x00, 0x03, 0xFF, 0xFF, 0x00, 0xF8, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+	0x00, 0xE0, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x80, 0xFE, 0x00,
+	0x02, 0x03, 0xFF, 0xFE, 0xFD, 0x00, 0x02, 0x03, 0xFF, 0xF8, 0xFD, 0x00,
+	0x02, 0x03, 0xFF, 0xE0, 0xFD, 0x00, 0x02, 0x03, 0xFF, 0x80, 0xFD, 0x00,
+	0x01, 0x03, 0xFE, 0xFC, 0x00, 0x01, 0x03, 0xF8, 0xFC, 0x00, 0x01, 0x03,
+	0xE0, 0xFC, 0x00, 0x01, 0x03, 0x80, 0xEE, 0x00,
+};
+
+const display_icon_t right_icon = {
+	50,
+	50,
+	1,
+	2,
+	right_icon_palette,
+	right_icon_data,
+	sizeof(right_icon_data)
+};
+
+
+static const uint16_t save_icon_palette[] = {
+	DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLACK
+};
+
+static const uint8_t save_icon_data[] = {
+	0xEC, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x00, 0xFC, 0xFF, 0x00, 0x04, 0x0C,
+	0x00, 0x80, 0x00, 0x46, 0xFF, 0x00, 0x04, 0x18, 0x00, 0x80, 0x00, 0x43,
+	0xFF, 0x00, 0x54, 0x10, 0x00, 0x80, 0x00, 0x41, 0x80, 0x00, 0x10, 0x00,
+	0x80, 0x00, 0x40, 0xC0, 0x00, 0x10, 0x00, 0x80, 0x00, 0x40, 0x60, 0x00,
+	0x10, 0x00, 0x80, 0x00, 0x40, 0x30, 0x00, 0x10, 0x00, 0x80, 0x00, 0x40,
+	0x18, 0x00, 0x10, 0x00, 0x80, 0x00, 0x40, 0x0C, 0x00, 0x10, 0x00, 0x80,
+	0x00, 0x40, 0x06, 0x00, 0x10, 0x00, 0x80, 0x00, 0x40, 0x02, 0x00, 0x10,
+	0x00, 0x80, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0xC0, 0x00, 0xC0, 0x02,
+	0x00, 0x10, 0x00, 0x60, 0x01, 0x80, 0x02, 0x00, 0x10, 0x00, 0x3F, 0xFF,
+	0x00, 0x02, 0x00, 0x10, 0xFD, 0x00, 0x02, 0x02, 0x00, 0x10, 0xFD, 0x00,
+	0x02, 0x02, 0x00, 0x10, 0xFD, 0x00, 0x02, 0x02, 0x00, 0x10, 0xFD, 0x00,
+	0x02, 0x02, 0x00, 0x10, 0xFD, 0x00, 0x02, 0x02, 0x00, 0x10, 0xFD, 0x00,
+	0x02, 0x02, 0x00, 0x10, 0xFD, 0x00, 0x02, 0x02, 0x00, 0x10, 0xFD, 0x00,
+	0x02, 0x02, 0x00, 0x10, 0xFD, 0x00, 0x02, 0x02, 0x00, 0x10, 0xFD, 0x00,
+	0x02, 0x02, 0x00, 0x10, 0xFD, 0x00, 0x02, 0x02, 0x00, 0x10, 0xFD, 0x00,
+	0x03, 0x02, 0x00, 0x10, 0x0F, 0xFF, 0xFF, 0x04, 0xFC, 0x02, 0x00, 0x10,
+	0x18, 0xFF, 0x00, 0x02, 0x06, 0x02, 0x00, 0xFF, 0x10, 0xFF, 0x00, 0x04,
+	0x03, 0x02, 0x00, 0x10, 0x30, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10,
+	0x20, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0xFF, 0x00, 0x04,
+	0x01, 0x02, 0x00, 0x10, 0x20, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10,
+	0x20, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0xFF, 0x00, 0x04,
+	0x01, 0x02, 0x00, 0x10, 0x20, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10,
+	0x20, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0xFF, 0x00, 0x04,
+	0x01, 0x02, 0x00, 0x10, 0x20, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10,
+	0x20, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x18, 0x20, 0xFF, 0x00, 0x04,
+	0x01, 0x06, 0x00, 0x0C, 0x20, 0xFF, 0x00, 0x03, 0x01, 0x0C, 0x00, 0x07,
+	0xFD, 0xFF, 0x00, 0xF8, 0xEB, 0x00,
+};
+
+const display_icon_t save_icon = {
+	50,
+	50,
+	1,
+	2,
+	save_icon_palette,
+	save_icon_data,
+	sizeof(save_icon_data)
+};
+
+
+static const uint16_t settings_icon_palette[] = {
+	DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLACK
+};
+
+static const uint8_t settings_icon_data[] = {
+	0xF8, 0x00, 0x01, 0x03, 0xF0, 0xFC, 0x00, 0x01, 0x06, 0x18, 0xFC, 0x00,
+	0x01, 0x04, 0x08, 0xFC, 0x00, 0x01, 0x04, 0x08, 0xFC, 0x00, 0xFF, 0x0C,
+	0xFD, 0x00, 0x00, 0x30, 0xFF, 0x0C, 0x00, 0x03, 0xFE, 0x00, 0x04, 0x78,
+	0x18, 0x06, 0x07, 0x80, 0xFF, 0x00, 0x0D, 0xC6, 0x70, 0x03, 0x98, 0xC0,
+	0x00, 0x01, 0x83, 0x80, 0x00, 0x70, 0x60, 0x00, 0x03, 0xFD, 0x00, 0x02,
+	0x30, 0x00, 0x03, 0xFD, 0x00, 0x07, 0x30, 0x00, 0x01, 0x00, 0x01, 0xE0,
+	0x00, 0x20, 0xFF, 0x00, 0x04, 0x80, 0x0E, 0x1C, 0x00, 0x40, 0xFF, 0x00,
+	0x04, 0xC0, 0x38, 0x07, 0x00, 0xC0, 0xFF, 0x00, 0x02, 0x40, 0x60, 0x01,
+	0xFF, 0x80, 0xFF, 0x00, 0x04, 0x40, 0x80, 0x00, 0x40, 0x80, 0xFF, 0x00,
+	0x00, 0x81, 0xFF, 0x00, 0x01, 0x20, 0x40, 0xFF, 0x00, 0x00, 0x83, 0xFF,
+	0x00, 0x04, 0x30, 0x40, 0x00, 0x01, 0x82, 0xFF, 0x00, 0x04, 0x10, 0x60,
+	0x00, 0x07, 0x06, 0xFF, 0x00, 0x04, 0x18, 0x38, 0x00, 0x3E, 0x04, 0xFF,
+	0x00, 0x04, 0x08, 0x1F, 0x00, 0x60, 0x04, 0xFF, 0x00, 0x04, 0x04, 0x01,
+	0x80, 0x40, 0x08, 0xFF, 0x00, 0x04, 0x04, 0x00, 0x80, 0x40, 0x08, 0xFF,
+	0x00, 0x04, 0x04, 0x00, 0x80, 0x40, 0x08, 0xFF, 0x00, 0x04, 0x04, 0x00,
+	0x80, 0x40, 0x08, 0xFF, 0x00, 0x04, 0x04, 0x00, 0x80, 0x60, 0x04, 0xFF,
+	0x00, 0x04, 0x04, 0x01, 0x80, 0x3E, 0x04, 0xFF, 0x00, 0x04, 0x08, 0x1F,
+	0x00, 0x07, 0x06, 0xFF, 0x00, 0x04, 0x08, 0x38, 0x00, 0x01, 0x82, 0xFF,
+	0x00, 0x01, 0x10, 0x60, 0xFF, 0x00, 0x00, 0x83, 0xFF, 0x00, 0x01, 0x30,
+	0x40, 0xFF, 0x00, 0x00, 0x81, 0xFF, 0x00, 0x01, 0x20, 0x40, 0xFF, 0x00,
+	0x04, 0x40, 0x80, 0x00, 0x40, 0x80, 0xFF, 0x00, 0x02, 0x40, 0x60, 0x01,
+	0xFF, 0x80, 0xFF, 0x00, 0x04, 0xC0, 0x38, 0x03, 0x00, 0xC0, 0xFF, 0x00,
+	0x0D, 0x80, 0x0E, 0x1C, 0x00, 0x40, 0x00, 0x01, 0x00, 0x01, 0xE0, 0x00,
+	0x20, 0x00, 0x03, 0xFD, 0x00, 0x02, 0x30, 0x00, 0x03, 0xFD, 0x00, 0x07,
+	0x30, 0x00, 0x01, 0x83, 0x80, 0x00, 0x70, 0x60, 0xFF, 0x00, 0x04, 0xC6,
+	0x70, 0x03, 0x98, 0xC0, 0xFF, 0x00, 0x04, 0x7C, 0x18, 0x06, 0x07, 0x80,
+	0xFF, 0x00, 0x00, 0x30, 0xFF, 0x0C, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x0C,
+	0xFC, 0x00, 0x01, 0x04, 0x08, 0xFC, 0x00, 0x01, 0x04, 0x08, 0xFC, 0x00,
+	0x01, 0x06, 0x18, 0xFC, 0x00, 0x01, 0x03, 0xF0, 0xF7, 0x00,
+};
+
+const display_icon_t settings_icon = {
+	50,
+	50,
+	1,
+	2,
+	settings_icon_palette,
+	settings_icon_data,
+	sizeof(settings_icon_data)
+};
+
+
+static const uint16_t string_icon_palette[] = {
+	DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLACK
+};
+
+static const uint8_t string_icon_data[] = {
+	0xDC, 0x00, 0x01, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0x20, 0x01, 0xFC, 0x00,
+	0x01, 0x20, 0x01, 0xFC, 0x00, 0x01, 0x20, 0x01, 0xFE, 0x00, 0x00, 0x0F,
+	0xFD, 0xFF, 0x02, 0xFC, 0x00, 0x38, 0xFD, 0x00, 0x02, 0x07, 0x00, 0x60,
+	0xFD, 0x00, 0x02, 0x01, 0x80, 0x40, 0xFC, 0x00, 0x01, 0x80, 0x40, 0xFC,
+	0x00, 0x01, 0x80, 0x40, 0xFC, 0x00, 0x01, 0x80, 0x40, 0xFC, 0x00, 0x01,
+	0x80, 0x40, 0xFD, 0x00, 0x03, 0x01, 0x80, 0x60, 0x3F, 0xFE, 0xFF, 0x03,
+	0x03, 0x00, 0x30, 0x3F, 0xFE, 0xFF, 0x03, 0x02, 0x00, 0x10, 0x20, 0xFF,
+	0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0xFF, 0x00, 0x04, 0x01, 0x02,
+	0x00, 0x10, 0x20, 0xFF, 0x00, 0x4A, 0x01, 0x02, 0x00, 0x10, 0x20, 0x01,
+	0xE0, 0x01, 0x02, 0x00, 0x10, 0x20, 0x06, 0x18, 0x01, 0x02, 0x00, 0x10,
+	0x20, 0x04, 0x08, 0x01, 0x02, 0x00, 0x10, 0x20, 0x08, 0x04, 0x01, 0x02,
+	0x00, 0x10, 0x20, 0x08, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0x08, 0x04,
+	0x01, 0x02, 0x00, 0x10, 0x20, 0x08, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20,
+	0x04, 0x08, 0x01, 0x02, 0x00, 0x10, 0x20, 0x06, 0x18, 0x01, 0x02, 0x00,
+	0x10, 0x20, 0x01, 0xE0, 0x01, 0x02, 0x00, 0x10, 0x20, 0xFF, 0x00, 0x04,
+	0x01, 0x02, 0x00, 0x10, 0x20, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x18,
+	0x20, 0xFF, 0x00, 0x04, 0x01, 0x06, 0x00, 0x0C, 0x60, 0xFF, 0x00, 0x04,
+	0x01, 0x8C, 0x00, 0x07, 0xC0, 0xFE, 0x00, 0x00, 0xF8, 0xA5, 0x00,
+};
+
+const display_icon_t string_icon = {
+	50,
+	50,
+	1,
+	2,
+	string_icon_palette,
+	string_icon_data,
+	sizeof(string_icon_data)
+};
+
+
+static const uint16_t surface_icon_palette[] = {
+	DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLACK
+};
+
+static const uint8_t surface_icon_data[] = {
+	0xDC, 0x00, 0x01, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0x20, 0x01, 0xFC, 0x00,
+	0x01, 0x20, 0x01, 0xFC, 0x00, 0x01, 0x20, 0x01, 0xFE, 0x00, 0x00, 0x0F,
+	0xFD, 0xFF, 0x02, 0xFC, 0x00, 0x38, 0xFD, 0x00, 0x02, 0x07, 0x00, 0x60,
+	0xFD, 0x00, 0x02, 0x01, 0x80, 0x40, 0xFC, 0x00, 0x01, 0x80, 0x40, 0xFC,
+	0x00, 0x01, 0x80, 0x40, 0xFC, 0x00, 0x01, 0x80, 0x40, 0xFC, 0x00, 0x01,
+	0x80, 0x40, 0xFD, 0x00, 0x03, 0x01, 0x80, 0x60, 0x3F, 0xFE, 0xFF, 0x03,
+	0x03, 0x00, 0x30, 0x3F, 0xFE, 0xFF, 0x03, 0x02, 0x00, 0x10, 0x20, 0xFF,
+	0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0xFF, 0x00, 0x04, 0x01, 0x02,
+	0x00, 0x10, 0x20, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0xFF,
+	0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0xFF, 0x00, 0x04, 0x01, 0x02,
+	0x00, 0x10, 0x20, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0xFF,
+	0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0xFF, 0x00, 0x04, 0x01, 0x02,
+	0x00, 0x10, 0x20, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0xFF,
+	0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0xFF, 0x00, 0x04, 0x01, 0x02,
+	0x00, 0x10, 0x20, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0xFF,
+	0x00, 0x04, 0x01, 0x02, 0x00, 0x10, 0x20, 0xFF, 0x00, 0x04, 0x01, 0x02,
+	0x00, 0x10, 0x20, 0xFF, 0x00, 0x04, 0x01, 0x02, 0x00, 0x18, 0x20, 0xFF,
+	0x00, 0x04, 0x01, 0x06, 0x00, 0x0C, 0x60, 0xFF, 0x00, 0x04, 0x01, 0x8C,
+	0x00, 0x07, 0xC0, 0xFE, 0x00, 0x00, 0xF8, 0xF2, 0x00, 0x28, 0x01, 0x00,
+	0x40, 0x10, 0x04, 0x01, 0x00, 0x02, 0x80, 0xA0, 0x28, 0x0A, 0x02, 0x00,
+	0x04, 0x41, 0x10, 0x44, 0x11, 0x04, 0x00, 0x08, 0x22, 0x08, 0x82, 0x20,
+	0x88, 0x00, 0x10, 0x14, 0x05, 0x01, 0x40, 0x50, 0x00, 0x20, 0x08, 0x02,
+	0x00, 0x80, 0x20, 0xDD, 0x00,
+};
+
+const display_icon_t surface_icon = {
+	50,
+	50,
+	1,
+	2,
+	surface_icon_palette,
+	surface_icon_data,
+	sizeof(surface_icon_data)
+};
+
+
+static const uint16_t up_icon_palette[] = {
+	DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLACK
+};
+
+static const uint8_t up_icon_data[] = {
+	0x1D, 0x01, 0x00, 0x03, 0x80, 0x03, 0x80, 0x07, 0xC0, 0x07, 0xC0, 0x0F,
+	0xE0, 0x0F, 0xE0, 0x1F, 0xF0, 0x1F, 0xF0, 0x3F, 0xF8, 0x3F, 0xF8, 0x7F,
+	0xFC, 0x7F, 0xFC, 0xFF, 0xFE, 0xFF, 0xFE,
+};
+
+const display_icon_t up_icon = {
+	15,
+	15,
+	1,
+	2,
+	up_icon_palette,
+	up_icon_data,
+	sizeof(up_icon_data)
+};
@@ -0,0 +1,374 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#include "lcd_emu.h"
+
+
+#if LCD_EMULATOR
+
+
+#include <stdio.h>
+#include <string.h>
+
+#include "bmp.h"
+#include "stm32_adafruit_lcd.h"
+
+
+/* ILI9341 SPI traffic: command byte + data bytes */
+#define LCD_EMU_WINDOW_BYTES (8)
+#define LCD_EMU_SCROLL_BYTES (6)
+#define LCD_EMU_START_BYTES  (2)
+#define LCD_EMU_READ_BYTES   (3)
+/* Data of the ILI9341 configuration registers (ili9341_Refresh) */
+#define LCD_EMU_CONFIG_BYTES (65)
+
+
+static void     _lcd_emu_Init(void);
+static uint16_t _lcd_emu_ReadID(void);
+static void     _lcd_emu_DisplayOn(void);
+static void     _lcd_emu_DisplayOff(void);
+static void     _lcd_emu_SetCursor(uint16_t Xpos, uint16_t Ypos);
+static void     _lcd_emu_WritePixel(uint16_t Xpos, uint16_t Ypos, uint16_t RGBCode);
+static uint16_t _lcd_emu_ReadPixel(uint16_t Xpos, uint16_t Ypos);
+static void     _lcd_emu_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+static void     _lcd_emu_DrawHLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length);
+static void     _lcd_emu_DrawVLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length);
+static uint16_t _lcd_emu_GetLcdPixelWidth(void);
+static uint16_t _lcd_emu_GetLcdPixelHeight(void);
+static void     _lcd_emu_DrawBitmap(uint16_t Xpos, uint16_t Ypos, uint8_t *pbmp);
+static void     _lcd_emu_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint16_t *pData);
+static void     _lcd_emu_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint16_t RGBCode);
+static void     _lcd_emu_ReadRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint16_t *pData);
+static void     _lcd_emu_Scroll(int16_t Scroll, uint16_t TopFix, uint16_t BottonFix);
+static void     _lcd_emu_WriteWindow(uint16_t *pData, uint32_t Size, uint8_t Continue);
+static uint8_t  _lcd_emu_Refresh(void);
+
+static void _lcd_emu_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+static void _lcd_emu_command(uint32_t bytes);
+static void _lcd_emu_write(uint16_t color);
+
+
+LCD_DrvTypeDef lcd_emu_drv = {
+	_lcd_emu_Init,
+	_lcd_emu_ReadID,
+	_lcd_emu_DisplayOn,
+	_lcd_emu_DisplayOff,
+	_lcd_emu_SetCursor,
+	_lcd_emu_WritePixel,
+	_lcd_emu_ReadPixel,
+	_lcd_emu_SetDisplayWindow,
+	_lcd_emu_DrawHLine,
+	_lcd_emu_DrawVLine,
+	_lcd_emu_GetLcdPixelWidth,
+	_lcd_emu_GetLcdPixelHeight,
+	_lcd_emu_DrawBitmap,
+	_lcd_emu_DrawRGBImage,
+	_lcd_emu_FillRect,
+	_lcd_emu_ReadRGBImage,
+	_lcd_emu_Scroll,
+	_lcd_emu_WriteWindow,
+	_lcd_emu_Refresh,
+};
+
+
+static struct {
+	uint16_t pixels[LCD_EMU_HEIGHT][LCD_EMU_WIDTH];
+
+	uint16_t x0;
+	uint16_t x1;
+	uint16_t y0;
+	uint16_t y1;
+	uint16_t cursor_x;
+	uint16_t cursor_y;
+	bool     up;
+
+	uint16_t scroll_top;
+	uint16_t scroll_area;
+	uint16_t scroll_start;
+
+	bool     on;
+
+	lcd_emu_stats_t stats;
+} lcd_emu;
+
+
+void lcd_emu_reset()
+{
+	memset(&lcd_emu, 0, sizeof(lcd_emu));
+	lcd_emu.x1 = LCD_EMU_WIDTH - 1;
+	lcd_emu.y1 = LCD_EMU_HEIGHT - 1;
+	lcd_emu.scroll_area = LCD_EMU_HEIGHT;
+}
+
+void lcd_emu_reset_stats()
+{
+	memset(&lcd_emu.stats, 0, sizeof(lcd_emu.stats));
+}
+
+const lcd_emu_stats_t* lcd_emu_stats()
+{
+	return &lcd_emu.stats;
+}
+
+uint32_t lcd_emu_spi_time_us(const uint32_t spi_clock_hz)
+{
+	if (!spi_clock_hz) {
+		return 0;
+	}
+	uint64_t bits = (uint64_t)(lcd_emu.stats.commands + lcd_emu.stats.bytes) * 8;
+	return (uint32_t)(bits * 1000000 / spi_clock_hz);
+}
+
+uint16_t lcd_emu_pixel(const uint16_t x, const uint16_t y)
+{
+	if (x >= LCD_EMU_WIDTH || y >= LCD_EMU_HEIGHT) {
+		return 0;
+	}
+	uint16_t row = y;
+	if (y >= lcd_emu.scroll_top && y < lcd_emu.scroll_top + lcd_emu.scroll_area) {
+		row = (uint16_t)(
+			lcd_emu.scroll_top +
+			(y - lcd_emu.scroll_top + lcd_emu.scroll_start - lcd_emu.scroll_top) % lcd_emu.scroll_area
+		);
+	}
+	return lcd_emu.pixels[row][x];
+}
+
+bool lcd_emu_save_ppm(const char* path)
+{
+	FILE* file = fopen(path, "wb");
+	if (!file) {
+		return false;
+	}
+
+	fprintf(file, "P6\n%d %d\n255\n", LCD_EMU_WIDTH, LCD_EMU_HEIGHT);
+	for (uint16_t y = 0; y < LCD_EMU_HEIGHT; y++) {
+		for (uint16_t x = 0; x < LCD_EMU_WIDTH; x++) {
+			uint16_t color = (uint16_t)RC(lcd_emu_pixel(x, y));
+			if (!lcd_emu.on) {
+				color = 0;
+			} else if (LCD_EMU_INVERTED) {
+				color ^= 0xFFFF;
+			}
+			uint8_t rgb[3] = {
+				(uint8_t)(((color >> 11) & 0x1F) * 255 / 0x1F),
+				(uint8_t)(((color >> 5)  & 0x3F) * 255 / 0x3F),
+				(uint8_t)((color         & 0x1F) * 255 / 0x1F),
+			};
+			fwrite(rgb, sizeof(rgb), 1, file);
+		}
+	}
+
+	return fclose(file) == 0;
+}
+
+void _lcd_emu_Init(void)
+{
+	lcd_emu_reset();
+	lcd_emu.on = true;
+}
+
+uint16_t _lcd_emu_ReadID(void)
+{
+	_lcd_emu_command(LCD_EMU_READ_BYTES + 1);
+	return 0x9341;
+}
+
+void _lcd_emu_DisplayOn(void)
+{
+	_lcd_emu_command(0);
+	lcd_emu.on = true;
+}
+
+void _lcd_emu_DisplayOff(void)
+{
+	_lcd_emu_command(0);
+	lcd_emu.on = false;
+}
+
+void _lcd_emu_SetCursor(uint16_t Xpos, uint16_t Ypos)
+{
+	_lcd_emu_window(Xpos, Ypos, 1, 1);
+}
+
+void _lcd_emu_WritePixel(uint16_t Xpos, uint16_t Ypos, uint16_t RGBCode)
+{
+	_lcd_emu_window(Xpos, Ypos, 1, 1);
+	_lcd_emu_command(2);
+	_lcd_emu_write(RGBCode);
+}
+
+uint16_t _lcd_emu_ReadPixel(uint16_t Xpos, uint16_t Ypos)
+{
+	_lcd_emu_window(Xpos, Ypos, 1, 1);
+	_lcd_emu_command(1 + LCD_EMU_READ_BYTES);
+	if (Xpos >= LCD_EMU_WIDTH || Ypos >= LCD_EMU_HEIGHT) {
+		return 0;
+	}
+	return lcd_emu.pixels[Ypos][Xpos];
+}
+
+void _lcd_emu_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+	_lcd_emu_window(Xpos, Ypos, Width, Height);
+}
+
+void _lcd_emu_DrawHLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length)
+{
+	_lcd_emu_FillRect(Xpos, Ypos, Length, 1, RGBCode);
+}
+
+void _lcd_emu_DrawVLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length)
+{
+	_lcd_emu_FillRect(Xpos, Ypos, 1, Length, RGBCode);
+}
+
+uint16_t _lcd_emu_GetLcdPixelWidth(void)
+{
+	return LCD_EMU_WIDTH;
+}
+
+uint16_t _lcd_emu_GetLcdPixelHeight(void)
+{
+	return LCD_EMU_HEIGHT;
+}
+
+void _lcd_emu_DrawBitmap(uint16_t Xpos, uint16_t Ypos, uint8_t *pbmp)
+{
+	(void)Xpos;
+	(void)Ypos;
+
+	uint32_t index = ((BITMAPSTRUCT*)pbmp)->fileHeader.bfOffBits;
+	uint32_t size  = (((BITMAPSTRUCT*)pbmp)->fileHeader.bfSize - index) / 2;
+	uint16_t* data = (uint16_t*)(pbmp + index);
+
+	/* MADCTL + PASET, the bitmap rows are drawn from the bottom of the current window */
+	_lcd_emu_command(1);
+	_lcd_emu_command(4);
+	lcd_emu.up = true;
+	lcd_emu.cursor_x = lcd_emu.x0;
+	lcd_emu.cursor_y = lcd_emu.y1;
+
+	_lcd_emu_command(0);
+	for (uint32_t i = 0; i < size; i++) {
+		_lcd_emu_write(data[i]);
+	}
+
+	_lcd_emu_command(1);
+	lcd_emu.up = false;
+}
+
+void _lcd_emu_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint16_t *pData)
+{
+	_lcd_emu_window(Xpos, Ypos, Xsize, Ysize);
+	_lcd_emu_WriteWindow(pData, (uint32_t)Xsize * Ysize, 0);
+}
+
+void _lcd_emu_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint16_t RGBCode)
+{
+	_lcd_emu_window(Xpos, Ypos, Xsize, Ysize);
+	_lcd_emu_command(0);
+	for (uint32_t i = 0; i < (uint32_t)Xsize * Ysize; i++) {
+		_lcd_emu_write(RGBCode);
+	}
+}
+
+void _lcd_emu_ReadRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint16_t *pData)
+{
+	_lcd_emu_window(Xpos, Ypos, Xsize, Ysize);
+	/* PIXFMT 24 bit, RAMRD with a dummy byte, PIXFMT 16 bit */
+	_lcd_emu_command(1);
+	_lcd_emu_command(1 + (uint32_t)Xsize * Ysize * LCD_EMU_READ_BYTES);
+	_lcd_emu_command(1);
+	/* The pixels out of the panel are read as 0 */
+	for (uint32_t y = Ypos; y < (uint32_t)Ypos + Ysize; y++) {
+		for (uint32_t x = Xpos; x < (uint32_t)Xpos + Xsize; x++) {
+			*pData++ = (x < LCD_EMU_WIDTH && y < LCD_EMU_HEIGHT) ? lcd_emu.pixels[y][x] : 0;
+		}
+	}
+}
+
+void _lcd_emu_Scroll(int16_t Scroll, uint16_t TopFix, uint16_t BottonFix)
+{
+	if (TopFix + BottonFix >= LCD_EMU_HEIGHT) {
+		return;
+	}
+
+	uint16_t area = (uint16_t)(LCD_EMU_HEIGHT - TopFix - BottonFix);
+	if (TopFix != lcd_emu.scroll_top || area != lcd_emu.scroll_area) {
+		_lcd_emu_command(LCD_EMU_SCROLL_BYTES);
+		lcd_emu.scroll_top  = TopFix;
+		lcd_emu.scroll_area = area;
+	}
+
+	int32_t start = (0 - Scroll) % area;
+	if (start < 0) {
+		start += area;
+	}
+	lcd_emu.scroll_start = (uint16_t)(start + TopFix);
+	_lcd_emu_command(LCD_EMU_START_BYTES);
+}
+
+void _lcd_emu_WriteWindow(uint16_t *pData, uint32_t Size, uint8_t Continue)
+{
+	if (!Continue) {
+		lcd_emu.cursor_x = lcd_emu.x0;
+		lcd_emu.cursor_y = lcd_emu.y0;
+	}
+	_lcd_emu_command(0);
+	for (uint32_t i = 0; i < Size; i++) {
+		_lcd_emu_write(pData[i]);
+	}
+}
+
+uint8_t _lcd_emu_Refresh(void)
+{
+	_lcd_emu_command(LCD_EMU_CONFIG_BYTES);
+	_lcd_emu_command(LCD_EMU_SCROLL_BYTES + LCD_EMU_START_BYTES);
+	lcd_emu.on = true;
+	return 0;
+}
+
+/* CASET + PASET */
+void _lcd_emu_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	_lcd_emu_command(LCD_EMU_WINDOW_BYTES / 2);
+	_lcd_emu_command(LCD_EMU_WINDOW_BYTES / 2);
+
+	lcd_emu.x0 = x;
+	lcd_emu.x1 = (uint16_t)(x + w - 1);
+	lcd_emu.y0 = y;
+	lcd_emu.y1 = (uint16_t)(y + h - 1);
+	lcd_emu.cursor_x = lcd_emu.x0;
+	lcd_emu.cursor_y = lcd_emu.y0;
+}
+
+void _lcd_emu_command(uint32_t bytes)
+{
+	lcd_emu.stats.commands++;
+	lcd_emu.stats.bytes += bytes;
+}
+
+/* Panel RAM write with the address counter of the current window */
+void _lcd_emu_write(uint16_t color)
+{
+	lcd_emu.stats.bytes += 2;
+	lcd_emu.stats.pixels++;
+
+	if (lcd_emu.cursor_x < LCD_EMU_WIDTH && lcd_emu.cursor_y < LCD_EMU_HEIGHT) {
+		lcd_emu.pixels[lcd_emu.cursor_y][lcd_emu.cursor_x] = color;
+	}
+
+	if (lcd_emu.cursor_x < lcd_emu.x1) {
+		lcd_emu.cursor_x++;
+		return;
+	}
+	lcd_emu.cursor_x = lcd_emu.x0;
+	if (lcd_emu.up) {
+		lcd_emu.cursor_y = lcd_emu.cursor_y > lcd_emu.y0 ? (uint16_t)(lcd_emu.cursor_y - 1) : lcd_emu.y1;
+	} else {
+		lcd_emu.cursor_y = lcd_emu.cursor_y < lcd_emu.y1 ? (uint16_t)(lcd_emu.cursor_y + 1) : lcd_emu.y0;
+	}
+}
+
+
+#endif
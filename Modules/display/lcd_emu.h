@@ -0,0 +1,68 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#ifndef _LCD_EMU_H_
+#define _LCD_EMU_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "lcd.h"
+
+
+/*
+ * Host emulator of the ILI9341 SPI driver with a framebuffer in RAM.
+ * The firmware does not have enough RAM for the framebuffer, so the emulator is built
+ * only with -DLCD_EMULATOR=1 and connected by `lcd_drv = &lcd_emu_drv;` before BSP_LCD_Init
+ */
+#ifndef LCD_EMULATOR
+#	define LCD_EMULATOR (false)
+#endif
+
+#if LCD_EMULATOR
+
+
+#define LCD_EMU_WIDTH    (240)
+#define LCD_EMU_HEIGHT   (320)
+
+/* The panel of the device shows inverted colors (see DISPLAY_COLOR) */
+#define LCD_EMU_INVERTED (true)
+
+
+typedef struct _lcd_emu_stats_t {
+	uint32_t commands;
+	uint32_t bytes;
+	uint32_t pixels;
+} lcd_emu_stats_t;
+
+
+extern LCD_DrvTypeDef lcd_emu_drv;
+
+
+void lcd_emu_reset();
+
+void lcd_emu_reset_stats();
+const lcd_emu_stats_t* lcd_emu_stats();
+/* Time of the counted SPI traffic at the spi_clock_hz SCK frequency */
+uint32_t lcd_emu_spi_time_us(const uint32_t spi_clock_hz);
+
+/* Color of the visible pixel as it is stored by the panel */
+uint16_t lcd_emu_pixel(const uint16_t x, const uint16_t y);
+/* Saves the visible image as a binary PPM (P6) file */
+bool lcd_emu_save_ppm(const char* path);
+
+
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
@@ -0,0 +1,694 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#include "lcd_mirror.h"
+
+
+#if LCD_MIRROR
+
+
+#include "main.h"
+#include "display.h"
+
+
+/* BEDUG_UART (USART1) TX request channel */
+#define LCD_MIRROR_DMA          (DMA1_Channel4)
+#define LCD_MIRROR_DMA_TCIF     (DMA_ISR_TCIF4)
+#define LCD_MIRROR_DMA_CGIF     (DMA_IFCR_CGIF4)
+
+/* Sync, type and length before the payload and the sum after it */
+#define LCD_MIRROR_HEADER_SIZE  (3)
+#define LCD_MIRROR_PACKET_SIZE(PAYLOAD) (LCD_MIRROR_HEADER_SIZE + (PAYLOAD) + 1)
+
+#define LCD_MIRROR_LITERAL_MAX  (0x80)
+#define LCD_MIRROR_REPEAT_MIN   (2)
+#define LCD_MIRROR_REPEAT_MAX   (0x7F + LCD_MIRROR_REPEAT_MIN)
+
+
+typedef struct _lcd_mirror_rect_t {
+	uint16_t x;
+	uint16_t y;
+	uint16_t w;
+	uint16_t h;
+} lcd_mirror_rect_t;
+
+
+static void     _lcd_mirror_Init(void);
+static uint16_t _lcd_mirror_ReadID(void);
+static void     _lcd_mirror_DisplayOn(void);
+static void     _lcd_mirror_DisplayOff(void);
+static void     _lcd_mirror_SetCursor(uint16_t Xpos, uint16_t Ypos);
+static void     _lcd_mirror_WritePixel(uint16_t Xpos, uint16_t Ypos, uint16_t RGBCode);
+static uint16_t _lcd_mirror_ReadPixel(uint16_t Xpos, uint16_t Ypos);
+static void     _lcd_mirror_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+static void     _lcd_mirror_DrawHLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length);
+static void     _lcd_mirror_DrawVLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length);
+static uint16_t _lcd_mirror_GetLcdPixelWidth(void);
+static uint16_t _lcd_mirror_GetLcdPixelHeight(void);
+static void     _lcd_mirror_DrawBitmap(uint16_t Xpos, uint16_t Ypos, uint8_t *pbmp);
+static void     _lcd_mirror_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint16_t *pData);
+static void     _lcd_mirror_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint16_t RGBCode);
+static void     _lcd_mirror_ReadRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint16_t *pData);
+static void     _lcd_mirror_Scroll(int16_t Scroll, uint16_t TopFix, uint16_t BottonFix);
+static void     _lcd_mirror_WriteWindow(uint16_t *pData, uint32_t Size, uint8_t Continue);
+static uint8_t  _lcd_mirror_Refresh(void);
+
+static void _lcd_mirror_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+static void _lcd_mirror_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+static void _lcd_mirror_pixels(const uint16_t* data, uint32_t size, bool next);
+static bool _lcd_mirror_send_window(const lcd_mirror_rect_t* rect);
+static bool _lcd_mirror_send_data(const uint16_t* data, uint32_t size);
+static bool _lcd_mirror_send_scroll();
+static void _lcd_mirror_drop(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+static bool _lcd_mirror_read(lcd_mirror_rect_t* area, uint16_t* read_x, uint16_t* read_y);
+
+static bool     _lcd_mirror_begin(uint8_t type, unsigned payload);
+static unsigned _lcd_mirror_room(uint16_t packet);
+static bool     _lcd_mirror_space(unsigned size);
+static unsigned _lcd_mirror_free();
+static void _lcd_mirror_byte(uint8_t value);
+static void _lcd_mirror_u16(uint16_t value);
+static void _lcd_mirror_end();
+static void _lcd_mirror_transfer();
+
+
+LCD_DrvTypeDef lcd_mirror_drv = {
+	_lcd_mirror_Init,
+	_lcd_mirror_ReadID,
+	_lcd_mirror_DisplayOn,
+	_lcd_mirror_DisplayOff,
+	_lcd_mirror_SetCursor,
+	_lcd_mirror_WritePixel,
+	_lcd_mirror_ReadPixel,
+	_lcd_mirror_SetDisplayWindow,
+	_lcd_mirror_DrawHLine,
+	_lcd_mirror_DrawVLine,
+	_lcd_mirror_GetLcdPixelWidth,
+	_lcd_mirror_GetLcdPixelHeight,
+	_lcd_mirror_DrawBitmap,
+	_lcd_mirror_DrawRGBImage,
+	_lcd_mirror_FillRect,
+	_lcd_mirror_ReadRGBImage,
+	_lcd_mirror_Scroll,
+	_lcd_mirror_WriteWindow,
+	_lcd_mirror_Refresh,
+};
+
+extern LCD_DrvTypeDef* lcd_drv;
+
+
+/*
+ * The drawing calls are serialized by the display module (the DMA interrupt continues
+ * the queue only while the main loop does not draw), so the packets have one writer
+ * and the main loop is the only reader of the buffer
+ */
+static struct {
+	LCD_DrvTypeDef*   target;
+	bool              enabled;
+
+	uint8_t           buffer[LCD_MIRROR_BUFFER_SIZE];
+	/* End of the sent packets and start of the unsent ones */
+	volatile uint16_t head;
+	volatile uint16_t tail;
+	/* End of the packets before the buffer start (a packet is not split by the buffer end) */
+	volatile uint16_t wrap;
+	/* Start and end of the packet in progress */
+	uint16_t          packet;
+	uint16_t          write;
+	uint8_t           sum;
+	/* Bytes of the UART DMA transfer in progress */
+	uint16_t          sending;
+	/* The log output is sent by the UART, the next transfer waits for lcd_mirror_resume */
+	volatile bool     paused;
+
+	/* LCD window and the host window of the DATA packets (false - the host has another window) */
+	lcd_mirror_rect_t window;
+	bool              window_sent;
+	/* Pixels that the LCD window waits for: the read back is not started inside the window */
+	uint32_t          window_left;
+
+	int16_t           scroll;
+	uint16_t          scroll_top;
+	uint16_t          scroll_bottom;
+	bool              scroll_sent;
+
+	/* Bounds of the dropped rectangles and the read back position */
+	bool              dirty;
+	lcd_mirror_rect_t dirty_area;
+	uint16_t          dirty_x;
+	uint16_t          dirty_y;
+
+	lcd_mirror_rect_t sweep_area;
+	uint16_t          sweep_x;
+	uint16_t          sweep_y;
+	uint32_t          sweep_ms;
+
+	uint16_t          pixels[LCD_MIRROR_READ_PIXELS];
+
+	lcd_mirror_stats_t stats;
+} lcd_mirror;
+
+
+void lcd_mirror_init()
+{
+	if (lcd_drv == &lcd_mirror_drv) {
+		return;
+	}
+	lcd_mirror.target = lcd_drv;
+	lcd_drv = &lcd_mirror_drv;
+
+	lcd_mirror.wrap         = LCD_MIRROR_BUFFER_SIZE;
+	lcd_mirror.sweep_area.w = lcd_mirror.target->GetLcdPixelWidth();
+	lcd_mirror.sweep_area.h = lcd_mirror.target->GetLcdPixelHeight();
+}
+
+void lcd_mirror_enable(bool enable)
+{
+	if (!lcd_mirror.target || lcd_mirror.enabled == enable) {
+		return;
+	}
+	// The packets of the queued drawing calls are written from the LCD DMA interrupt
+	display_queue_wait();
+	lcd_mirror.enabled = enable;
+	if (!enable) {
+		return;
+	}
+
+	lcd_mirror.window_sent = false;
+	lcd_mirror.scroll_sent = false;
+	lcd_mirror.dirty       = false;
+	_lcd_mirror_drop(0, 0, lcd_mirror.sweep_area.w, lcd_mirror.sweep_area.h);
+	lcd_mirror.stats.dropped = 0;
+
+	if (_lcd_mirror_begin(LCD_MIRROR_INIT, 4)) {
+		_lcd_mirror_u16(lcd_mirror.sweep_area.w);
+		_lcd_mirror_u16(lcd_mirror.sweep_area.h);
+		_lcd_mirror_end();
+	}
+}
+
+bool lcd_mirror_enabled()
+{
+	return lcd_mirror.enabled;
+}
+
+void lcd_mirror_tick()
+{
+	_lcd_mirror_transfer();
+
+	if (!lcd_mirror.enabled || display_busy()) {
+		return;
+	}
+
+	if (!lcd_mirror.scroll_sent) {
+		lcd_mirror.scroll_sent = _lcd_mirror_send_scroll();
+	}
+
+	// The drawing calls go first: the read back takes the half of the buffer
+	if (_lcd_mirror_free() < LCD_MIRROR_BUFFER_SIZE / 2) {
+		return;
+	}
+	// The window that is written by parts is not changed by the read back
+	uint32_t window_size = (uint32_t)lcd_mirror.window.w * lcd_mirror.window.h;
+	if (lcd_mirror.window_left && lcd_mirror.window_left != window_size) {
+		return;
+	}
+
+	if (lcd_mirror.dirty) {
+		lcd_mirror.dirty = !_lcd_mirror_read(&lcd_mirror.dirty_area, &lcd_mirror.dirty_x, &lcd_mirror.dirty_y);
+		return;
+	}
+
+	if (HAL_GetTick() - lcd_mirror.sweep_ms < LCD_MIRROR_SWEEP_PERIOD_MS) {
+		return;
+	}
+	lcd_mirror.sweep_ms = HAL_GetTick();
+	if (_lcd_mirror_read(&lcd_mirror.sweep_area, &lcd_mirror.sweep_x, &lcd_mirror.sweep_y)) {
+		lcd_mirror.sweep_x = 0;
+		lcd_mirror.sweep_y = 0;
+	}
+}
+
+void lcd_mirror_wait()
+{
+	lcd_mirror.paused = true;
+	while (lcd_mirror.sending && !(DMA1->ISR & LCD_MIRROR_DMA_TCIF));
+	_lcd_mirror_transfer();
+}
+
+void lcd_mirror_resume()
+{
+	lcd_mirror.paused = false;
+}
+
+const lcd_mirror_stats_t* lcd_mirror_stats()
+{
+	return &lcd_mirror.stats;
+}
+
+void _lcd_mirror_Init(void)
+{
+	lcd_mirror.target->Init();
+	lcd_mirror.scroll      = 0;
+	lcd_mirror.scroll_top  = 0;
+	lcd_mirror.scroll_bottom = 0;
+	lcd_mirror.scroll_sent = false;
+	_lcd_mirror_window(0, 0, lcd_mirror.sweep_area.w, lcd_mirror.sweep_area.h);
+	_lcd_mirror_drop(0, 0, lcd_mirror.sweep_area.w, lcd_mirror.sweep_area.h);
+}
+
+uint16_t _lcd_mirror_ReadID(void)
+{
+	return lcd_mirror.target->ReadID();
+}
+
+void _lcd_mirror_DisplayOn(void)
+{
+	lcd_mirror.target->DisplayOn();
+}
+
+void _lcd_mirror_DisplayOff(void)
+{
+	lcd_mirror.target->DisplayOff();
+}
+
+void _lcd_mirror_SetCursor(uint16_t Xpos, uint16_t Ypos)
+{
+	lcd_mirror.target->SetCursor(Xpos, Ypos);
+	_lcd_mirror_window(Xpos, Ypos, 1, 1);
+}
+
+void _lcd_mirror_WritePixel(uint16_t Xpos, uint16_t Ypos, uint16_t RGBCode)
+{
+	lcd_mirror.target->WritePixel(Xpos, Ypos, RGBCode);
+	_lcd_mirror_fill(Xpos, Ypos, 1, 1, RGBCode);
+}
+
+uint16_t _lcd_mirror_ReadPixel(uint16_t Xpos, uint16_t Ypos)
+{
+	_lcd_mirror_window(Xpos, Ypos, 1, 1);
+	lcd_mirror.window_left = 0;
+	return lcd_mirror.target->ReadPixel(Xpos, Ypos);
+}
+
+void _lcd_mirror_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+	lcd_mirror.target->SetDisplayWindow(Xpos, Ypos, Width, Height);
+	_lcd_mirror_window(Xpos, Ypos, Width, Height);
+}
+
+void _lcd_mirror_DrawHLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length)
+{
+	lcd_mirror.target->DrawHLine(RGBCode, Xpos, Ypos, Length);
+	_lcd_mirror_fill(Xpos, Ypos, Length, 1, RGBCode);
+}
+
+void _lcd_mirror_DrawVLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length)
+{
+	lcd_mirror.target->DrawVLine(RGBCode, Xpos, Ypos, Length);
+	_lcd_mirror_fill(Xpos, Ypos, 1, Length, RGBCode);
+}
+
+uint16_t _lcd_mirror_GetLcdPixelWidth(void)
+{
+	return lcd_mirror.target->GetLcdPixelWidth();
+}
+
+uint16_t _lcd_mirror_GetLcdPixelHeight(void)
+{
+	return lcd_mirror.target->GetLcdPixelHeight();
+}
+
+/* The bitmap rows go up from the window bottom: the window is read back instead */
+void _lcd_mirror_DrawBitmap(uint16_t Xpos, uint16_t Ypos, uint8_t *pbmp)
+{
+	lcd_mirror.target->DrawBitmap(Xpos, Ypos, pbmp);
+	lcd_mirror.window_sent = false;
+	lcd_mirror.window_left = 0;
+	_lcd_mirror_drop(lcd_mirror.window.x, lcd_mirror.window.y, lcd_mirror.window.w, lcd_mirror.window.h);
+}
+
+void _lcd_mirror_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint16_t *pData)
+{
+	lcd_mirror.target->DrawRGBImage(Xpos, Ypos, Xsize, Ysize, pData);
+	_lcd_mirror_window(Xpos, Ypos, Xsize, Ysize);
+	lcd_mirror.window_left = 0;
+	_lcd_mirror_pixels(pData, (uint32_t)Xsize * Ysize, false);
+}
+
+void _lcd_mirror_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint16_t RGBCode)
+{
+	lcd_mirror.target->FillRect(Xpos, Ypos, Xsize, Ysize, RGBCode);
+	_lcd_mirror_fill(Xpos, Ypos, Xsize, Ysize, RGBCode);
+}
+
+void _lcd_mirror_ReadRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint16_t *pData)
+{
+	_lcd_mirror_window(Xpos, Ypos, Xsize, Ysize);
+	lcd_mirror.window_left = 0;
+	lcd_mirror.target->ReadRGBImage(Xpos, Ypos, Xsize, Ysize, pData);
+}
+
+void _lcd_mirror_Scroll(int16_t Scroll, uint16_t TopFix, uint16_t BottonFix)
+{
+	lcd_mirror.target->Scroll(Scroll, TopFix, BottonFix);
+	lcd_mirror.scroll        = Scroll;
+	lcd_mirror.scroll_top    = TopFix;
+	lcd_mirror.scroll_bottom = BottonFix;
+	// The not sent scroll is sent again by lcd_mirror_tick
+	lcd_mirror.scroll_sent   = lcd_mirror.enabled && _lcd_mirror_send_scroll();
+}
+
+void _lcd_mirror_WriteWindow(uint16_t *pData, uint32_t Size, uint8_t Continue)
+{
+	// The pixels are encoded before the DMA transfer of them has ended
+	lcd_mirror.target->WriteWindow(pData, Size, Continue);
+	if (!Continue) {
+		lcd_mirror.window_left = (uint32_t)lcd_mirror.window.w * lcd_mirror.window.h;
+	}
+	lcd_mirror.window_left = lcd_mirror.window_left > Size ? lcd_mirror.window_left - Size : 0;
+	_lcd_mirror_pixels(pData, Size, Continue);
+}
+
+uint8_t _lcd_mirror_Refresh(void)
+{
+	return lcd_mirror.target->Refresh();
+}
+
+/* The LCD window is changed by the call, the host window is sent before the next data */
+void _lcd_mirror_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	lcd_mirror.window.x = x;
+	lcd_mirror.window.y = y;
+	lcd_mirror.window.w = w;
+	lcd_mirror.window.h = h;
+	lcd_mirror.window_sent = false;
+	lcd_mirror.window_left = (uint32_t)w * h;
+}
+
+void _lcd_mirror_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+	_lcd_mirror_window(x, y, w, h);
+	lcd_mirror.window_left = 0;
+	if (!lcd_mirror.enabled) {
+		return;
+	}
+	if (!_lcd_mirror_begin(LCD_MIRROR_FILL, 10)) {
+		_lcd_mirror_drop(x, y, w, h);
+		return;
+	}
+	_lcd_mirror_u16(x);
+	_lcd_mirror_u16(y);
+	_lcd_mirror_u16(w);
+	_lcd_mirror_u16(h);
+	_lcd_mirror_u16(color);
+	_lcd_mirror_end();
+}
+
+/* next - the pixels continue the previous ones, the window with the lost pixels is read back */
+void _lcd_mirror_pixels(const uint16_t* data, uint32_t size, bool next)
+{
+	if (!lcd_mirror.enabled) {
+		return;
+	}
+	if (next && !lcd_mirror.window_sent) {
+		_lcd_mirror_drop(lcd_mirror.window.x, lcd_mirror.window.y, lcd_mirror.window.w, lcd_mirror.window.h);
+		return;
+	}
+	if (!next) {
+		lcd_mirror.window_sent = _lcd_mirror_send_window(&lcd_mirror.window);
+	}
+	if (!lcd_mirror.window_sent || !_lcd_mirror_send_data(data, size)) {
+		lcd_mirror.window_sent = false;
+		_lcd_mirror_drop(lcd_mirror.window.x, lcd_mirror.window.y, lcd_mirror.window.w, lcd_mirror.window.h);
+	}
+}
+
+bool _lcd_mirror_send_window(const lcd_mirror_rect_t* rect)
+{
+	if (!_lcd_mirror_begin(LCD_MIRROR_WINDOW, 8)) {
+		return false;
+	}
+	_lcd_mirror_u16(rect->x);
+	_lcd_mirror_u16(rect->y);
+	_lcd_mirror_u16(rect->w);
+	_lcd_mirror_u16(rect->h);
+	_lcd_mirror_end();
+	return true;
+}
+
+/*
+ * PackBits of the colors by the DATA packets, the packets before the not fitted one
+ * are kept (the host draws a part of the window until the read back).
+ * A packet takes the room before the buffer end, the next one starts from the buffer start.
+ */
+bool _lcd_mirror_send_data(const uint16_t* data, uint32_t size)
+{
+	uint32_t i = 0;
+	while (i < size) {
+		if (!_lcd_mirror_begin(LCD_MIRROR_DATA, 3)) {
+			return false;
+		}
+
+		unsigned limit = _lcd_mirror_room(lcd_mirror.packet) - LCD_MIRROR_PACKET_SIZE(0);
+		if (limit > LCD_MIRROR_PAYLOAD_MAX) {
+			limit = LCD_MIRROR_PAYLOAD_MAX;
+		}
+		unsigned payload = 0;
+		while (i < size && payload + 3 <= limit) {
+			uint32_t count = 1;
+			while (i + count < size && count < LCD_MIRROR_REPEAT_MAX && data[i + count] == data[i]) {
+				count++;
+			}
+			if (count >= LCD_MIRROR_REPEAT_MIN) {
+				_lcd_mirror_byte((uint8_t)(0x80 + count - LCD_MIRROR_REPEAT_MIN));
+				_lcd_mirror_u16(data[i]);
+				payload += 3;
+				i += count;
+				continue;
+			}
+
+			// The literal run ends before two equal colors
+			unsigned max = (limit - payload - 1) / 2;
+			if (max > LCD_MIRROR_LITERAL_MAX) {
+				max = LCD_MIRROR_LITERAL_MAX;
+			}
+			while (i + count < size && count < max &&
+				   !(i + count + 1 < size && data[i + count] == data[i + count + 1])
+			) {
+				count++;
+			}
+			_lcd_mirror_byte((uint8_t)(count - 1));
+			for (uint32_t j = 0; j < count; j++) {
+				_lcd_mirror_u16(data[i + j]);
+			}
+			payload += 1 + 2 * count;
+			i += count;
+		}
+		_lcd_mirror_end();
+	}
+	return true;
+}
+
+bool _lcd_mirror_send_scroll()
+{
+	if (!_lcd_mirror_begin(LCD_MIRROR_SCROLL, 6)) {
+		return false;
+	}
+	_lcd_mirror_u16((uint16_t)lcd_mirror.scroll);
+	_lcd_mirror_u16(lcd_mirror.scroll_top);
+	_lcd_mirror_u16(lcd_mirror.scroll_bottom);
+	_lcd_mirror_end();
+	return true;
+}
+
+/* Adds the rectangle to the read back bounds, the bounds are read from the start again */
+void _lcd_mirror_drop(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	lcd_mirror.stats.dropped++;
+	if (!w || !h) {
+		return;
+	}
+
+	lcd_mirror_rect_t* area = &lcd_mirror.dirty_area;
+	if (lcd_mirror.dirty) {
+		uint16_t x1 = (uint16_t)(x + w), y1 = (uint16_t)(y + h);
+		if (area->x + area->w > x1) {
+			x1 = (uint16_t)(area->x + area->w);
+		}
+		if (area->y + area->h > y1) {
+			y1 = (uint16_t)(area->y + area->h);
+		}
+		x = area->x < x ? area->x : x;
+		y = area->y < y ? area->y : y;
+		w = (uint16_t)(x1 - x);
+		h = (uint16_t)(y1 - y);
+	}
+	area->x = x;
+	area->y = y;
+	area->w = w;
+	area->h = h;
+	lcd_mirror.dirty   = true;
+	lcd_mirror.dirty_x = 0;
+	lcd_mirror.dirty_y = 0;
+}
+
+/*
+ * Reads back and sends the next row part of the area, true - the area has ended.
+ * The LCD window that waits for the pixels is set again after the read.
+ */
+bool _lcd_mirror_read(lcd_mirror_rect_t* area, uint16_t* read_x, uint16_t* read_y)
+{
+	uint16_t count = (uint16_t)(area->w - *read_x);
+	if (count > LCD_MIRROR_READ_PIXELS) {
+		count = LCD_MIRROR_READ_PIXELS;
+	}
+	lcd_mirror_rect_t part = { (uint16_t)(area->x + *read_x), (uint16_t)(area->y + *read_y), count, 1 };
+
+	lcd_mirror_rect_t window = lcd_mirror.window;
+	bool restore = lcd_mirror.window_left != 0;
+	lcd_mirror.target->ReadRGBImage(part.x, part.y, part.w, part.h, lcd_mirror.pixels);
+	if (restore) {
+		lcd_mirror.target->SetDisplayWindow(window.x, window.y, window.w, window.h);
+		_lcd_mirror_window(window.x, window.y, window.w, window.h);
+	} else {
+		_lcd_mirror_window(part.x, part.y, part.w, part.h);
+		lcd_mirror.window_left = 0;
+	}
+
+	bool sent = _lcd_mirror_send_window(&part) && _lcd_mirror_send_data(lcd_mirror.pixels, count);
+	lcd_mirror.window_sent = false;
+	if (!sent) {
+		return false;
+	}
+	lcd_mirror.stats.read += count;
+
+	*read_x = (uint16_t)(*read_x + count);
+	if (*read_x < area->w) {
+		return false;
+	}
+	*read_x = 0;
+	*read_y = (uint16_t)(*read_y + 1);
+	return *read_y >= area->h;
+}
+
+/*
+ * Starts the packet if the packet with the payload fits into the buffer.
+ * The packet that does not fit before the buffer end is started from the buffer start,
+ * so the UART DMA transfers and the log output between them have the whole packets.
+ */
+bool _lcd_mirror_begin(uint8_t type, unsigned payload)
+{
+	uint16_t head = lcd_mirror.head;
+	uint16_t tail = lcd_mirror.tail;
+	lcd_mirror.packet = head;
+	if (tail && head >= tail && !_lcd_mirror_space(LCD_MIRROR_PACKET_SIZE(payload))) {
+		lcd_mirror.packet = 0;
+	}
+	lcd_mirror.write = lcd_mirror.packet;
+	if (!_lcd_mirror_space(LCD_MIRROR_PACKET_SIZE(payload))) {
+		return false;
+	}
+	_lcd_mirror_byte(LCD_MIRROR_SYNC);
+	_lcd_mirror_byte(type);
+	_lcd_mirror_byte(0);
+	lcd_mirror.sum = type;
+	return true;
+}
+
+/* Bytes from the packet start up to the unsent packets or the buffer end (the head does not reach the tail) */
+unsigned _lcd_mirror_room(uint16_t packet)
+{
+	uint16_t tail = lcd_mirror.tail;
+	if (packet < tail) {
+		return (unsigned)(tail - packet - 1);
+	}
+	return (unsigned)(LCD_MIRROR_BUFFER_SIZE - packet - (tail ? 0 : 1));
+}
+
+/* size - bytes of the packet in progress from its start */
+bool _lcd_mirror_space(unsigned size)
+{
+	return size <= _lcd_mirror_room(lcd_mirror.packet);
+}
+
+unsigned _lcd_mirror_free()
+{
+	uint16_t used = (uint16_t)((lcd_mirror.head - lcd_mirror.tail + LCD_MIRROR_BUFFER_SIZE) % LCD_MIRROR_BUFFER_SIZE);
+	return (unsigned)(LCD_MIRROR_BUFFER_SIZE - 1 - used);
+}
+
+void _lcd_mirror_byte(uint8_t value)
+{
+	lcd_mirror.buffer[lcd_mirror.write] = value;
+	lcd_mirror.write = (uint16_t)((lcd_mirror.write + 1) % LCD_MIRROR_BUFFER_SIZE);
+	lcd_mirror.sum = (uint8_t)(lcd_mirror.sum + value);
+}
+
+void _lcd_mirror_u16(uint16_t value)
+{
+	_lcd_mirror_byte((uint8_t)(value & 0xFF));
+	_lcd_mirror_byte((uint8_t)(value >> 8));
+}
+
+/* Writes the length and the sum, the packet can be sent after it */
+void _lcd_mirror_end()
+{
+	uint16_t size = (uint16_t)((lcd_mirror.write - lcd_mirror.packet + LCD_MIRROR_BUFFER_SIZE) % LCD_MIRROR_BUFFER_SIZE);
+	uint8_t length = (uint8_t)(size - LCD_MIRROR_HEADER_SIZE);
+	lcd_mirror.buffer[(lcd_mirror.packet + 2) % LCD_MIRROR_BUFFER_SIZE] = length;
+	lcd_mirror.sum = (uint8_t)(lcd_mirror.sum + length);
+	_lcd_mirror_byte(lcd_mirror.sum);
+
+	lcd_mirror.stats.packets++;
+	lcd_mirror.stats.bytes += (uint32_t)size + 1;
+	if (lcd_mirror.packet != lcd_mirror.head) {
+		lcd_mirror.wrap = lcd_mirror.head;
+	} else if (!lcd_mirror.write) {
+		lcd_mirror.wrap = LCD_MIRROR_BUFFER_SIZE;
+	}
+	__DMB();
+	lcd_mirror.head   = lcd_mirror.write;
+	lcd_mirror.packet = lcd_mirror.write;
+}
+
+/*
+ * Ends the UART DMA transfer and starts the next one by the continuous part of the buffer
+ * up to the head or the wrap, the paused transfer is not started
+ */
+void _lcd_mirror_transfer()
+{
+	if (lcd_mirror.sending) {
+		if (!(DMA1->ISR & LCD_MIRROR_DMA_TCIF)) {
+			return;
+		}
+		DMA1->IFCR = LCD_MIRROR_DMA_CGIF;
+		LCD_MIRROR_DMA->CCR &= ~DMA_CCR_EN;
+		lcd_mirror.tail = (uint16_t)((lcd_mirror.tail + lcd_mirror.sending) % LCD_MIRROR_BUFFER_SIZE);
+		lcd_mirror.sending = 0;
+	}
+
+	if (lcd_mirror.paused) {
+		return;
+	}
+
+	uint16_t head = lcd_mirror.head;
+	uint16_t tail = lcd_mirror.tail;
+	if (head < tail && tail >= lcd_mirror.wrap) {
+		tail = 0;
+		lcd_mirror.tail = 0;
+	}
+	if (head == tail) {
+		return;
+	}
+
+	lcd_mirror.sending = (uint16_t)(head > tail ? head - tail : lcd_mirror.wrap - tail);
+	LCD_MIRROR_DMA->CPAR  = (uint32_t)&BEDUG_UART.Instance->DR;
+	LCD_MIRROR_DMA->CMAR  = (uint32_t)&lcd_mirror.buffer[tail];
+	LCD_MIRROR_DMA->CNDTR = lcd_mirror.sending;
+	LCD_MIRROR_DMA->CCR   = DMA_CCR_MINC | DMA_CCR_DIR;
+	BEDUG_UART.Instance->CR3 |= USART_CR3_DMAT;
+	LCD_MIRROR_DMA->CCR  |= DMA_CCR_EN;
+}
+
+
+#endif
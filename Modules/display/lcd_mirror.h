@@ -0,0 +1,100 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#ifndef _LCD_MIRROR_H_
+#define _LCD_MIRROR_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "lcd.h"
+
+
+/*
+ * Remote screen mirror: the driver between the display module and the LCD driver
+ * encodes every drawing call into packets of the ring buffer and the main loop sends them
+ * by the BEDUG_UART TX DMA (tools/mirror_viewer.py shows the screen on the host).
+ * The packet that does not fit into the buffer is dropped and its rectangle is read back
+ * from the LCD and sent again when the display is idle. The screen is also read back by
+ * a slow sweep, so the host image heals after the log lines mixed into the stream.
+ * The firmware is built with the mirror driver by -DLCD_MIRROR=1 (display_init connects it),
+ * the packets are sent after lcd_mirror_enable(true) (the 'm' command of the BEDUG_UART)
+ */
+#ifndef LCD_MIRROR
+#	define LCD_MIRROR (false)
+#endif
+
+#if LCD_MIRROR
+
+
+/*
+ * Packet: LCD_MIRROR_SYNC, type, payload length, payload, 8 bit sum of the type, length and payload.
+ * The numbers are little endian uint16_t, the colors are as they are sent to the LCD driver.
+ */
+#define LCD_MIRROR_SYNC           ((uint8_t)0xA5)
+#define LCD_MIRROR_PAYLOAD_MAX    (240)
+
+/* width, height: the host screen is cleared */
+#define LCD_MIRROR_INIT           ((uint8_t)'I')
+/* x, y, w, h: the next data is written from the window start */
+#define LCD_MIRROR_WINDOW         ((uint8_t)'W')
+/* x, y, w, h, color */
+#define LCD_MIRROR_FILL           ((uint8_t)'F')
+/* scroll (int16_t), top fix, bottom fix: the ili9341_Scroll arguments */
+#define LCD_MIRROR_SCROLL         ((uint8_t)'S')
+/*
+ * Window pixels after the previous data: the control byte C < 0x80 is followed by C + 1 colors,
+ * the control byte C >= 0x80 is followed by one color repeated C - 0x80 + 2 times
+ */
+#define LCD_MIRROR_DATA           ((uint8_t)'D')
+
+/* Bytes of the packets ring buffer, the UART sends ~11.5 bytes per millisecond at 115200 */
+#define LCD_MIRROR_BUFFER_SIZE    (1024)
+/* Pixels of one LCD read back */
+#define LCD_MIRROR_READ_PIXELS    (80)
+/* The sweep reads back one row part by the period: the whole screen in ~10 seconds */
+#define LCD_MIRROR_SWEEP_PERIOD_MS (10)
+
+
+typedef struct _lcd_mirror_stats_t {
+	uint32_t packets;
+	uint32_t bytes;
+	/* Drawing calls that have not fit into the buffer (their rectangles are read back) */
+	uint32_t dropped;
+	/* Pixels read back from the LCD */
+	uint32_t read;
+} lcd_mirror_stats_t;
+
+
+/* Connects the mirror driver before the current lcd_drv */
+void lcd_mirror_init();
+/* The enabled mirror sends the whole screen by the read back and then the drawing calls */
+void lcd_mirror_enable(bool enable);
+bool lcd_mirror_enabled();
+
+/* Sends the packets and reads back the dropped rectangles and the sweep row part */
+void lcd_mirror_tick();
+/*
+ * Waits for the end of the UART DMA transfer and does not start the next one
+ * until lcd_mirror_resume(): the log output is sent between the whole packets
+ */
+void lcd_mirror_wait();
+void lcd_mirror_resume();
+
+const lcd_mirror_stats_t* lcd_mirror_stats();
+
+
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
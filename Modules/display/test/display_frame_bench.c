@@ -0,0 +1,104 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Frame cost of the SPI1 polled and DMA paths on lcd_emu: the full clear and the footer redraw
+ * are counted by lcd_emu and converted to the time at the SPI1 clock.
+ * The polled path keeps the CPU for the whole transfer, the DMA path only for the commands
+ * and their parameters, the pixel data is sent by DMA1 channel 3 while the CPU runs.
+ */
+
+#include <stdio.h>
+
+#include "test.h"
+#include "display.h"
+#include "lcd_emu.h"
+
+
+/* APB2 72 MHz / 4 (LCD_SPI_SPD_WRITE 1) */
+#define FRAME_SPI_CLOCK_HZ (18000000)
+
+
+typedef struct _frame_cost_t {
+	uint32_t commands;
+	uint32_t bytes;
+	uint32_t spi_us;
+	uint32_t dma_cpu_us;
+} frame_cost_t;
+
+
+static frame_cost_t frame_cost(const char* name)
+{
+	const lcd_emu_stats_t* stats = lcd_emu_stats();
+	frame_cost_t cost = {
+		stats->commands,
+		stats->bytes,
+		lcd_emu_spi_time_us(FRAME_SPI_CLOCK_HZ),
+		0
+	};
+	uint64_t command_bits = (uint64_t)(stats->commands + stats->bytes - stats->pixels * 2) * 8;
+	cost.dma_cpu_us = (uint32_t)(command_bits * 1000000 / FRAME_SPI_CLOCK_HZ);
+
+	printf(
+		"%-16s commands=%-5lu bytes=%-7lu frame=%6lu us  CPU polled=%6lu us  DMA=%4lu us  freed=%6lu us\n",
+		name,
+		(unsigned long)cost.commands,
+		(unsigned long)cost.bytes,
+		(unsigned long)cost.spi_us,
+		(unsigned long)cost.spi_us,
+		(unsigned long)cost.dma_cpu_us,
+		(unsigned long)(cost.spi_us - cost.dma_cpu_us)
+	);
+	return cost;
+}
+
+static void bench_clear()
+{
+	display_init();
+	lcd_emu_reset_stats();
+	display_fill_rect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, DISPLAY_COLOR_WHITE);
+	display_queue_wait();
+
+	frame_cost_t cost = frame_cost("full clear");
+	TEST_CHECK(cost.bytes >= (uint32_t)DISPLAY_WIDTH * DISPLAY_HEIGHT * 2);
+	TEST_CHECK(cost.dma_cpu_us * 100 < cost.spi_us);
+}
+
+/* The three footer buttons of UI::showFooterButton */
+static void bench_footer()
+{
+	const display_icon_t* icons[] = {&settings_icon, &up_icon, &down_icon};
+
+	display_init();
+	lcd_emu_reset_stats();
+	uint16_t section = DISPLAY_WIDTH / 3;
+	uint16_t y = DISPLAY_HEADER_HEIGHT + DISPLAY_CONTENT_HEIGHT + 1;
+	uint16_t h = DISPLAY_HEIGHT - y;
+	uint16_t palette[] = {DISPLAY_COLOR_BLACK, DISPLAY_COLOR_WHITE};
+	for (unsigned i = 0; i < 3; i++) {
+		uint16_t x = i ? (uint16_t)(section * i + 1) : 0;
+		uint16_t w = i ? (uint16_t)(section - 1) : section;
+		display_compose_begin(x, y, w, h);
+		display_compose_fill(x, y, w, h, DISPLAY_COLOR_BLACK);
+		display_compose_icon(
+			(uint16_t)(x + section / 2),
+			(uint16_t)(y + DISPLAY_FOOTER_HEIGHT / 2),
+			DISPLAY_ALIGN_CENTER,
+			icons[i],
+			palette
+		);
+		display_compose_end();
+	}
+	display_queue_wait();
+
+	frame_cost_t cost = frame_cost("footer redraw");
+	TEST_CHECK(cost.bytes >= (uint32_t)(DISPLAY_WIDTH - 2) * h * 2);
+	TEST_CHECK(cost.dma_cpu_us < cost.spi_us);
+}
+
+
+int main()
+{
+	bench_clear();
+	bench_footer();
+	return TEST_RESULT();
+}
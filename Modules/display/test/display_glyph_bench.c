@@ -0,0 +1,86 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Glyph drawing benchmark of BSP_LCD_DisplayChar on lcd_emu: the 8x13 and 10x20 cyrillic fonts
+ * at the scales 1-3, the host chars per second of DrawChar/ExpandGlyphLine,
+ * the SPI bytes per char and the chars per second at the SPI1 clock
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "test.h"
+#include "gutils.h"
+#include "display.h"
+#include "lcd_emu.h"
+#include "stm32_adafruit_lcd.h"
+
+
+/* APB2 72 MHz / 4 (LCD_SPI_SPD_WRITE 1) */
+#define GLYPH_SPI_CLOCK_HZ (18000000)
+#define GLYPH_CHARS        (20000)
+#define GLYPH_SCALE_MAX    (3)
+
+
+/* Latin, digits and CP1251 cyrillic */
+static const char text[] = "Speed 12.5 mm \xD1\xEA\xEE\xF0\xEE\xF1\xF2\xFC \xC7\xCD\xC0\xD7\xC5\xCD\xC8\xC5:";
+
+
+static double seconds()
+{
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (double)time.tv_sec + (double)time.tv_nsec / 1e9;
+}
+
+static void bench_font(sFONT* font, const char* name, uint32_t scale)
+{
+	display_init();
+	BSP_LCD_SetFont(font);
+	BSP_LCD_SetTextColor(DISPLAY_COLOR_BLACK);
+	BSP_LCD_SetBackColor(DISPLAY_COLOR_WHITE);
+	lcd_emu_reset_stats();
+
+	uint16_t w = (uint16_t)(font->Width * scale);
+	uint16_t h = (uint16_t)(font->Height * scale);
+	uint16_t columns = (uint16_t)(DISPLAY_WIDTH / w);
+	uint16_t rows = (uint16_t)(DISPLAY_HEIGHT / h);
+
+	double start = seconds();
+	for (unsigned i = 0; i < GLYPH_CHARS; i++) {
+		unsigned cell = i % (unsigned)(columns * rows);
+		BSP_LCD_DisplayChar(
+			(uint16_t)(cell % columns * w),
+			(uint16_t)(cell / columns * h),
+			(uint8_t)text[i % (sizeof(text) - 1)],
+			scale
+		);
+	}
+	double elapsed = seconds() - start;
+
+	const lcd_emu_stats_t* stats = lcd_emu_stats();
+	uint32_t spi_us = lcd_emu_spi_time_us(GLYPH_SPI_CLOCK_HZ);
+	printf(
+		"%-28s x%lu  host=%9.0f chars/s  SPI=%6.1f bytes/char  %3.1f commands/char  %6.0f chars/s at 18 MHz\n",
+		name,
+		(unsigned long)scale,
+		GLYPH_CHARS / elapsed,
+		(double)(stats->commands + stats->bytes) / GLYPH_CHARS,
+		(double)stats->commands / GLYPH_CHARS,
+		spi_us ? GLYPH_CHARS * 1e6 / spi_us : 0.0
+	);
+
+	/* The glyph pixels are sent once: the cell and the window */
+	TEST_CHECK(stats->pixels == (uint32_t)GLYPH_CHARS * w * h);
+}
+
+
+int main()
+{
+	for (uint32_t scale = 1; scale <= GLYPH_SCALE_MAX; scale++) {
+		bench_font(&u8g2_font_8x13_t_cyrillic, "u8g2_font_8x13_t_cyrillic", scale);
+		bench_font(&u8g2_font_10x20_t_cyrillic, "u8g2_font_10x20_t_cyrillic", scale);
+	}
+	return TEST_RESULT();
+}
@@ -0,0 +1,32 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * The display of the host tests: lcd_emu instead of the ILI9341 driver
+ * and the SPI DMA state that lcd_io_spi.c keeps on the target
+ */
+
+#include "lcd_emu.h"
+
+
+LCD_DrvTypeDef* lcd_drv = &lcd_emu_drv;
+
+volatile uint32_t LCD_IO_DmaTransferStatus = 0;
+volatile uint32_t LCD_IO_DmaTxNoWait = 0;
+
+
+void LCD_IO_DmaTxIrqMask(uint32_t mask)
+{
+	(void)mask;
+}
+
+void LCD_IO_SetSpeed(uint32_t SpdWrite, uint32_t SpdRead)
+{
+	(void)SpdWrite;
+	(void)SpdRead;
+}
+
+
+uint32_t system_micros(void)
+{
+	return 0;
+}
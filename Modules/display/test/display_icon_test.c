@@ -0,0 +1,227 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Icon tests on lcd_emu: every display_icon_t drawn by display_draw_icon is
+ * pixel by pixel its source icons/<name>.pbm (run from Modules/display).
+ * The icon is also drawn by the replay of the glyph table path it has replaced
+ * (one window and a write per glyph row, the bit offset computed per pixel):
+ * the SPI commands, bytes and time at the SPI1 clock and the host cycles are printed for both.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+#include "bench.h"
+#include "lcd.h"
+#include "display.h"
+#include "lcd_emu.h"
+
+
+/* APB2 72 MHz / 4 (LCD_SPI_SPD_WRITE 1) */
+#define ICON_SPI_CLOCK_HZ (18000000)
+#define ICON_SIZE_MAX     (64)
+#define ICON_BENCH_DRAWS  (200)
+
+
+typedef struct _icon_source_t {
+	const char*           name;
+	const display_icon_t* icon;
+} icon_source_t;
+
+typedef struct _icon_cost_t {
+	uint32_t commands;
+	uint32_t bytes;
+	uint32_t spi_us;
+	uint64_t cycles;
+} icon_cost_t;
+
+
+extern LCD_DrvTypeDef* lcd_drv;
+
+
+static const icon_source_t sources[] = {
+	{"settings", &settings_icon},
+	{"back",     &back_icon},
+	{"save",     &save_icon},
+	{"surface",  &surface_icon},
+	{"string",   &string_icon},
+	{"bigski",   &bigski_icon},
+	{"left",     &left_icon},
+	{"right",    &right_icon},
+	{"up",       &up_icon},
+	{"down",     &down_icon},
+};
+
+/* The PBM pixels: 1 is black */
+static struct {
+	unsigned width;
+	unsigned height;
+	uint8_t  bits[ICON_SIZE_MAX * ICON_SIZE_MAX / 8];
+} pbm;
+
+static uint16_t line[ICON_SIZE_MAX];
+
+
+/* The next number of the plain PBM (P1) after the whitespaces and the comments */
+static int pbm_number(FILE* file, unsigned* value, bool digit)
+{
+	int ch = fgetc(file);
+	while (ch != EOF) {
+		if (ch == '#') {
+			while (ch != EOF && ch != '\n') {
+				ch = fgetc(file);
+			}
+		} else if (ch >= '0' && ch <= '9') {
+			break;
+		} else {
+			ch = fgetc(file);
+		}
+	}
+	if (ch == EOF) {
+		return 0;
+	}
+	if (digit) {
+		*value = (unsigned)(ch - '0');
+		return 1;
+	}
+	ungetc(ch, file);
+	return fscanf(file, "%u", value);
+}
+
+static bool pbm_load(const char* name)
+{
+	char path[64];
+	snprintf(path, sizeof(path), "icons/%s.pbm", name);
+	FILE* file = fopen(path, "r");
+	if (!file) {
+		printf("%s: not found\n", path);
+		return false;
+	}
+
+	char magic[3] = {0};
+	bool loaded = fread(magic, 1, 2, file) == 2 &&
+		!strcmp(magic, "P1") &&
+		pbm_number(file, &pbm.width, false) == 1 &&
+		pbm_number(file, &pbm.height, false) == 1 &&
+		pbm.width <= ICON_SIZE_MAX &&
+		pbm.height <= ICON_SIZE_MAX;
+
+	memset(pbm.bits, 0, sizeof(pbm.bits));
+	for (unsigned i = 0; loaded && i < pbm.width * pbm.height; i++) {
+		unsigned bit = 0;
+		loaded = pbm_number(file, &bit, true) == 1;
+		pbm.bits[i >> 3] |= (uint8_t)(bit << (7 - (i & 0x07)));
+	}
+	fclose(file);
+	if (!loaded) {
+		printf("%s: is not a plain PBM\n", path);
+	}
+	return loaded;
+}
+
+static bool pbm_bit(unsigned bit_num)
+{
+	return (pbm.bits[bit_num >> 3] >> (7 - (bit_num & 0x07))) & 0x01;
+}
+
+static icon_cost_t icon_cost(uint64_t cycles)
+{
+	const lcd_emu_stats_t* stats = lcd_emu_stats();
+	icon_cost_t cost = {
+		stats->commands / ICON_BENCH_DRAWS,
+		stats->bytes / ICON_BENCH_DRAWS,
+		lcd_emu_spi_time_us(ICON_SPI_CLOCK_HZ) / ICON_BENCH_DRAWS,
+		cycles / ICON_BENCH_DRAWS
+	};
+	return cost;
+}
+
+/* The replaced path: the icon was a one glyph font drawn by DrawChar */
+static void glyph_draw(const uint16_t* palette)
+{
+	lcd_drv->SetDisplayWindow(0, 0, (uint16_t)pbm.width, (uint16_t)pbm.height);
+	for (unsigned row = 0; row < pbm.height; row++) {
+		unsigned bit_num = row * pbm.width;
+		for (unsigned x = 0; x < pbm.width; x++, bit_num++) {
+			line[x] = palette[pbm_bit(bit_num)];
+		}
+		lcd_drv->WriteWindow(line, pbm.width, row != 0);
+	}
+}
+
+static void test_icon(const icon_source_t* source)
+{
+	const display_icon_t* icon = source->icon;
+	if (!pbm_load(source->name)) {
+		TEST_CHECK(false);
+		return;
+	}
+	TEST_CHECK(icon->width == pbm.width);
+	TEST_CHECK(icon->height == pbm.height);
+	TEST_CHECK(icon->colors == 2);
+	if (icon->width != pbm.width || icon->height != pbm.height || icon->colors != 2) {
+		return;
+	}
+
+	display_init();
+	display_draw_icon(0, 0, DISPLAY_ALIGN_LEFT, icon, NULL);
+	display_queue_wait();
+
+	unsigned differences = 0;
+	for (unsigned y = 0; y < pbm.height; y++) {
+		for (unsigned x = 0; x < pbm.width; x++) {
+			uint16_t expected = icon->palette[pbm_bit(y * pbm.width + x)];
+			uint16_t pixel = lcd_emu_pixel((uint16_t)x, (uint16_t)y);
+			if (pixel != expected && !differences++) {
+				printf("%s pixel %u,%u: %04X != %04X\n", source->name, x, y, pixel, expected);
+			}
+		}
+	}
+	TEST_CHECK(differences == 0);
+
+	lcd_emu_reset_stats();
+	uint64_t start = bench_cycles();
+	for (unsigned i = 0; i < ICON_BENCH_DRAWS; i++) {
+		glyph_draw(icon->palette);
+	}
+	icon_cost_t glyph = icon_cost(bench_cycles() - start);
+
+	lcd_emu_reset_stats();
+	start = bench_cycles();
+	for (unsigned i = 0; i < ICON_BENCH_DRAWS; i++) {
+		display_draw_icon(0, 0, DISPLAY_ALIGN_LEFT, icon, NULL);
+		display_queue_wait();
+	}
+	icon_cost_t packed = icon_cost(bench_cycles() - start);
+
+	printf(
+		"%-8s %2ux%-2u %4u B  glyph: commands=%-3lu bytes=%-5lu %4lu us %7lu cycles"
+		"  packed: commands=%-3lu bytes=%-5lu %4lu us %7lu cycles\n",
+		source->name,
+		pbm.width,
+		pbm.height,
+		(unsigned)icon->size,
+		(unsigned long)glyph.commands,
+		(unsigned long)glyph.bytes,
+		(unsigned long)glyph.spi_us,
+		(unsigned long)glyph.cycles,
+		(unsigned long)packed.commands,
+		(unsigned long)packed.bytes,
+		(unsigned long)packed.spi_us,
+		(unsigned long)packed.cycles
+	);
+
+	/* The same pixels in the fewer writes */
+	TEST_CHECK(packed.commands <= glyph.commands);
+	TEST_CHECK(packed.bytes <= glyph.bytes);
+}
+
+
+int main()
+{
+	for (unsigned i = 0; i < sizeof(sources) / sizeof(*sources); i++) {
+		test_icon(&sources[i]);
+	}
+	return TEST_RESULT();
+}
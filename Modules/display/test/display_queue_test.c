@@ -0,0 +1,169 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Display queue replay: a random stream of fills, texts and icons is drawn
+ * by the queued functions and again by the direct drawing,
+ * the lcd_emu screens must be equal
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+#include "display.h"
+#include "gutils.h"
+#include "lcd_emu.h"
+#include "stm32_adafruit_lcd.h"
+
+
+#define REPLAY_OPERATIONS (600)
+
+typedef enum _REPLAY_OPERATION {
+	REPLAY_FILL = 0,
+	REPLAY_TEXT,
+	REPLAY_ICON,
+	REPLAY_COUNT
+} REPLAY_OPERATION;
+
+
+static const display_icon_t* icons[] = {
+	&settings_icon,
+	&back_icon,
+	&save_icon,
+	&left_icon,
+	&right_icon,
+	&up_icon,
+	&down_icon,
+};
+
+static sFONT* fonts[] = {
+	&u8g2_font_8x13_t_cyrillic,
+	&u8g2_font_10x20_t_cyrillic,
+};
+
+static const uint16_t colors[] = {
+	DISPLAY_COLOR_WHITE,
+	DISPLAY_COLOR_BLACK,
+	DISPLAY_COLOR_LIGHT_GRAY,
+	DISPLAY_COLOR_LIGHT_GRAY2,
+};
+
+static const char text[] = "Sensitivity 0123456789 Speed 12.5 mm";
+
+static uint16_t screen[LCD_EMU_HEIGHT][LCD_EMU_WIDTH];
+static uint32_t seed = 0;
+
+
+static uint32_t replay_random(uint32_t range)
+{
+	seed = seed * 1664525u + 1013904223u;
+	return (seed >> 8) % range;
+}
+
+/* Draws the stream by the queued (queued = true) or the direct drawing */
+static void replay(bool queued)
+{
+	display_init();
+	seed = 12345;
+
+	for (unsigned i = 0; i < REPLAY_OPERATIONS; i++) {
+		uint16_t x = (uint16_t)replay_random(LCD_EMU_WIDTH);
+		uint16_t y = (uint16_t)replay_random(LCD_EMU_HEIGHT);
+		uint16_t color = colors[replay_random(__arr_len(colors))];
+
+		switch (replay_random(REPLAY_COUNT)) {
+		case REPLAY_FILL:
+		{
+			uint16_t w = (uint16_t)(1 + replay_random(LCD_EMU_WIDTH - x));
+			uint16_t h = (uint16_t)(1 + replay_random(LCD_EMU_HEIGHT - y));
+			if (queued) {
+				display_fill_rect(x, y, w, h, color);
+			} else {
+				lcd_emu_drv.FillRect(x, y, w, h, color);
+			}
+			break;
+		}
+		case REPLAY_TEXT:
+		{
+			sFONT* font = fonts[replay_random(__arr_len(fonts))];
+			uint32_t scale = 1 + replay_random(2);
+			unsigned max_len = (unsigned)((LCD_EMU_WIDTH - x) / (font->Width * scale));
+			unsigned len = max_len < strlen(text) ? max_len : strlen(text);
+			if (!len || y + font->Height * scale > LCD_EMU_HEIGHT) {
+				break;
+			}
+			len = 1 + replay_random(len);
+			display_set_color(color);
+			display_set_background(colors[replay_random(__arr_len(colors))]);
+			if (queued) {
+				display_text_show(x, y, font, DISPLAY_ALIGN_LEFT, text, len, scale);
+			} else {
+				display_text_run(x, y, font, DISPLAY_ALIGN_LEFT, text, len, scale);
+			}
+			break;
+		}
+		case REPLAY_ICON:
+		{
+			const display_icon_t* icon = icons[replay_random(__arr_len(icons))];
+			if (x + icon->width > LCD_EMU_WIDTH || y + icon->height > LCD_EMU_HEIGHT) {
+				break;
+			}
+			if (queued) {
+				display_draw_icon(x, y, DISPLAY_ALIGN_LEFT, icon, NULL);
+			} else {
+				display_compose_begin(x, y, icon->width, icon->height);
+				display_compose_icon(x, y, DISPLAY_ALIGN_LEFT, icon, NULL);
+				display_compose_end();
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	display_queue_wait();
+}
+
+static void test_replay()
+{
+	const display_queue_stats_t* stats = display_queue_stats();
+	uint32_t commands = stats->commands;
+
+	replay(true);
+	TEST_CHECK(display_queue_depth() == 0);
+	TEST_CHECK(stats->commands - commands > REPLAY_OPERATIONS / 2);
+	for (uint16_t y = 0; y < LCD_EMU_HEIGHT; y++) {
+		for (uint16_t x = 0; x < LCD_EMU_WIDTH; x++) {
+			screen[y][x] = lcd_emu_pixel(x, y);
+		}
+	}
+
+	replay(false);
+	unsigned differences = 0;
+	for (uint16_t y = 0; y < LCD_EMU_HEIGHT; y++) {
+		for (uint16_t x = 0; x < LCD_EMU_WIDTH; x++) {
+			if (screen[y][x] != lcd_emu_pixel(x, y) && !differences++) {
+				printf("pixel %u,%u: %04X != %04X\n", x, y, screen[y][x], lcd_emu_pixel(x, y));
+			}
+		}
+	}
+	TEST_CHECK(differences == 0);
+}
+
+/* The queued fill keeps the text color of the next direct drawing */
+static void test_fill_keeps_color()
+{
+	display_init();
+	display_set_color(DISPLAY_COLOR_BLACK);
+	display_fill_rect(0, 0, 10, 10, DISPLAY_COLOR_LIGHT_GRAY);
+	TEST_CHECK(BSP_LCD_GetTextColor() == DISPLAY_COLOR_BLACK);
+}
+
+
+int main()
+{
+	test_replay();
+	test_fill_keeps_color();
+	return TEST_RESULT();
+}
@@ -0,0 +1,71 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * SPI clock calibration tests: the calibration keeps the screen
+ */
+
+#include "test.h"
+#include "display.h"
+#include "lcd_emu.h"
+
+
+static uint16_t screen[LCD_EMU_HEIGHT][LCD_EMU_WIDTH];
+
+
+static void screen_draw()
+{
+	display_init();
+	for (uint16_t y = 0; y < LCD_EMU_HEIGHT; y++) {
+		for (uint16_t x = 0; x < LCD_EMU_WIDTH; x++) {
+			lcd_emu_drv.WritePixel(x, y, (uint16_t)(x * 7 + y * 131));
+			screen[y][x] = lcd_emu_pixel(x, y);
+		}
+	}
+}
+
+static bool screen_kept()
+{
+	for (uint16_t y = 0; y < LCD_EMU_HEIGHT; y++) {
+		for (uint16_t x = 0; x < LCD_EMU_WIDTH; x++) {
+			if (screen[y][x] != lcd_emu_pixel(x, y)) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static void test_calibrate()
+{
+	screen_draw();
+
+	display_spi_t spi = {DISPLAY_SPI_DIVIDER_NONE, DISPLAY_SPI_DIVIDER_NONE, 0};
+	TEST_CHECK(display_spi_calibrate(&spi));
+	/* The emulator passes every divider: the fastest one with the margin */
+	TEST_CHECK(spi.write_divider == 1);
+	TEST_CHECK(spi.read_divider == 1);
+	TEST_CHECK(screen_kept());
+}
+
+static void test_apply()
+{
+	screen_draw();
+
+	display_spi_t spi = {2, 3, 0};
+	TEST_CHECK(display_spi_apply(&spi));
+	TEST_CHECK(spi.write_divider == 2);
+	TEST_CHECK(spi.read_divider == 3);
+	TEST_CHECK(screen_kept());
+
+	spi.write_divider = DISPLAY_SPI_DIVIDER_NONE;
+	TEST_CHECK(!display_spi_apply(&spi));
+	TEST_CHECK(screen_kept());
+}
+
+
+int main()
+{
+	test_calibrate();
+	test_apply();
+	return TEST_RESULT();
+}
@@ -0,0 +1,105 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Text run tests on lcd_emu: the line drawn by BSP_LCD_DisplayChar per character
+ * and by one BSP_LCD_DisplayStringRun (display_text_run) gives the same pixels
+ * with the fewer commands and bytes, one display window per run instead of per character
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+#include "display.h"
+#include "lcd_emu.h"
+#include "stm32_adafruit_lcd.h"
+
+
+#define RUN_Y            (40)
+#define RUN_SCALE_MAX    (2)
+/* CASET and RASET parameters of one display window */
+#define RUN_WINDOW_BYTES (8)
+
+
+/* CP1251 "ЗНАЧЕНИЕ: 12.5" */
+static const char text[] = "\xC7\xCD\xC0\xD7\xC5\xCD\xC8\xC5: 12.5";
+
+static uint16_t line[LCD_EMU_HEIGHT][LCD_EMU_WIDTH];
+
+
+typedef struct _run_cost_t {
+	uint32_t commands;
+	uint32_t bytes;
+	uint32_t pixels;
+} run_cost_t;
+
+
+static run_cost_t run_cost()
+{
+	const lcd_emu_stats_t* stats = lcd_emu_stats();
+	run_cost_t cost = {stats->commands, stats->bytes, stats->pixels};
+	return cost;
+}
+
+static void draw_start(sFONT* font)
+{
+	display_init();
+	BSP_LCD_SetFont(font);
+	BSP_LCD_SetTextColor(DISPLAY_COLOR_BLACK);
+	BSP_LCD_SetBackColor(DISPLAY_COLOR_WHITE);
+	lcd_emu_reset_stats();
+}
+
+static void test_run(sFONT* font, const char* name, uint32_t scale)
+{
+	unsigned len = (unsigned)strlen(text);
+
+	draw_start(font);
+	for (unsigned i = 0; i < len; i++) {
+		BSP_LCD_DisplayChar((uint16_t)(i * font->Width * scale), RUN_Y, (uint8_t)text[i], scale);
+	}
+	run_cost_t chars = run_cost();
+	for (uint16_t y = 0; y < LCD_EMU_HEIGHT; y++) {
+		for (uint16_t x = 0; x < LCD_EMU_WIDTH; x++) {
+			line[y][x] = lcd_emu_pixel(x, y);
+		}
+	}
+
+	draw_start(font);
+	display_text_run(0, RUN_Y, font, DISPLAY_ALIGN_LEFT, text, len, scale);
+	run_cost_t run = run_cost();
+
+	unsigned differences = 0;
+	for (uint16_t y = 0; y < LCD_EMU_HEIGHT; y++) {
+		for (uint16_t x = 0; x < LCD_EMU_WIDTH; x++) {
+			differences += line[y][x] != lcd_emu_pixel(x, y);
+		}
+	}
+
+	printf(
+		"%-28s x%lu  chars: commands=%-4lu bytes=%-6lu  run: commands=%-4lu bytes=%-6lu\n",
+		name,
+		(unsigned long)scale,
+		(unsigned long)chars.commands,
+		(unsigned long)chars.bytes,
+		(unsigned long)run.commands,
+		(unsigned long)run.bytes
+	);
+
+	TEST_CHECK(differences == 0);
+	TEST_CHECK(run.pixels == chars.pixels);
+	/* One window per run: the commands of one character for the whole line */
+	TEST_CHECK(run.commands * (len / 2) <= chars.commands);
+	TEST_CHECK(run.bytes < chars.bytes);
+	TEST_CHECK(chars.bytes - run.bytes == (len - 1) * RUN_WINDOW_BYTES);
+}
+
+
+int main()
+{
+	for (uint32_t scale = 1; scale <= RUN_SCALE_MAX; scale++) {
+		test_run(&u8g2_font_8x13_t_cyrillic, "u8g2_font_8x13_t_cyrillic", scale);
+		test_run(&u8g2_font_10x20_t_cyrillic, "u8g2_font_10x20_t_cyrillic", scale);
+	}
+	return TEST_RESULT();
+}
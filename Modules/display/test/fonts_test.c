@@ -0,0 +1,52 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * FONT_GetGlyphLine tests: the glyph lines and the reads out of the font
+ */
+
+#include "test.h"
+#include "fonts.h"
+
+
+static void test_glyph_lines(const sFONT* font)
+{
+	uint32_t bits = 0;
+	for (uint32_t line = 0; line < font->Height; line++) {
+		bits |= FONT_GetGlyphLine(font, 'A', line);
+	}
+	TEST_CHECK(bits);
+	TEST_CHECK(bits < (1UL << font->Width));
+
+	for (uint32_t line = 0; line < font->Height; line++) {
+		TEST_CHECK(FONT_GetGlyphLine(font, ' ', line) == 0);
+	}
+}
+
+static void test_out_of_font(const sFONT* font)
+{
+	/* The last glyph line is followed by the next glyph in the table */
+	TEST_CHECK(FONT_GetGlyphLine(font, 'A', font->Height) == 0);
+	TEST_CHECK(FONT_GetGlyphLine(font, 'A', 0xFFFFFFFF) == 0);
+	TEST_CHECK(FONT_GetGlyphLine(font, '\n', 0) == 0);
+
+	/* CP1251 0x80 is not used by the sources */
+	TEST_CHECK(font->map[0x80 - ' '] == FONT_NO_GLYPH);
+	for (uint32_t line = 0; line < font->Height; line++) {
+		TEST_CHECK(FONT_GetGlyphLine(font, 0x80, line) == 0);
+	}
+
+	for (unsigned i = 0; i < 0x100 - ' '; i++) {
+		TEST_CHECK(font->map[i] == FONT_NO_GLYPH || font->map[i] < font->count);
+	}
+}
+
+
+int main()
+{
+	const sFONT* fonts[] = {&u8g2_font_8x13_t_cyrillic, &u8g2_font_10x20_t_cyrillic};
+	for (unsigned i = 0; i < sizeof(fonts) / sizeof(*fonts); i++) {
+		test_glyph_lines(fonts[i]);
+		test_out_of_font(fonts[i]);
+	}
+	return TEST_RESULT();
+}
@@ -0,0 +1,58 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * lcd_emu tests: the panel RAM writes and the reads out of the panel
+ */
+
+#include <string.h>
+
+#include "test.h"
+#include "lcd_emu.h"
+
+
+static void test_write_read()
+{
+	lcd_emu_drv.Init();
+	lcd_emu_drv.FillRect(10, 20, 3, 2, 0x1234);
+	lcd_emu_drv.WritePixel(0, 0, 0xABCD);
+
+	TEST_CHECK(lcd_emu_drv.ReadPixel(0, 0) == 0xABCD);
+	TEST_CHECK(lcd_emu_drv.ReadPixel(12, 21) == 0x1234);
+	TEST_CHECK(lcd_emu_drv.ReadPixel(13, 21) == 0);
+	TEST_CHECK(lcd_emu_pixel(10, 20) == 0x1234);
+}
+
+static void test_read_out_of_panel()
+{
+	lcd_emu_drv.Init();
+	lcd_emu_drv.FillRect(0, 0, LCD_EMU_WIDTH, LCD_EMU_HEIGHT, 0x5555);
+
+	TEST_CHECK(lcd_emu_drv.ReadPixel(LCD_EMU_WIDTH, 0) == 0);
+	TEST_CHECK(lcd_emu_drv.ReadPixel(0, LCD_EMU_HEIGHT) == 0);
+	TEST_CHECK(lcd_emu_drv.ReadPixel(0xFFFF, 0xFFFF) == 0);
+	TEST_CHECK(lcd_emu_drv.ReadPixel(LCD_EMU_WIDTH - 1, LCD_EMU_HEIGHT - 1) == 0x5555);
+
+	/* 2x2 at the bottom right corner: one pixel on the panel */
+	uint16_t data[4];
+	memset(data, 0xFF, sizeof(data));
+	lcd_emu_drv.ReadRGBImage(LCD_EMU_WIDTH - 1, LCD_EMU_HEIGHT - 1, 2, 2, data);
+	TEST_CHECK(data[0] == 0x5555);
+	TEST_CHECK(data[1] == 0);
+	TEST_CHECK(data[2] == 0);
+	TEST_CHECK(data[3] == 0);
+
+	/* The coordinates overflow uint16_t */
+	memset(data, 0xFF, sizeof(data));
+	lcd_emu_drv.ReadRGBImage(0xFFFF, 0xFFFF, 2, 2, data);
+	for (unsigned i = 0; i < 4; i++) {
+		TEST_CHECK(data[i] == 0);
+	}
+}
+
+
+int main()
+{
+	test_write_read();
+	test_read_out_of_panel();
+	return TEST_RESULT();
+}
@@ -0,0 +1,275 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * lcd_mirror tests on lcd_emu and a fake BEDUG_UART TX DMA: every DMA transfer has
+ * the whole packets (the buffer wrap too), the transfer is not started between
+ * lcd_mirror_wait() and lcd_mirror_resume() and the screen decoded from the stream
+ * is the lcd_emu screen after the read back
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+#include "main.h"
+#include "gtime.h"
+#include "display.h"
+#include "gutils.h"
+#include "lcd_emu.h"
+#include "lcd_mirror.h"
+
+
+#define MIRROR_OPERATIONS (400)
+#define MIRROR_DRAIN_TICKS (LCD_EMU_WIDTH * LCD_EMU_HEIGHT / LCD_MIRROR_READ_PIXELS * 2)
+#define MIRROR_HEADER_SIZE (3)
+
+
+static const uint16_t colors[] = {
+	DISPLAY_COLOR_WHITE,
+	DISPLAY_COLOR_BLACK,
+	DISPLAY_COLOR_LIGHT_GRAY,
+	DISPLAY_COLOR_LIGHT_GRAY2,
+};
+
+static const char text[] = "Sensitivity 0123456789 Speed 12.5 mm";
+
+/* The host side of the stream */
+static struct {
+	uint16_t pixels[LCD_EMU_HEIGHT][LCD_EMU_WIDTH];
+	uint16_t x0, y0, x1, y1;
+	uint16_t x, y;
+} host;
+
+static uint32_t seed = 0;
+static const uint8_t* buffer_start = NULL;
+static unsigned transfers = 0;
+static unsigned wraps = 0;
+static unsigned broken = 0;
+static unsigned packets = 0;
+
+
+static uint32_t mirror_random(uint32_t range)
+{
+	seed = seed * 1664525u + 1013904223u;
+	return (seed >> 8) % range;
+}
+
+static uint16_t u16(const uint8_t* data)
+{
+	return (uint16_t)(data[0] | data[1] << 8);
+}
+
+static void host_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	host.x0 = host.x = x;
+	host.y0 = host.y = y;
+	host.x1 = (uint16_t)(x + w - 1);
+	host.y1 = (uint16_t)(y + h - 1);
+}
+
+static void host_write(uint16_t color)
+{
+	if (host.x < LCD_EMU_WIDTH && host.y < LCD_EMU_HEIGHT) {
+		host.pixels[host.y][host.x] = color;
+	}
+	if (host.x < host.x1) {
+		host.x++;
+		return;
+	}
+	host.x = host.x0;
+	host.y = host.y < host.y1 ? (uint16_t)(host.y + 1) : host.y0;
+}
+
+static void host_packet(uint8_t type, const uint8_t* payload, unsigned length)
+{
+	packets++;
+	switch (type) {
+	case LCD_MIRROR_WINDOW:
+		host_window(u16(payload), u16(payload + 2), u16(payload + 4), u16(payload + 6));
+		break;
+	case LCD_MIRROR_FILL:
+		for (unsigned y = u16(payload + 2); y < (unsigned)(u16(payload + 2) + u16(payload + 6)) && y < LCD_EMU_HEIGHT; y++) {
+			for (unsigned x = u16(payload); x < (unsigned)(u16(payload) + u16(payload + 4)) && x < LCD_EMU_WIDTH; x++) {
+				host.pixels[y][x] = u16(payload + 8);
+			}
+		}
+		break;
+	case LCD_MIRROR_DATA:
+		for (unsigned i = 0; i < length;) {
+			uint8_t control = payload[i++];
+			if (control < 0x80) {
+				for (unsigned j = 0; j <= control; j++, i += 2) {
+					host_write(u16(payload + i));
+				}
+			} else {
+				for (unsigned j = 0; j < control - 0x80u + 2; j++) {
+					host_write(u16(payload + i));
+				}
+				i += 2;
+			}
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+/* The transfer is parsed alone: it starts by a packet and ends by a packet end */
+static void host_transfer(const uint8_t* data, unsigned size)
+{
+	unsigned i = 0;
+	while (i + MIRROR_HEADER_SIZE <= size && data[i] == LCD_MIRROR_SYNC) {
+		uint8_t type = data[i + 1];
+		uint8_t length = data[i + 2];
+		if (i + MIRROR_HEADER_SIZE + length + 1 > size) {
+			break;
+		}
+		uint8_t sum = (uint8_t)(type + length);
+		for (unsigned j = 0; j < length; j++) {
+			sum = (uint8_t)(sum + data[i + MIRROR_HEADER_SIZE + j]);
+		}
+		if (sum != data[i + MIRROR_HEADER_SIZE + length]) {
+			break;
+		}
+		host_packet(type, &data[i + MIRROR_HEADER_SIZE], length);
+		i += MIRROR_HEADER_SIZE + length + 1u;
+	}
+	if (i != size) {
+		broken++;
+	}
+}
+
+/*
+ * CMAR keeps the low 32 bits of the 64 bit host address:
+ * the buffer is in the lcd_mirror state before the stats
+ */
+static const uint8_t* dma_address(uint32_t address)
+{
+	uintptr_t stats = (uintptr_t)lcd_mirror_stats();
+	uintptr_t data = (stats & ~(uintptr_t)UINT32_MAX) | address;
+	if (data > stats) {
+		data -= (uintptr_t)UINT32_MAX + 1;
+	}
+	return (const uint8_t*)data;
+}
+
+/* The DMA sends the started transfer at once */
+static void dma_run()
+{
+	if (!(DMA1_Channel4->CCR & DMA_CCR_EN) || (DMA1->ISR & DMA_ISR_TCIF4)) {
+		return;
+	}
+	const uint8_t* data = dma_address(DMA1_Channel4->CMAR);
+	if (!buffer_start) {
+		buffer_start = data;
+	}
+	if (transfers && data == buffer_start) {
+		wraps++;
+	}
+	transfers++;
+	host_transfer(data, DMA1_Channel4->CNDTR);
+	DMA1->ISR |= DMA_ISR_TCIF4;
+}
+
+static void mirror_tick()
+{
+	dma_run();
+	lcd_mirror_tick();
+	if (DMA1->IFCR & DMA_IFCR_CGIF4) {
+		DMA1->ISR &= ~DMA_ISR_TCIF4;
+		DMA1->IFCR = 0;
+	}
+}
+
+/* _write of the firmware: the log goes after the sent transfer */
+static void mirror_log()
+{
+	dma_run();
+	lcd_mirror_wait();
+	DMA1->ISR &= ~DMA_ISR_TCIF4;
+	DMA1->IFCR = 0;
+	TEST_CHECK(!(DMA1_Channel4->CCR & DMA_CCR_EN));
+
+	lcd_mirror_tick();
+	TEST_CHECK(!(DMA1_Channel4->CCR & DMA_CCR_EN));
+
+	lcd_mirror_resume();
+}
+
+static void mirror_draw()
+{
+	uint16_t x = (uint16_t)mirror_random(LCD_EMU_WIDTH);
+	uint16_t y = (uint16_t)mirror_random(LCD_EMU_HEIGHT);
+	uint16_t color = colors[mirror_random(__arr_len(colors))];
+	if (mirror_random(2)) {
+		uint16_t w = (uint16_t)(1 + mirror_random(LCD_EMU_WIDTH - x));
+		uint16_t h = (uint16_t)(1 + mirror_random(LCD_EMU_HEIGHT - y));
+		display_fill_rect(x, y, w, h, color);
+		return;
+	}
+	sFONT* font = &u8g2_font_8x13_t_cyrillic;
+	unsigned len = (unsigned)((LCD_EMU_WIDTH - x) / font->Width);
+	if (!len || y + font->Height > LCD_EMU_HEIGHT) {
+		return;
+	}
+	len = 1 + mirror_random(len < strlen(text) ? len : strlen(text));
+	display_set_color(color);
+	display_set_background(colors[mirror_random(__arr_len(colors))]);
+	display_text_show(x, y, font, DISPLAY_ALIGN_LEFT, text, len, 1);
+}
+
+static void test_mirror()
+{
+	lcd_mirror_init();
+	display_init();
+	lcd_mirror_enable(true);
+	seed = 54321;
+
+	for (unsigned i = 0; i < MIRROR_OPERATIONS; i++) {
+		mirror_draw();
+		display_queue_wait();
+		if (mirror_random(4)) {
+			mirror_tick();
+		}
+		if (!mirror_random(8)) {
+			mirror_log();
+		}
+	}
+	for (unsigned i = 0; i < MIRROR_DRAIN_TICKS; i++) {
+		test_millis += LCD_MIRROR_SWEEP_PERIOD_MS;
+		mirror_tick();
+	}
+	/* The packets up to the wrap and from the buffer start are two transfers */
+	mirror_tick();
+	mirror_tick();
+	dma_run();
+
+	TEST_CHECK(broken == 0);
+	TEST_CHECK(wraps > 0);
+	TEST_CHECK(packets == lcd_mirror_stats()->packets);
+
+	unsigned differences = 0;
+	for (uint16_t y = 0; y < LCD_EMU_HEIGHT; y++) {
+		for (uint16_t x = 0; x < LCD_EMU_WIDTH; x++) {
+			if (host.pixels[y][x] != lcd_emu_pixel(x, y) && !differences++) {
+				printf("pixel %u,%u: %04X != %04X\n", x, y, host.pixels[y][x], lcd_emu_pixel(x, y));
+			}
+		}
+	}
+	TEST_CHECK(differences == 0);
+	printf(
+		"transfers=%u wraps=%u packets=%lu dropped=%lu read=%lu\n",
+		transfers,
+		wraps,
+		(unsigned long)lcd_mirror_stats()->packets,
+		(unsigned long)lcd_mirror_stats()->dropped,
+		(unsigned long)lcd_mirror_stats()->read
+	);
+}
+
+
+int main()
+{
+	test_mirror();
+	return TEST_RESULT();
+}
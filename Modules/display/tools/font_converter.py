@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+# Copyright © 2024 Georgy E. All rights reserved.
+#
+# Generates a subset sFONT from a glyph sheet: only the printable ASCII characters
+# and the characters of the string literals of the sources (CP1251) are stored.
+# Blank top and bottom lines of every glyph are cut off,
+# the rest lines are packed by the font width (MSB first, the glyph starts from a byte).
+#
+#   font_converter.py fonts/u8g2_font_8x13_t_cyrillic.pbm ../Language/translate.c ../UI/*.cpp \
+#       > Lcd/Fonts/u8g2_font_8x13_t_cyrillic.c
+#
+# The sheet is a PBM image of 16x14 glyphs starting from ' ', the font name is the file name.
+# Flash sizes are printed to stderr.
+#
+#   font_converter.py --check Lcd/Fonts/u8g2_font_8x13_t_cyrillic.c fonts/u8g2_font_8x13_t_cyrillic.pbm \
+#       ../Language/translate.c
+#
+# fails (exit code 1) if the generated font is not the same as the file:
+# the characters of the sources without the glyph in the file are printed.
+
+import io
+import os
+import re
+import sys
+
+from icon_converter import read_pnm
+
+
+HEADER = "/* Copyright © 2024 Georgy E. All rights reserved. */\n"
+SHEET_COLUMNS = 16
+SHEET_ROWS = 14
+FIRST_CHAR = 0x20
+NO_GLYPH = 0xFF
+GLYPH_STRUCT_SIZE = 4
+FONT_STRUCT_SIZE = 20
+
+GLYPH_COMMENT = re.compile(r"/\* 0x([0-9A-F]{2}) \*/")
+LITERAL = re.compile(rb'"((?:[^"\\\n]|\\.)*)"|\'((?:[^\'\\\n]|\\.)+)\'')
+
+
+def read_sheet(path):
+    width, height, pixels, _ = read_pnm(path)
+    if width % SHEET_COLUMNS or height % SHEET_ROWS:
+        raise ValueError("%s: the sheet must be %dx%d glyphs" % (path, SHEET_COLUMNS, SHEET_ROWS))
+
+    glyph_width = width // SHEET_COLUMNS
+    glyph_height = height // SHEET_ROWS
+    glyphs = []
+    for index in range(SHEET_COLUMNS * SHEET_ROWS):
+        left = (index % SHEET_COLUMNS) * glyph_width
+        top = (index // SHEET_COLUMNS) * glyph_height
+        glyphs.append([
+            [int(pixels[(top + y) * width + left + x] == (0, 0, 0)) for x in range(glyph_width)]
+            for y in range(glyph_height)
+        ])
+    return glyph_width, glyph_height, glyphs
+
+
+def used_chars(paths):
+    chars = set(range(FIRST_CHAR, 0x7F))
+    for path in paths:
+        with open(path, "rb") as file:
+            data = file.read()
+        for match in LITERAL.finditer(data):
+            literal = match.group(1) if match.group(1) is not None else match.group(2)
+            chars.update(byte for byte in literal if byte >= 0x80)
+    return sorted(chars)
+
+
+def pack_glyph(width, lines):
+    rows = [i for i, line in enumerate(lines) if any(line)]
+    if not rows:
+        return 0, 0, b""
+
+    top, bottom = rows[0], rows[-1] + 1
+    data = bytearray()
+    byte, bits = 0, 0
+    for line in lines[top:bottom]:
+        for bit in line:
+            byte = (byte << 1) | bit
+            bits += 1
+            if bits == 8:
+                data.append(byte)
+                byte, bits = 0, 0
+    if bits:
+        data.append(byte << (8 - bits))
+    return top, bottom - top, bytes(data)
+
+
+def print_array(out, ctype, name, values, fmt, per_line):
+    print("static const %s %s[] = {" % (ctype, name), file=out)
+    for i in range(0, len(values), per_line):
+        print("\t" + ", ".join(fmt % value for value in values[i:i + per_line]) + ",", file=out)
+    print("};", file=out)
+
+
+def check(font_path, text, chars):
+    with open(font_path, encoding="utf-8") as file:
+        current = file.read()
+    if current == text:
+        return 0
+
+    stored = {int(code, 16) for code in GLYPH_COMMENT.findall(current)}
+    missing = [char for char in chars if char >= 0x80 and char not in stored]
+    if missing:
+        print(
+            "%s: no glyphs of %s" % (font_path, " ".join("0x%02X" % char for char in missing)),
+            file=sys.stderr
+        )
+    print("%s: the font is not up to date, run tools/font_converter.py" % font_path, file=sys.stderr)
+    return 1
+
+
+def main(args):
+    font_path = None
+    if args[:1] == ["--check"] and len(args) > 1:
+        font_path, args = args[1], args[2:]
+    if not args:
+        print("usage: font_converter.py [--check font.c] <sheet.pbm> [source.c]... > font.c", file=sys.stderr)
+        return 1
+
+    path, sources = args[0], args[1:]
+    name = os.path.splitext(os.path.basename(path))[0]
+    chars = used_chars(sources)
+    out = io.StringIO()
+    width, height, glyphs = read_sheet(path)
+
+    table = bytearray()
+    glyph_list = []
+    glyph_map = [NO_GLYPH] * (SHEET_COLUMNS * SHEET_ROWS)
+    for char in chars:
+        top, rows, data = pack_glyph(width, glyphs[char - FIRST_CHAR])
+        if len(glyph_list) >= NO_GLYPH:
+            raise ValueError("too many glyphs")
+        glyph_map[char - FIRST_CHAR] = len(glyph_list)
+        glyph_list.append((len(table), top, rows, char))
+        table += data
+
+    print(HEADER, file=out)
+    print("/* Generated by tools/font_converter.py from fonts/%s */" % os.path.basename(path), file=out)
+    print(file=out)
+    print("#include \"fonts.h\"", file=out)
+    print(file=out)
+    print(file=out)
+    print_array(out, "uint8_t", name + "_table", list(table), "0x%02X", 12)
+    print(file=out)
+    print_array(out, "uint8_t", name + "_map", glyph_map, "%3d", 16)
+    print(file=out)
+    print("static const sGLYPH %s_glyphs[] = {" % name, file=out)
+    for offset, top, rows, char in glyph_list:
+        print("\t{%4d, %2d, %2d}, /* 0x%02X */" % (offset, top, rows, char), file=out)
+    print("};", file=out)
+    print(file=out)
+    print(file=out)
+    print("sFONT %s = {" % name, file=out)
+    print("\t%s_table," % name, file=out)
+    print("\t%d," % width, file=out)
+    print("\t%d," % height, file=out)
+    print("\t%s_map," % name, file=out)
+    print("\t%s_glyphs," % name, file=out)
+    print("\t%d" % len(glyph_list), file=out)
+    print("};", file=out)
+
+    if font_path:
+        return check(font_path, out.getvalue(), chars)
+
+    full = (len(glyphs) * width * height + 7) // 8 + FONT_STRUCT_SIZE
+    subset = len(table) + len(glyph_map) + GLYPH_STRUCT_SIZE * len(glyph_list) + FONT_STRUCT_SIZE
+    print(
+        "%s: %d of %d glyphs, full table %d B, subset %d B (table %d B, map %d B, glyphs %d B)" %
+        (name, len(glyph_list), len(glyphs), full, subset, len(table), len(glyph_map), GLYPH_STRUCT_SIZE * len(glyph_list)),
+        file=sys.stderr
+    )
+    sys.stdout.write(out.getvalue())
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
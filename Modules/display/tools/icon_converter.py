@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+# Copyright © 2024 Georgy E. All rights reserved.
+#
+# Converts PBM/PGM/PPM (P1-P6) images to display_icon_t sources:
+# palette indexes are packed by 1/2/4 bits per pixel (MSB first, rows padded to a byte)
+# and compressed with PackBits.
+#
+#   icon_converter.py icons/*.pbm > icons.c
+#
+# The icon name is the file name with the "_icon" suffix.
+# PBM black is the icon color (index 1) on the white background (index 0),
+# PGM/PPM colors are indexed in the order of appearance.
+# Flash sizes are printed to stderr.
+
+import os
+import sys
+
+
+HEADER = "/* Copyright © 2024 Georgy E. All rights reserved. */\n"
+ICON_STRUCT_SIZE = 16
+
+
+def read_tokens(data, count, pos):
+    tokens = []
+    while len(tokens) < count:
+        while pos < len(data) and chr(data[pos]).isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            while pos < len(data) and data[pos:pos + 1] not in (b"\n", b"\r"):
+                pos += 1
+            continue
+        start = pos
+        while pos < len(data) and not chr(data[pos]).isspace():
+            pos += 1
+        tokens.append(data[start:pos].decode())
+    return tokens, pos + 1
+
+
+def read_pnm(path):
+    with open(path, "rb") as file:
+        data = file.read()
+
+    magic = data[:2].decode()
+    if magic not in ("P1", "P2", "P3", "P4", "P5", "P6"):
+        raise ValueError("%s: unsupported image format %s" % (path, magic))
+
+    header_len = 2 if magic in ("P1", "P4") else 3
+    header, pos = read_tokens(data, header_len, 2)
+    width, height = int(header[0]), int(header[1])
+    maxval = int(header[2]) if header_len == 3 else 1
+
+    pixels = []
+    if magic == "P1":
+        digits = "".join(ch for ch in data[pos - 1:].decode() if ch in "01")
+        pixels = [(0, 0, 0) if ch == "1" else (maxval, maxval, maxval) for ch in digits[:width * height]]
+    elif magic == "P4":
+        row_bytes = (width + 7) // 8
+        for y in range(height):
+            row = data[pos + y * row_bytes:pos + (y + 1) * row_bytes]
+            for x in range(width):
+                bit = (row[x >> 3] >> (7 - (x & 7))) & 1
+                pixels.append((0, 0, 0) if bit else (maxval, maxval, maxval))
+    elif magic in ("P2", "P3"):
+        channels = 1 if magic == "P2" else 3
+        values, _ = read_tokens(data, width * height * channels, pos - 1)
+        values = [int(value) for value in values]
+        for i in range(width * height):
+            pixel = values[i * channels:(i + 1) * channels]
+            pixels.append(tuple(pixel * 3) if channels == 1 else tuple(pixel))
+    else:
+        channels = 1 if magic == "P5" else 3
+        for i in range(width * height):
+            pixel = list(data[pos + i * channels:pos + (i + 1) * channels])
+            pixels.append(tuple(pixel * 3) if channels == 1 else tuple(pixel))
+
+    if len(pixels) != width * height:
+        raise ValueError("%s: not enough pixels" % path)
+
+    rgb = [tuple(channel * 255 // maxval for channel in pixel) for pixel in pixels]
+    return width, height, rgb, magic in ("P1", "P4")
+
+
+def rgb565(pixel):
+    r, g, b = pixel
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def palette_of(pixels, bitmap):
+    if bitmap:
+        return [(255, 255, 255), (0, 0, 0)]
+    palette = []
+    for pixel in pixels:
+        if pixel not in palette:
+            palette.append(pixel)
+    if len(palette) > 16:
+        raise ValueError("more than 16 colors")
+    return palette
+
+
+def pack(width, height, indexes, bpp):
+    data = bytearray()
+    for y in range(height):
+        byte, bits = 0, 0
+        for x in range(width):
+            byte = (byte << bpp) | indexes[y * width + x]
+            bits += bpp
+            if bits == 8:
+                data.append(byte)
+                byte, bits = 0, 0
+        if bits:
+            data.append(byte << (8 - bits))
+    return bytes(data)
+
+
+def packbits(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run > 1:
+            out += bytes([(257 - run) & 0xFF, data[i]])
+            i += run
+            continue
+
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 1 < len(data) and data[i + 1] == data[i]:
+                break
+            i += 1
+        out += bytes([i - start - 1]) + data[start:i]
+    return bytes(out)
+
+
+def unpackbits(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        n = data[i]
+        i += 1
+        if n < 128:
+            out += data[i:i + n + 1]
+            i += n + 1
+        elif n > 128:
+            out += bytes([data[i]]) * (257 - n)
+            i += 1
+    return bytes(out)
+
+
+def color_name(pixel):
+    if pixel == (255, 255, 255):
+        return "DISPLAY_COLOR_WHITE"
+    if pixel == (0, 0, 0):
+        return "DISPLAY_COLOR_BLACK"
+    return "DISPLAY_COLOR((uint16_t)0x%04X)" % rgb565(pixel)
+
+
+def convert(path):
+    width, height, pixels, bitmap = read_pnm(path)
+    palette = palette_of(pixels, bitmap)
+    indexes = [palette.index(pixel) for pixel in pixels]
+    bpp = 1 if len(palette) <= 2 else 2 if len(palette) <= 4 else 4
+
+    packed = pack(width, height, indexes, bpp)
+    data = packbits(packed)
+    assert unpackbits(data) == packed
+
+    name = os.path.splitext(os.path.basename(path))[0] + "_icon"
+    return name, width, height, bpp, palette, packed, data
+
+
+def print_icon(name, width, height, bpp, palette, data):
+    print("static const uint16_t %s_palette[] = {" % name)
+    print("\t" + ", ".join(color_name(pixel) for pixel in palette))
+    print("};")
+    print("")
+    print("static const uint8_t %s_data[] = {" % name)
+    for i in range(0, len(data), 12):
+        print("\t" + ", ".join("0x%02X" % byte for byte in data[i:i + 12]) + ",")
+    print("};")
+    print("")
+    print("const display_icon_t %s = {" % name)
+    print("\t%d," % width)
+    print("\t%d," % height)
+    print("\t%d," % bpp)
+    print("\t%d," % len(palette))
+    print("\t%s_palette," % name)
+    print("\t%s_data," % name)
+    print("\tsizeof(%s_data)" % name)
+    print("};")
+
+
+def main(paths):
+    if not paths:
+        print("usage: icon_converter.py <image.pnm>... > icons.c", file=sys.stderr)
+        return 1
+
+    print(HEADER)
+    print("/* Generated by tools/icon_converter.py from icons/ */")
+    print("")
+    print("#include <stdint.h>")
+    print("")
+    print("#include \"display.h\"")
+
+    total_raw, total_icon = 0, 0
+    for path in paths:
+        name, width, height, bpp, palette, packed, data = convert(path)
+        print("")
+        print("")
+        print_icon(name, width, height, bpp, palette, data)
+
+        raw = width * height * 2
+        icon = len(data) + 2 * len(palette) + ICON_STRUCT_SIZE
+        total_raw += raw
+        total_icon += icon
+        print(
+            "%-14s %3dx%-3d %d bpp: RGB565 %5d B, packed %4d B, PackBits %4d B, icon %4d B" %
+            (name, width, height, bpp, raw, len(packed), len(data), icon),
+            file=sys.stderr
+        )
+
+    print("total: RGB565 %d B, icons %d B" % (total_raw, total_icon), file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
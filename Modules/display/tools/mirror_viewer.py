@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+# Copyright © 2024 Georgy E. All rights reserved.
+#
+# Shows the screen of the LCD_MIRROR firmware from the BEDUG_UART stream (lcd_mirror.h packets).
+# The bytes out of the packets are the log and are printed to stdout.
+#
+#   mirror_viewer.py /dev/ttyUSB0              the window (tkinter) with the live screen
+#   mirror_viewer.py capture.bin -o screen.ppm  the screen after the captured stream
+#
+# The serial port needs pyserial, the viewer sends 'm' to the port to start the mirror.
+# The panel memory, window and scroll are kept like lcd_emu.c does,
+# the colors are shown inverted as the LCD_EMU_INVERTED panel shows them.
+
+import argparse
+import struct
+import sys
+
+
+SYNC = 0xA5
+PAYLOAD_MAX = 240
+BAUDRATE = 115200
+INVERTED = True
+SCALE = 2
+REFRESH_MS = 50
+
+INIT = ord("I")
+WINDOW = ord("W")
+FILL = ord("F")
+SCROLL = ord("S")
+DATA = ord("D")
+
+PAYLOAD_SIZE = {INIT: 4, WINDOW: 8, FILL: 10, SCROLL: 6}
+
+
+class Screen:
+    def __init__(self, width=240, height=320):
+        self.reset(width, height)
+
+    def reset(self, width, height):
+        self.width = width
+        self.height = height
+        self.pixels = [[0xFFFF] * width for _ in range(height)]
+        self.window(0, 0, width, height)
+        self.scroll_top = 0
+        self.scroll_area = height
+        self.scroll_start = 0
+
+    def window(self, x, y, w, h):
+        self.x0, self.y0 = x, y
+        self.x1, self.y1 = x + w - 1, y + h - 1
+        self.cursor_x, self.cursor_y = x, y
+
+    def write(self, color):
+        if self.cursor_x < self.width and self.cursor_y < self.height:
+            self.pixels[self.cursor_y][self.cursor_x] = color
+        if self.cursor_x < self.x1:
+            self.cursor_x += 1
+            return
+        self.cursor_x = self.x0
+        self.cursor_y = self.cursor_y + 1 if self.cursor_y < self.y1 else self.y0
+
+    def fill(self, x, y, w, h, color):
+        for row in range(y, min(y + h, self.height)):
+            for col in range(x, min(x + w, self.width)):
+                self.pixels[row][col] = color
+
+    def scroll(self, scroll, top, bottom):
+        if top + bottom >= self.height:
+            return
+        self.scroll_top = top
+        self.scroll_area = self.height - top - bottom
+        self.scroll_start = (-scroll) % self.scroll_area + top
+
+    def data(self, payload):
+        i = 0
+        while i < len(payload):
+            control = payload[i]
+            i += 1
+            if control < 0x80:
+                for _ in range(control + 1):
+                    self.write(payload[i] | payload[i + 1] << 8)
+                    i += 2
+            else:
+                color = payload[i] | payload[i + 1] << 8
+                i += 2
+                for _ in range(control - 0x80 + 2):
+                    self.write(color)
+
+    def pixel(self, x, y):
+        row = y
+        if self.scroll_top <= y < self.scroll_top + self.scroll_area:
+            row = self.scroll_top + (y - self.scroll_top + self.scroll_start - self.scroll_top) % self.scroll_area
+        return self.pixels[row][x]
+
+    def rgb(self):
+        out = bytearray()
+        for y in range(self.height):
+            for x in range(self.width):
+                color = self.pixel(x, y) ^ (0xFFFF if INVERTED else 0)
+                out += bytes((
+                    ((color >> 11) & 0x1F) * 255 // 0x1F,
+                    ((color >> 5) & 0x3F) * 255 // 0x3F,
+                    (color & 0x1F) * 255 // 0x1F,
+                ))
+        return bytes(out)
+
+    def save_ppm(self, path):
+        with open(path, "wb") as file:
+            file.write(b"P6\n%d %d\n255\n" % (self.width, self.height))
+            file.write(self.rgb())
+
+
+class Parser:
+    def __init__(self, screen, log=sys.stdout):
+        self.screen = screen
+        self.log = log
+        self.buffer = bytearray()
+        self.packets = 0
+        self.errors = 0
+
+    def feed(self, data):
+        self.buffer += data
+        changed = False
+        while self.buffer:
+            start = self.buffer.find(bytes((SYNC,)))
+            if start < 0:
+                start = len(self.buffer)
+            if start:
+                self.text(self.buffer[:start])
+                del self.buffer[:start]
+                continue
+            if len(self.buffer) < 3:
+                break
+            packet_type, length = self.buffer[1], self.buffer[2]
+            if length > PAYLOAD_MAX or PAYLOAD_SIZE.get(packet_type, length) != length or \
+                    (packet_type not in PAYLOAD_SIZE and packet_type != DATA):
+                self.skip()
+                continue
+            if len(self.buffer) < length + 4:
+                break
+            payload = bytes(self.buffer[3:3 + length])
+            if (packet_type + length + sum(payload)) & 0xFF != self.buffer[3 + length]:
+                self.skip()
+                continue
+            del self.buffer[:length + 4]
+            self.packet(packet_type, payload)
+            changed = True
+        return changed
+
+    def skip(self):
+        self.errors += 1
+        self.text(self.buffer[:1])
+        del self.buffer[:1]
+
+    def text(self, data):
+        if self.log:
+            self.log.write(data.decode("cp1251", "replace"))
+            self.log.flush()
+
+    def packet(self, packet_type, payload):
+        self.packets += 1
+        if packet_type == INIT:
+            self.screen.reset(*struct.unpack("<2H", payload))
+        elif packet_type == WINDOW:
+            self.screen.window(*struct.unpack("<4H", payload))
+        elif packet_type == FILL:
+            self.screen.fill(*struct.unpack("<5H", payload))
+        elif packet_type == SCROLL:
+            self.screen.scroll(*struct.unpack("<h2H", payload))
+        elif packet_type == DATA:
+            self.screen.data(payload)
+
+
+def show(port, parser):
+    import tkinter
+
+    root = tkinter.Tk()
+    root.title("mirror " + port.name)
+    label = tkinter.Label(root)
+    label.pack()
+    image = None
+
+    def update():
+        nonlocal image
+        if parser.feed(port.read(port.in_waiting or 1)) or image is None:
+            screen = parser.screen
+            ppm = b"P6\n%d %d\n255\n" % (screen.width, screen.height) + screen.rgb()
+            image = tkinter.PhotoImage(data=ppm, format="ppm").zoom(SCALE)
+            label.configure(image=image)
+        root.after(REFRESH_MS, update)
+
+    update()
+    root.mainloop()
+
+
+def main():
+    arguments = argparse.ArgumentParser(description="LCD_MIRROR screen viewer")
+    arguments.add_argument("source", help="serial port or the captured stream file")
+    arguments.add_argument("-o", "--output", help="PPM file of the screen after the stream")
+    arguments.add_argument("-b", "--baudrate", type=int, default=BAUDRATE)
+    options = arguments.parse_args()
+
+    parser = Parser(Screen())
+    if options.output:
+        with open(options.source, "rb") as file:
+            parser.feed(file.read())
+        parser.screen.save_ppm(options.output)
+        print("packets=%d errors=%d" % (parser.packets, parser.errors), file=sys.stderr)
+        return 0
+
+    import serial
+
+    with serial.Serial(options.source, options.baudrate, timeout=0) as port:
+        port.write(b"m")
+        show(port, parser)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,146 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#include "format.h"
+
+#include <string.h>
+
+
+/* Decimal digits of UINT32_MAX */
+#define FORMAT_DIGITS_MAX (10)
+
+
+static void _format_digits(format_t* format, uint32_t value, unsigned min_digits);
+
+
+void format_init(format_t* format, char* buffer, unsigned size)
+{
+	format->buffer = buffer;
+	format->size   = size;
+	format->length = 0;
+	if (size) {
+		buffer[0] = 0;
+	}
+}
+
+void format_char(format_t* format, char c)
+{
+	if (format->length + 1 >= format->size) {
+		return;
+	}
+	format->buffer[format->length++] = c;
+	format->buffer[format->length]   = 0;
+}
+
+void format_str(format_t* format, const char* str)
+{
+	while (*str && format->length + 1 < format->size) {
+		format->buffer[format->length++] = *str++;
+	}
+	if (format->size) {
+		format->buffer[format->length] = 0;
+	}
+}
+
+void format_uint(format_t* format, uint32_t value)
+{
+	_format_digits(format, value, 1);
+}
+
+void format_uint_digits(format_t* format, uint32_t value, unsigned min_digits)
+{
+	if (min_digits > FORMAT_DIGITS_MAX) {
+		min_digits = FORMAT_DIGITS_MAX;
+	}
+	_format_digits(format, value, min_digits);
+}
+
+void format_int(format_t* format, int32_t value)
+{
+	if (value < 0) {
+		format_char(format, '-');
+	}
+	_format_digits(format, value < 0 ? 0 - (uint32_t)value : (uint32_t)value, 1);
+}
+
+void format_fixed(format_t* format, int32_t value, unsigned frac_digits)
+{
+	if (frac_digits >= FORMAT_DIGITS_MAX) {
+		frac_digits = FORMAT_DIGITS_MAX - 1;
+	}
+
+	uint32_t divider = 1;
+	for (unsigned i = 0; i < frac_digits; i++) {
+		divider *= 10;
+	}
+
+	uint32_t abs_value = value < 0 ? 0 - (uint32_t)value : (uint32_t)value;
+	if (value < 0) {
+		format_char(format, '-');
+	}
+	_format_digits(format, abs_value / divider, 1);
+	if (!frac_digits) {
+		return;
+	}
+	format_char(format, '.');
+	_format_digits(format, abs_value % divider, frac_digits);
+}
+
+unsigned format_align(format_t* format, unsigned width, FORMAT_ALIGN align)
+{
+	if (!format->size) {
+		return 0;
+	}
+	if (width > format->size - 1) {
+		width = format->size - 1;
+	}
+	if (format->length >= width) {
+		return format->length;
+	}
+
+	unsigned spaces = width - format->length;
+	unsigned left   = 0;
+	switch (align) {
+	case FORMAT_ALIGN_CENTER:
+		left = spaces / 2;
+		break;
+	case FORMAT_ALIGN_RIGHT:
+		left = spaces;
+		break;
+	default:
+		break;
+	}
+
+	if (left) {
+		memmove(&format->buffer[left], format->buffer, format->length);
+		memset(format->buffer, ' ', left);
+	}
+	memset(&format->buffer[left + format->length], ' ', spaces - left);
+	format->length = width;
+	format->buffer[width] = 0;
+
+	return width;
+}
+
+void format_truncate(format_t* format, unsigned length)
+{
+	if (format->length <= length) {
+		return;
+	}
+	format->length = length;
+	format->buffer[length] = 0;
+}
+
+/* The digits of value with the leading zeros up to min_digits */
+void _format_digits(format_t* format, uint32_t value, unsigned min_digits)
+{
+	char digits[FORMAT_DIGITS_MAX];
+	unsigned count = 0;
+	do {
+		digits[count++] = (char)('0' + value % 10);
+		value /= 10;
+	} while (value || count < min_digits);
+
+	while (count) {
+		format_char(format, digits[--count]);
+	}
+}
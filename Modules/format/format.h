@@ -0,0 +1,52 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#ifndef _FORMAT_H_
+#define _FORMAT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdint.h>
+
+
+typedef enum _FORMAT_ALIGN {
+	FORMAT_ALIGN_LEFT = 0,
+	FORMAT_ALIGN_CENTER,
+	FORMAT_ALIGN_RIGHT
+} FORMAT_ALIGN;
+
+/*
+ * Text line in the caller buffer without the heap and printf:
+ * the parts are appended in place, the text is cut at the buffer end
+ * and is always null terminated
+ */
+typedef struct _format_t {
+	char*    buffer;
+	unsigned size;
+	unsigned length;
+} format_t;
+
+
+void format_init(format_t* format, char* buffer, unsigned size);
+void format_char(format_t* format, char c);
+void format_str(format_t* format, const char* str);
+void format_uint(format_t* format, uint32_t value);
+/* value with the leading zeros up to min_digits: format_uint_digits(7, 2) gives "07" */
+void format_uint_digits(format_t* format, uint32_t value, unsigned min_digits);
+void format_int(format_t* format, int32_t value);
+/* value in 10^-frac_digits units: format_fixed(-5, 2) gives "-0.05" */
+void format_fixed(format_t* format, int32_t value, unsigned frac_digits);
+/* Pads the text by spaces up to width characters, returns the text length */
+unsigned format_align(format_t* format, unsigned width, FORMAT_ALIGN align);
+/* Cuts the text to length characters */
+void format_truncate(format_t* format, unsigned length);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
@@ -0,0 +1,179 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * format tests: the numbers, the cut at the buffer end, the alignment and the truncation
+ * are compared with snprintf, the benchmark compares one menu line with snprintf
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include "test.h"
+#include "bench.h"
+#include "format.h"
+
+
+#define LINE_SIZE     (32)
+#define BENCH_LINES   (200000)
+#define LABEL_COLUMN  (16)
+
+
+static char line[LINE_SIZE];
+static char expected[LINE_SIZE];
+
+
+static void test_numbers()
+{
+	const int32_t values[] = {0, 7, -7, 99, -100, 123456789, INT32_MAX, INT32_MIN};
+	format_t format = {0};
+	for (unsigned i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+		format_init(&format, line, sizeof(line));
+		format_int(&format, values[i]);
+		snprintf(expected, sizeof(expected), "%ld", (long)values[i]);
+		TEST_CHECK(!strcmp(line, expected));
+		TEST_CHECK(format.length == strlen(expected));
+
+		format_init(&format, line, sizeof(line));
+		format_uint(&format, (uint32_t)values[i]);
+		snprintf(expected, sizeof(expected), "%lu", (unsigned long)(uint32_t)values[i]);
+		TEST_CHECK(!strcmp(line, expected));
+	}
+
+	format_init(&format, line, sizeof(line));
+	format_uint_digits(&format, 7, 2);
+	TEST_CHECK(!strcmp(line, "07"));
+
+	format_init(&format, line, sizeof(line));
+	format_fixed(&format, -5, 2);
+	TEST_CHECK(!strcmp(line, "-0.05"));
+
+	format_init(&format, line, sizeof(line));
+	format_fixed(&format, 12345, 1);
+	TEST_CHECK(!strcmp(line, "1234.5"));
+
+	format_init(&format, line, sizeof(line));
+	format_fixed(&format, 42, 0);
+	TEST_CHECK(!strcmp(line, "42"));
+}
+
+static void test_buffer_end()
+{
+	char small[6] = "";
+	format_t format = {0};
+	format_init(&format, small, sizeof(small));
+	format_str(&format, "Speed");
+	format_char(&format, ' ');
+	format_uint(&format, 12);
+	TEST_CHECK(!strcmp(small, "Speed"));
+	TEST_CHECK(format.length == sizeof(small) - 1);
+
+	format_init(&format, small, sizeof(small));
+	format_int(&format, -123456);
+	TEST_CHECK(!strcmp(small, "-1234"));
+
+	format_init(&format, small, 0);
+	format_str(&format, "x");
+	TEST_CHECK(format_align(&format, 4, FORMAT_ALIGN_LEFT) == 0);
+}
+
+static void test_align()
+{
+	format_t format = {0};
+	format_init(&format, line, sizeof(line));
+	format_str(&format, "ab");
+	TEST_CHECK(format_align(&format, 6, FORMAT_ALIGN_LEFT) == 6);
+	TEST_CHECK(!strcmp(line, "ab    "));
+
+	format_init(&format, line, sizeof(line));
+	format_str(&format, "ab");
+	format_align(&format, 7, FORMAT_ALIGN_CENTER);
+	TEST_CHECK(!strcmp(line, "  ab   "));
+
+	format_init(&format, line, sizeof(line));
+	format_str(&format, "ab");
+	format_align(&format, 6, FORMAT_ALIGN_RIGHT);
+	snprintf(expected, sizeof(expected), "%6s", "ab");
+	TEST_CHECK(!strcmp(line, expected));
+
+	/* The longer text is kept, the width is cut at the buffer end */
+	format_init(&format, line, sizeof(line));
+	format_str(&format, "abcdef");
+	TEST_CHECK(format_align(&format, 3, FORMAT_ALIGN_LEFT) == 6);
+	TEST_CHECK(format_align(&format, 100, FORMAT_ALIGN_LEFT) == LINE_SIZE - 1);
+	TEST_CHECK(strlen(line) == LINE_SIZE - 1);
+}
+
+/* The menu line: the long label is cut to keep one space before the value */
+static void test_truncate()
+{
+	const char* labels[] = {"Speed", "Sensitivity of the sensor", "Exactly fifteen"};
+	format_t format = {0};
+	for (unsigned i = 0; i < sizeof(labels) / sizeof(labels[0]); i++) {
+		format_init(&format, line, sizeof(line));
+		format_str(&format, labels[i]);
+		format_truncate(&format, LABEL_COLUMN - 1);
+		format_align(&format, LABEL_COLUMN, FORMAT_ALIGN_LEFT);
+		format_uint(&format, 42);
+		snprintf(expected, sizeof(expected), "%-*.*s 42", LABEL_COLUMN - 1, LABEL_COLUMN - 1, labels[i]);
+		TEST_CHECK(!strcmp(line, expected));
+	}
+
+	format_init(&format, line, sizeof(line));
+	format_str(&format, "ab");
+	format_truncate(&format, 5);
+	TEST_CHECK(!strcmp(line, "ab"));
+	format_truncate(&format, 0);
+	TEST_CHECK(!strcmp(line, "") && format.length == 0);
+}
+
+static void bench_line()
+{
+	const char label[] = "Sensitivity";
+	volatile int32_t value = -1234;
+	char number[LINE_SIZE] = "";
+	unsigned checksum = 0;
+
+	uint64_t start = bench_cycles();
+	for (unsigned i = 0; i < BENCH_LINES; i++) {
+		format_t format = {0};
+		format_init(&format, line, sizeof(line));
+		format_str(&format, label);
+		format_align(&format, LABEL_COLUMN, FORMAT_ALIGN_LEFT);
+		format_fixed(&format, value, 2);
+		format_align(&format, LINE_SIZE - 1, FORMAT_ALIGN_LEFT);
+		checksum += (unsigned char)line[LABEL_COLUMN + 1];
+	}
+	BENCH_RESULT("format line", bench_cycles() - start, BENCH_LINES);
+
+	start = bench_cycles();
+	for (unsigned i = 0; i < BENCH_LINES; i++) {
+		int32_t fixed = value;
+		uint32_t abs_value = fixed < 0 ? 0 - (uint32_t)fixed : (uint32_t)fixed;
+		snprintf(
+			number,
+			sizeof(number),
+			"%s%lu.%02lu",
+			fixed < 0 ? "-" : "",
+			(unsigned long)(abs_value / 100),
+			(unsigned long)(abs_value % 100)
+		);
+		snprintf(expected, sizeof(expected), "%-*s%-*s", LABEL_COLUMN, label, LINE_SIZE - 1 - LABEL_COLUMN, number);
+		checksum -= (unsigned char)expected[LABEL_COLUMN + 1];
+	}
+	BENCH_RESULT("snprintf line", bench_cycles() - start, BENCH_LINES);
+
+	TEST_CHECK(checksum == 0);
+	TEST_CHECK(!strcmp(line, expected));
+}
+
+
+int main()
+{
+	test_numbers();
+	test_buffer_end();
+	test_align();
+	test_truncate();
+	bench_line();
+	return TEST_RESULT();
+}
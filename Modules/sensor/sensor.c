@@ -7,6 +7,7 @@
 #include "glog.h"
 #include "main.h"
 #include "soul.h"
+#include "format.h"
 #include "gutils.h"
 #include "hal_defs.h"
 #include "settings.h"
@@ -18,6 +19,7 @@
 #define SENSOR_CAN_DELAY_MS        (100)
 #define SENSOR_MAX_ERRORS          (100)
 #define SENSOR_CONNECTION_DELAY_MS (300)
+#define SENSOR_RATE_PERIOD_MS      (1000)
 
 #define SENSOR_FRAME_ID1           (0x02AB)
 #define SENSOR_FRAME_ID2           (0x02A7)
@@ -30,7 +32,7 @@
 #define SENSOR_VALUE_STD_ID        (0)
 
 
-const uint16_t SENSOR_FRAME_IDS[] = {
+const uint16_t SENSOR_FRAME_IDS[SENSOR_COUNT] = {
 	SENSOR_FRAME_ID1,
 	SENSOR_FRAME_ID2,
 	SENSOR_FRAME_ID3,
@@ -40,6 +42,11 @@ typedef struct _sensor_t {
 	int16_t             value;
 	util_old_timer_t    connection_timer;
 	STRING_DIRECTION    direction;
+	volatile uint32_t   frames;
+	uint32_t            frames_last;
+	uint32_t            frame_rate;
+	// The last distance frame time, the connection timer start
+	volatile uint32_t   frame_ms;
 } sensor_t;
 
 typedef struct _sensor_state_t {
@@ -56,6 +63,7 @@ typedef struct _sensor_state_t {
 	unsigned            errors;
 	util_old_timer_t    timer;
 	util_old_timer_t    frame_timer;
+	uint32_t            frame_request_ms;
 
 	bool                received;
 	uint32_t            tx_mailbox;
@@ -65,6 +73,11 @@ typedef struct _sensor_state_t {
 	uint8_t             rx_buffer[SENSOR_DATA_MAX_SIZE];
 
 	uint8_t             bigski_id;
+
+	// Written by the CAN receive interrupt
+	volatile bool       sampled;
+	volatile uint32_t   sample_ms;
+	uint32_t            rate_ms;
 } sensor_state_t;
 
 typedef struct _can_frame_t {
@@ -126,8 +139,6 @@ void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef *hcan)
 {
 	_check_stop();
 
-	DWT->CYCCNT = 0;
-
 	CAN_RxHeaderTypeDef tmp_rx_header = {0};
 	uint8_t             tmp_rx_buffer[SENSOR_DATA_MAX_SIZE] = {0};
     if(HAL_CAN_GetRxMessage(hcan, CAN_RX_FIFO0, &tmp_rx_header, tmp_rx_buffer) == HAL_OK) {
@@ -140,14 +151,21 @@ void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef *hcan)
     		}
     		sensor_state.sensors[i].value     = ((int16_t)tmp_rx_buffer[1] << 8) | (int16_t)tmp_rx_buffer[2];
     		sensor_state.sensors[i].direction = tmp_rx_buffer[3];
+    		sensor_state.sensors[i].frames++;
+    		sensor_state.sensors[i].frame_ms = HAL_GetTick();
+    		sensor_state.sample_ms = HAL_GetTick();
+    		sensor_state.sampled   = true;
     		is_value = true;
 #if SENSOR_BEDUG
+    		char distance[16] = "";
+    		format_t format = {0};
+    		format_init(&format, distance, sizeof(distance));
+    		format_fixed(&format, sensor_state.sensors[i].value, 2);
     		printTagLog(
     			"SNS",
-    			"distance[%X]=%d.%d",
+    			"distance[%X]=%s",
 				(i == 0 ? SENSOR_FRAME_ID1 : i == 1 ? SENSOR_FRAME_ID2 : SENSOR_FRAME_ID3),
-				sensor_state.sensors[i].value / 100,
-    			__abs(sensor_state.sensors[i].value % 100)
+				distance
     		);
 #endif
     		util_old_timer_start(&sensor_state.sensors[i].connection_timer, SENSOR_CONNECTION_DELAY_MS);
@@ -180,6 +198,43 @@ void sensor_tick()
 		sensor_state.fsm = _fsm_sensor_init;
 	}
 	sensor_state.fsm();
+
+	uint32_t passed = HAL_GetTick() - sensor_state.rate_ms;
+	if (passed >= SENSOR_RATE_PERIOD_MS) {
+		sensor_state.rate_ms = HAL_GetTick();
+		for (unsigned i = 0; i < __arr_len(sensor_state.sensors); i++) {
+			// The counter is only incremented by the CAN interrupt, so it is read once and never reset
+			uint32_t frames = sensor_state.sensors[i].frames;
+			sensor_state.sensors[i].frame_rate  = (frames - sensor_state.sensors[i].frames_last) * SENSOR_RATE_PERIOD_MS / passed;
+			sensor_state.sensors[i].frames_last = frames;
+		}
+	}
+}
+
+uint32_t sensor_deadline()
+{
+	uint32_t now = HAL_GetTick();
+	if (sensor_state.fsm != _fsm_sensor_idle || sensor_state.received) {
+		return now;
+	}
+
+	uint32_t deadline = sensor_state.rate_ms + SENSOR_RATE_PERIOD_MS;
+	if (sensor_available() &&
+		(int32_t)(sensor_state.frame_request_ms + SENSOR_FRAME_DELAY_MS - deadline) < 0
+	) {
+		deadline = sensor_state.frame_request_ms + SENSOR_FRAME_DELAY_MS;
+	}
+	// The lost connection of a sensor is noticed when its timer ends
+	for (unsigned i = 0; i < __arr_len(sensor_state.sensors); i++) {
+		uint32_t lost_ms = sensor_state.sensors[i].frame_ms + SENSOR_CONNECTION_DELAY_MS;
+		if (util_old_timer_wait(&sensor_state.sensors[i].connection_timer) &&
+			(int32_t)(lost_ms - deadline) < 0
+		) {
+			deadline = lost_ms;
+		}
+	}
+
+	return (int32_t)(deadline - now) < 0 ? now : deadline;
 }
 
 bool sensor_available()
@@ -206,6 +261,24 @@ int16_t get_sensor2A8_value()
 	return sensor_state.sensors[2].value;
 }
 
+uint32_t get_sensor_frame_rate(unsigned index)
+{
+	if (index >= __arr_len(sensor_state.sensors)) {
+		return 0;
+	}
+	return sensor_state.sensors[index].frame_rate;
+}
+
+uint32_t get_sensor_sample_age_ms()
+{
+	if (!sensor_state.sampled) {
+		return UINT32_MAX;
+	}
+	// The sample time is read before the current time: a newer CAN frame does not make the age negative
+	uint32_t sample_ms = sensor_state.sample_ms;
+	return HAL_GetTick() - sample_ms;
+}
+
 int16_t get_sensor_average()
 {
 	int16_t value = 0;
@@ -392,6 +465,7 @@ void _fsm_sensor_idle()
 		!util_old_timer_wait(&(sensor_state.frame_timer))
 	) {
 		util_old_timer_start(&sensor_state.frame_timer, SENSOR_FRAME_DELAY_MS);
+		sensor_state.frame_request_ms = HAL_GetTick();
 		sensor_state.need_std_id = SENSOR_VALUE_STD_ID;
 		sensor_state.fsm = _fsm_sensor_send_frame1;
 	} else if (sensor_state.received) {
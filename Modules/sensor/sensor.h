@@ -15,6 +15,9 @@ extern "C" {
 
 #define SENSOR_BEDUG (0)
 
+// The sensors 0x2AB, 0x2A7 and 0x2A8 in the index order
+#define SENSOR_COUNT (3)
+
 
 typedef enum _SENSOR_MODE {
     SENSOR_MODE_SURFACE = 0x01,
@@ -38,6 +41,8 @@ typedef enum _STRING_DIRECTION {
 
 
 void sensor_tick();
+/* The nearest time (ms) when sensor_tick() has work: a frame request, a connection timeout or a reply */
+uint32_t sensor_deadline();
 bool sensor_available();
 int16_t get_sensor2A7_value();
 int16_t get_sensor2A8_value();
@@ -52,6 +57,11 @@ bool sensor2AB_available();
 bool sensor2A7_available();
 bool sensor2A8_available();
 
+/* Distance frames per the last second of the sensor index */
+uint32_t get_sensor_frame_rate(unsigned index);
+/* Milliseconds since the last distance frame of any sensor, UINT32_MAX - no frames yet */
+uint32_t get_sensor_sample_age_ms();
+
 void set_sensor_mode(SENSOR_MODE mode);
 SENSOR_MODE get_sensor_mode();
 SENSOR_MODE get_sensor_target_mode();
@@ -2,12 +2,46 @@
 
 #include "system.h"
 
+#include "glog.h"
 #include "main.h"
+#include "gutils.h"
 #include "hal_defs.h"
 
 
+/* The longest tickless sleep: the SysTick counter is 24 bit (233 ms at 72 MHz) */
+#define SYSTEM_IDLE_MAX_MS (200)
+
+
+typedef enum _system_wake_t {
+	SYSTEM_WAKE_TICK = 0,
+	SYSTEM_WAKE_TIMER,
+	SYSTEM_WAKE_OTHER
+} system_wake_t;
+
+
+static const char SYSTEM_TAG[] = "SYS";
+
+/* The periodic timers that wake the core, their counters show the time since the wakeup event */
+static const struct {
+	TIM_TypeDef* timer;
+	IRQn_Type    irq;
+} SYSTEM_WAKE_TIMERS[] = {
+	{TIM3, TIM3_IRQn},
+	{TIM4, TIM4_IRQn},
+};
+
 uint16_t SYSTEM_ADC_VOLTAGE = 0;
 
+static system_idle_stats_t system_idle_state = {0};
+static uint32_t system_idle_last_us = 0;
+static system_loop_stats_t system_loop_state = {0};
+
+
+/* Restarts SysTick: the next tick comes after the cycles, the next ones by the period */
+static void _system_tick_restart(uint32_t cycles, uint32_t period);
+static system_wake_t _system_wake_source(void);
+static uint32_t _system_wake_timer_cycles(void);
+
 
 void system_clock_hsi_config(void)
 {
@@ -187,3 +221,187 @@ void system_error_handler(SOUL_STATUS error)
 	while(--counter) {}
 	NVIC_SystemReset();
 }
+
+void system_idle(uint32_t deadline_ms)
+{
+	uint32_t now_us = system_micros();
+	if (system_idle_last_us) {
+		system_idle_state.total_us += now_us - system_idle_last_us;
+	}
+	system_idle_last_us = now_us;
+
+	int32_t sleep_ms = (int32_t)(deadline_ms - HAL_GetTick());
+	if (sleep_ms <= 0) {
+		return;
+	}
+	if (sleep_ms > SYSTEM_IDLE_MAX_MS) {
+		sleep_ms = SYSTEM_IDLE_MAX_MS;
+	}
+
+	/*
+	 * WFI with PRIMASK set: the core wakes on the pending interrupt, but the
+	 * handler runs only after __enable_irq(), so the wakeup source and its
+	 * counter can be read and the skipped ticks can be added here
+	 */
+	__disable_irq();
+	uint32_t sleep_start_us = system_micros();
+
+	const uint32_t period = SysTick->LOAD + 1;
+	SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+	uint32_t rest = SysTick->VAL ? SysTick->VAL : 1;
+	if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) {
+		// The tick has come while the sleep was prepared
+		_system_tick_restart(rest, period);
+		__enable_irq();
+		return;
+	}
+
+	// Tickless: one SysTick pass to the deadline tick instead of the skipped ticks
+	uint32_t ticks = (uint32_t)sleep_ms;
+	_system_tick_restart(rest + (ticks - 1) * period, period);
+
+	__DSB();
+	__WFI();
+
+	uint32_t skipped = 0;
+	uint32_t latency = 0;
+	system_wake_t wake = _system_wake_source();
+	if (wake == SYSTEM_WAKE_TICK) {
+		// The pending SysTick handler counts the deadline tick, the counter goes on from its reload
+		skipped = ticks - 1;
+		latency = period - 1 - SysTick->VAL;
+	} else {
+		SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+		uint32_t remaining = SysTick->VAL + 1;
+		uint32_t ticks_left = __div_up(remaining, period);
+		skipped = ticks - ticks_left;
+		_system_tick_restart(remaining - (ticks_left - 1) * period, period);
+		if (wake == SYSTEM_WAKE_TIMER) {
+			latency = _system_wake_timer_cycles();
+		}
+	}
+	uwTick += skipped * uwTickFreq;
+
+	uint32_t wake_us = system_micros();
+	__enable_irq();
+
+	system_idle_state.sleeps++;
+	system_idle_state.sleep_us += wake_us - sleep_start_us;
+	switch (wake) {
+	case SYSTEM_WAKE_TICK:
+		system_idle_state.tick_wakeups++;
+		break;
+	case SYSTEM_WAKE_TIMER:
+		system_idle_state.timer_wakeups++;
+		break;
+	default:
+		system_idle_state.other_wakeups++;
+		return;
+	}
+	latency /= (SystemCoreClock / 1000000);
+	system_idle_state.last_wake_latency_us = latency;
+	if (latency > system_idle_state.max_wake_latency_us) {
+		system_idle_state.max_wake_latency_us = latency;
+	}
+}
+
+const system_idle_stats_t* system_idle_stats(void)
+{
+	return &system_idle_state;
+}
+
+uint32_t system_idle_ratio(void)
+{
+	if (!system_idle_state.total_us) {
+		return 0;
+	}
+	return (uint32_t)(system_idle_state.sleep_us * 100 / system_idle_state.total_us);
+}
+
+void system_idle_show(void)
+{
+	printTagLog(
+		SYSTEM_TAG,
+		"idle: %lu%% sleeps=%lu (tick=%lu timer=%lu other=%lu) wake latency=%lu(max %lu)us",
+		system_idle_ratio(),
+		system_idle_state.sleeps,
+		system_idle_state.tick_wakeups,
+		system_idle_state.timer_wakeups,
+		system_idle_state.other_wakeups,
+		system_idle_state.last_wake_latency_us,
+		system_idle_state.max_wake_latency_us
+	);
+}
+
+void system_loop_tick(uint32_t ui_tick_us)
+{
+	system_loop_state.loops++;
+	if (ui_tick_us > system_loop_state.ui_max_us) {
+		system_loop_state.ui_max_us = ui_tick_us;
+	}
+
+	uint32_t passed = HAL_GetTick() - system_loop_state.window_ms;
+	if (passed < SECOND_MS) {
+		return;
+	}
+
+	system_loop_state.rate        = (uint32_t)((uint64_t)system_loop_state.loops * SECOND_MS / passed);
+	system_loop_state.ui_worst_us = system_loop_state.ui_max_us;
+	system_loop_state.loops       = 0;
+	system_loop_state.ui_max_us   = 0;
+	system_loop_state.window_ms   = HAL_GetTick();
+}
+
+const system_loop_stats_t* system_loop_stats(void)
+{
+	return &system_loop_state;
+}
+
+uint32_t system_micros(void)
+{
+	uint32_t ms  = 0;
+	uint32_t val = 0;
+	do {
+		ms  = HAL_GetTick();
+		val = SysTick->VAL;
+	} while (ms != HAL_GetTick());
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) && val > SysTick->LOAD / 2) {
+		ms++;
+	}
+	return ms * 1000 + (SysTick->LOAD - val) / (SystemCoreClock / 1000000);
+}
+
+void _system_tick_restart(uint32_t cycles, uint32_t period)
+{
+	SysTick->LOAD = cycles - 1;
+	SysTick->VAL  = 0;
+	SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+	SysTick->LOAD = period - 1;
+}
+
+system_wake_t _system_wake_source(void)
+{
+	if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) {
+		return SYSTEM_WAKE_TICK;
+	}
+	for (unsigned i = 0; i < __arr_len(SYSTEM_WAKE_TIMERS); i++) {
+		if (NVIC_GetPendingIRQ(SYSTEM_WAKE_TIMERS[i].irq) &&
+			(SYSTEM_WAKE_TIMERS[i].timer->SR & TIM_SR_UIF)
+		) {
+			return SYSTEM_WAKE_TIMER;
+		}
+	}
+	return SYSTEM_WAKE_OTHER;
+}
+
+/* The core cycles since the update event of the waking timer: the timers are clocked by HCLK */
+uint32_t _system_wake_timer_cycles(void)
+{
+	for (unsigned i = 0; i < __arr_len(SYSTEM_WAKE_TIMERS); i++) {
+		TIM_TypeDef* timer = SYSTEM_WAKE_TIMERS[i].timer;
+		if (NVIC_GetPendingIRQ(SYSTEM_WAKE_TIMERS[i].irq) && (timer->SR & TIM_SR_UIF)) {
+			return timer->CNT * (timer->PSC + 1);
+		}
+	}
+	return 0;
+}
@@ -9,10 +9,34 @@ extern "C" {
 
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "soul.h"
 
 
+#define SYSTEM_BEDUG (false)
+
+
+typedef struct _system_idle_stats_t {
+	uint32_t sleeps;
+	uint32_t tick_wakeups;
+	uint32_t timer_wakeups;
+	uint32_t other_wakeups;
+	uint64_t sleep_us;
+	uint64_t total_us;
+	uint32_t last_wake_latency_us;
+	uint32_t max_wake_latency_us;
+} system_idle_stats_t;
+
+typedef struct _system_loop_stats_t {
+	uint32_t rate;         // main loop passes per the last second
+	uint32_t ui_worst_us;  // the longest UI tick of the last second
+	uint32_t loops;        // the current second counters
+	uint32_t ui_max_us;
+	uint32_t window_ms;
+} system_loop_stats_t;
+
+
 extern uint16_t SYSTEM_ADC_VOLTAGE;
 
 
@@ -23,6 +47,28 @@ void system_post_load(void);
 
 void system_error_handler(SOUL_STATUS error);
 
+/*
+ * Sleeps (WFI) until the next interrupt if deadline_ms has not come yet
+ * SysTick is stopped for the sleep and wakes the core at the deadline only,
+ * the skipped ticks are added to the HAL tick after the wakeup.
+ * The wake latency is counted from the SysTick or TIM3/TIM4 event that woke the core
+ */
+void system_idle(uint32_t deadline_ms);
+const system_idle_stats_t* system_idle_stats(void);
+/* Sleep time percent since the first system_idle call */
+uint32_t system_idle_ratio(void);
+void system_idle_show(void);
+
+/* Counts the main loop pass with its UI tick time, the values are per second windows */
+void system_loop_tick(uint32_t ui_tick_us);
+const system_loop_stats_t* system_loop_stats(void);
+
+/*
+ * Microseconds since the start by the HAL tick and the SysTick counter.
+ * Also correct with the interrupts disabled: a pending SysTick is counted
+ */
+uint32_t system_micros(void);
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,97 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Trace tests on the fake DWT and UART: the hops are chained after the button sample,
+ * the late and the stale (older than the CYCCNT wrap) traces are not counted
+ */
+
+#include <stdio.h>
+
+#include "test.h"
+#include "main.h"
+#include "gtime.h"
+#include "trace.h"
+#include "usart.h"
+
+
+#define CYCLES_PER_US (72)
+#define CYCLES_PER_MS (CYCLES_PER_US * 1000)
+
+
+static void advance_us(uint32_t us)
+{
+	test_dwt.CYCCNT += us * CYCLES_PER_US;
+	test_millis += us / 1000;
+}
+
+static void test_chain()
+{
+	trace_reset();
+	test_dwt.CYCCNT = 0xFFFF0000;
+	uint32_t sample = test_dwt.CYCCNT;
+
+	/* The start is taken after the sample, the latency is from the sample */
+	advance_us(100);
+	trace_start(sample);
+	trace_point(TRACE_VALVE);
+	TEST_CHECK(trace_histogram(TRACE_BUTTON_VALVE)->count == 0);
+
+	advance_us(1900);
+	trace_point(TRACE_UI_STATUS);
+	advance_us(3000);
+	trace_point(TRACE_VALVE);
+	trace_point(TRACE_VALVE);
+	TEST_CHECK(trace_histogram(TRACE_BUTTON_VALVE)->count == 1);
+	TEST_CHECK(trace_histogram(TRACE_BUTTON_VALVE)->last_us == 5000);
+
+	advance_us(5000);
+	trace_point(TRACE_ARROW);
+	trace_point(TRACE_PIXEL);
+	TEST_CHECK(trace_histogram(TRACE_BUTTON_PIXEL)->count == 1);
+	TEST_CHECK(trace_histogram(TRACE_BUTTON_PIXEL)->last_us == 10000);
+}
+
+static void test_timeout()
+{
+	trace_reset();
+	trace_start(test_dwt.CYCCNT);
+	advance_us((TRACE_TIMEOUT_MS + 1) * 1000);
+	trace_point(TRACE_UI_STATUS);
+	trace_point(TRACE_VALVE);
+	TEST_CHECK(trace_histogram(TRACE_BUTTON_VALVE)->count == 0);
+}
+
+/* The counter has wrapped since the button: the cycles look like 1 ms, the ticks are 60 s */
+static void test_stale_wrap()
+{
+	trace_reset();
+	trace_start(test_dwt.CYCCNT);
+	test_millis += (uint32_t)(((uint64_t)1 << 32) / CYCLES_PER_MS);
+	advance_us(1000);
+	trace_point(TRACE_UI_STATUS);
+	trace_point(TRACE_VALVE);
+	TEST_CHECK(trace_histogram(TRACE_BUTTON_VALVE)->count == 0);
+}
+
+static void test_commands()
+{
+	test_uart.Instance->SR = 0;
+	TEST_CHECK(trace_command_tick() == 0);
+	test_uart.Instance->SR = UART_FLAG_RXNE;
+	test_uart.Instance->DR = 'w';
+	TEST_CHECK(trace_command_tick() == 'w');
+	test_uart.Instance->DR = 'l';
+	TEST_CHECK(trace_command_tick() == 0);
+}
+
+
+int main()
+{
+	trace_init();
+	TEST_CHECK(test_dwt.CTRL & DWT_CTRL_CYCCNTENA_Msk);
+	test_chain();
+	test_timeout();
+	test_stale_wrap();
+	test_commands();
+	return TEST_RESULT();
+}
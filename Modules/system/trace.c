@@ -0,0 +1,213 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#include "trace.h"
+
+#include <string.h>
+
+#include "glog.h"
+#include "main.h"
+#include "usart.h"
+#include "hal_defs.h"
+#include "lcd_mirror.h"
+
+
+static const char TRACE_TAG[] = "TRC";
+
+static const char* const TRACE_POINT_NAMES[TRACE_POINTS_COUNT] = {
+	"button",
+	"ui",
+	"valve",
+	"arrow",
+	"pixel",
+};
+static const char* const TRACE_LATENCY_NAMES[TRACE_LATENCIES_COUNT] = {
+	"button->valve",
+	"button->pixel",
+};
+/* The point is recorded only after its previous point of the same trace */
+static const TRACE_POINT TRACE_PREVIOUS[TRACE_POINTS_COUNT] = {
+	TRACE_BUTTON,
+	TRACE_BUTTON,
+	TRACE_UI_STATUS,
+	TRACE_UI_STATUS,
+	TRACE_ARROW,
+};
+
+static volatile uint32_t trace_cycles[TRACE_POINTS_COUNT] = {0};
+static volatile uint32_t trace_hits = 0;
+static volatile uint32_t trace_start_ms = 0;
+static trace_histogram_t trace_histograms[TRACE_LATENCIES_COUNT] = {0};
+
+
+static void _trace_add(trace_histogram_t* histogram, uint32_t latency_us);
+static uint32_t _trace_us(uint32_t cycles);
+
+
+void trace_init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+	trace_reset();
+}
+
+void trace_start(uint32_t cycles)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	trace_cycles[TRACE_BUTTON] = cycles;
+	trace_start_ms = HAL_GetTick();
+	trace_hits = (1 << TRACE_BUTTON);
+	__set_PRIMASK(primask);
+}
+
+void trace_point(TRACE_POINT point)
+{
+	if (point == TRACE_BUTTON || point >= TRACE_POINTS_COUNT) {
+		return;
+	}
+
+	uint32_t hits = trace_hits;
+	if (!(hits & (1 << TRACE_PREVIOUS[point])) || (hits & (1 << point))) {
+		return;
+	}
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	hits = trace_hits;
+	if ((hits & (1 << TRACE_PREVIOUS[point])) && !(hits & (1 << point))) {
+		uint32_t now = DWT->CYCCNT;
+		uint32_t latency_us = _trace_us(now - trace_cycles[TRACE_BUTTON]);
+		/* A stale trace may be older than the CYCCNT wrap and its cycles latency may look short */
+		if (HAL_GetTick() - trace_start_ms > TRACE_TIMEOUT_MS || latency_us > TRACE_TIMEOUT_MS * 1000) {
+			trace_hits = 0;
+		} else {
+			trace_cycles[point] = now;
+			trace_hits = hits | (1 << point);
+			if (point == TRACE_VALVE) {
+				_trace_add(&trace_histograms[TRACE_BUTTON_VALVE], latency_us);
+			} else if (point == TRACE_PIXEL) {
+				_trace_add(&trace_histograms[TRACE_BUTTON_PIXEL], latency_us);
+			}
+		}
+	}
+
+	__set_PRIMASK(primask);
+}
+
+const trace_histogram_t* trace_histogram(TRACE_LATENCY latency)
+{
+	if (latency >= TRACE_LATENCIES_COUNT) {
+		return NULL;
+	}
+	return &trace_histograms[latency];
+}
+
+void trace_reset(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	trace_hits = 0;
+	memset(trace_histograms, 0, sizeof(trace_histograms));
+	__set_PRIMASK(primask);
+}
+
+void trace_show(void)
+{
+	uint32_t hits = trace_hits;
+	for (unsigned i = TRACE_BUTTON + 1; i < TRACE_POINTS_COUNT; i++) {
+		if (!(hits & (1 << i))) {
+			continue;
+		}
+		printTagLog(
+			TRACE_TAG,
+			"last %s: +%lu us",
+			TRACE_POINT_NAMES[i],
+			_trace_us(trace_cycles[i] - trace_cycles[TRACE_BUTTON])
+		);
+	}
+
+	for (unsigned i = 0; i < TRACE_LATENCIES_COUNT; i++) {
+		const trace_histogram_t* histogram = &trace_histograms[i];
+		printTagLog(
+			TRACE_TAG,
+			"%s: count=%lu last=%lu min=%lu max=%lu us",
+			TRACE_LATENCY_NAMES[i],
+			histogram->count,
+			histogram->last_us,
+			histogram->min_us,
+			histogram->max_us
+		);
+		for (unsigned j = 0; j < TRACE_BUCKETS_COUNT; j++) {
+			if (!histogram->buckets[j]) {
+				continue;
+			}
+			printTagLog(
+				TRACE_TAG,
+				"  %s%lu us: %lu",
+				j < TRACE_BUCKETS_COUNT - 1 ? "<" : ">=",
+				(uint32_t)TRACE_BUCKET_US << (j < TRACE_BUCKETS_COUNT - 1 ? j : j - 1),
+				histogram->buckets[j]
+			);
+		}
+	}
+}
+
+uint8_t trace_command_tick(void)
+{
+	if (!__HAL_UART_GET_FLAG(&BEDUG_UART, UART_FLAG_RXNE)) {
+		return 0;
+	}
+
+	uint8_t command = (uint8_t)(BEDUG_UART.Instance->DR & 0xFF);
+	switch (command) {
+	case 'l':
+		trace_show();
+		break;
+	case 'r':
+		trace_reset();
+		printTagLog(TRACE_TAG, "latencies have been reset");
+		break;
+#if LCD_MIRROR
+	case 'm':
+		lcd_mirror_enable(!lcd_mirror_enabled());
+		printTagLog(
+			TRACE_TAG,
+			"screen mirror %s: packets=%lu bytes=%lu dropped=%lu read=%lu",
+			lcd_mirror_enabled() ? "on" : "off",
+			lcd_mirror_stats()->packets,
+			lcd_mirror_stats()->bytes,
+			lcd_mirror_stats()->dropped,
+			lcd_mirror_stats()->read
+		);
+		break;
+#endif
+	default:
+		return command;
+	}
+	return 0;
+}
+
+void _trace_add(trace_histogram_t* histogram, uint32_t latency_us)
+{
+	unsigned bucket = 0;
+	while (bucket < TRACE_BUCKETS_COUNT - 1 && latency_us >= ((uint32_t)TRACE_BUCKET_US << bucket)) {
+		bucket++;
+	}
+
+	if (!histogram->count || latency_us < histogram->min_us) {
+		histogram->min_us = latency_us;
+	}
+	if (latency_us > histogram->max_us) {
+		histogram->max_us = latency_us;
+	}
+	histogram->last_us = latency_us;
+	histogram->count++;
+	histogram->buckets[bucket]++;
+}
+
+uint32_t _trace_us(uint32_t cycles)
+{
+	return cycles / (SystemCoreClock / 1000000);
+}
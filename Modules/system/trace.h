@@ -0,0 +1,77 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdint.h>
+
+
+/* Hops of the manual valve button path in the path order */
+typedef enum _TRACE_POINT {
+	/* The port sample with the first pressed UP/DOWN level (TIM4 interrupt) */
+	TRACE_BUTTON = 0,
+	/* MANUAL_NEED_VALVE_UP/DOWN has been set by the UI FSM */
+	TRACE_UI_STATUS,
+	/* The valve GPIO has been driven by the App FSM (TIM3 interrupt) */
+	TRACE_VALVE,
+	/* The arrow icon has been queued to the display */
+	TRACE_ARROW,
+	/* The display queue has been drained after the arrow */
+	TRACE_PIXEL,
+	TRACE_POINTS_COUNT
+} TRACE_POINT;
+
+typedef enum _TRACE_LATENCY {
+	TRACE_BUTTON_VALVE = 0,
+	TRACE_BUTTON_PIXEL,
+	TRACE_LATENCIES_COUNT
+} TRACE_LATENCY;
+
+/* The first bucket is [0, TRACE_BUCKET_US), every next one is twice wider */
+#define TRACE_BUCKET_US     (250)
+#define TRACE_BUCKETS_COUNT (12)
+/*
+ * The hops later than the timeout after the button are not counted,
+ * the timeout is checked by HAL_GetTick() as CYCCNT wraps every 2^32 cycles (59.6 s at 72 MHz)
+ */
+#define TRACE_TIMEOUT_MS    (1000)
+
+typedef struct _trace_histogram_t {
+	uint32_t count;
+	uint32_t last_us;
+	uint32_t min_us;
+	uint32_t max_us;
+	uint32_t buckets[TRACE_BUCKETS_COUNT];
+} trace_histogram_t;
+
+
+/* Starts the DWT cycle counter, the timestamps of the points are the DWT cycles */
+void trace_init(void);
+/* Starts the new path trace from the TRACE_BUTTON point taken at the DWT cycles */
+void trace_start(uint32_t cycles);
+/* Records the first hit of the point after the previous point of the same trace */
+void trace_point(TRACE_POINT point);
+const trace_histogram_t* trace_histogram(TRACE_LATENCY latency);
+void trace_reset(void);
+/* Prints the last trace hops and the latency histograms */
+void trace_show(void);
+/*
+ * Reads the BEDUG_UART command without waiting:
+ * 'l' prints the latencies (trace_show), 'r' resets them,
+ * 'm' switches the screen mirror (LCD_MIRROR build)
+ * Returns the other received command for the caller ('w' - watchdogs), 0 if none
+ */
+uint8_t trace_command_tick(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
@@ -0,0 +1,59 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Host stand-in of the Utils ring buffer: the oldest value is dropped when it is full
+ */
+
+#pragma once
+
+
+#include <cstdint>
+
+
+namespace utl
+{
+
+template<unsigned SIZE, class T>
+struct circle_buffer
+{
+	bool empty() const { return !count; }
+	bool full() const { return count == SIZE; }
+	unsigned size() const { return count; }
+	void clear() { head = 0; count = 0; }
+
+	void push_back(const T& value)
+	{
+		if (full()) {
+			pop_front();
+		}
+		values[(head + count) % SIZE] = value;
+		count++;
+	}
+
+	void push_front(const T& value)
+	{
+		if (full()) {
+			count--;
+		}
+		head = (head + SIZE - 1) % SIZE;
+		values[head] = value;
+		count++;
+	}
+
+	T pop_front()
+	{
+		T value = values[head];
+		head = (head + 1) % SIZE;
+		count--;
+		return value;
+	}
+
+	T& front() { return values[head]; }
+
+private:
+	T values[SIZE] = {};
+	unsigned head = 0;
+	unsigned count = 0;
+};
+
+}
@@ -0,0 +1,3 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#pragma once
@@ -0,0 +1,28 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#pragma once
+
+
+#include <cstdint>
+
+#include "gtime.h"
+
+
+namespace utl
+{
+
+struct Timer
+{
+	explicit Timer(uint32_t delay): delay(delay), start_ms(0) {}
+
+	void start() { start_ms = getMillis(); }
+	void reset() { start_ms = getMillis() - delay; }
+	bool wait() const { return getMillis() - start_ms < delay; }
+	void changeDelay(uint32_t value) { delay = value; }
+
+private:
+	uint32_t delay;
+	uint32_t start_ms;
+};
+
+}
@@ -0,0 +1,38 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * The part of the Utils type lists that SoulGuard uses,
+ * the duplicates are not removed: the tests do not repeat the units
+ */
+
+#pragma once
+
+
+#include <variant>
+
+
+namespace utl
+{
+
+template<class... Types>
+struct simple_list_t {};
+
+template<class Type>
+struct getType { using TYPE = Type; };
+
+template<class... Types>
+struct typelist_t { using RESULT = simple_list_t<Types...>; };
+
+template<class... Types>
+using removed_duplicates_t = typelist_t<Types...>;
+
+template<class List>
+struct variant_factory;
+
+template<class... Types>
+struct variant_factory<typelist_t<Types...>> { using VARIANT = std::variant<Types...>; };
+
+template<class... Types>
+constexpr bool empty(simple_list_t<Types...>) { return sizeof...(Types) == 0; }
+
+}
@@ -0,0 +1,40 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Host benchmarks of the module tests: the CPU time stamp counter,
+ * the cycles are of the host CPU and are only compared with each other
+ */
+
+#pragma once
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdint.h>
+#include <stdio.h>
+
+
+#if defined(__x86_64__) || defined(__i386__)
+#   include <x86intrin.h>
+static inline uint64_t bench_cycles(void) { return __rdtsc(); }
+#else
+#   include <time.h>
+static inline uint64_t bench_cycles(void)
+{
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (uint64_t)time.tv_sec * 1000000000ULL + (uint64_t)time.tv_nsec;
+}
+#endif
+
+
+#define BENCH_RESULT(NAME, CYCLES, COUNT) \
+	printf("%-32s %10.1f cycles/call\n", NAME, (double)(CYCLES) / (double)(COUNT))
+
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,9 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#pragma once
+
+
+#include <assert.h>
+
+
+#define BEDUG_ASSERT(CONDITION, MESSAGE) assert((CONDITION) && (MESSAGE))
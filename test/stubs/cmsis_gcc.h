@@ -0,0 +1,65 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Host versions of the CMSIS intrinsics: the tests are single threaded,
+ * test_primask keeps the state of __disable_irq()/__set_PRIMASK(),
+ * test_dwt is the DWT cycle counter
+ */
+
+#pragma once
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdint.h>
+
+
+typedef struct _DWT_Type {
+	volatile uint32_t CTRL;
+	volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct _CoreDebug_Type {
+	volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+
+extern uint32_t test_primask;
+extern DWT_Type test_dwt;
+extern CoreDebug_Type test_core_debug;
+extern uint32_t SystemCoreClock;
+
+
+#define DWT       (&test_dwt)
+#define CoreDebug (&test_core_debug)
+
+#define DWT_CTRL_CYCCNTENA_Msk        ((uint32_t)0x00000001)
+#define CoreDebug_DEMCR_TRCENA_Msk    ((uint32_t)0x01000000)
+
+
+static inline uint32_t __get_PRIMASK(void) { return test_primask; }
+static inline void __set_PRIMASK(uint32_t primask) { test_primask = primask; }
+static inline void __disable_irq(void) { test_primask = 1; }
+static inline void __enable_irq(void) { test_primask = 0; }
+
+static inline void __DMB(void) { __sync_synchronize(); }
+static inline void __DSB(void) { __sync_synchronize(); }
+
+static inline uint32_t __CLZ(uint32_t value) { return value ? (uint32_t)__builtin_clz(value) : 32; }
+
+/* One instruction on the Cortex-M3, the swaps are the nearest host cost */
+static inline uint32_t __RBIT(uint32_t value)
+{
+	value = ((value >> 1) & 0x55555555) | ((value & 0x55555555) << 1);
+	value = ((value >> 2) & 0x33333333) | ((value & 0x33333333) << 2);
+	value = ((value >> 4) & 0x0F0F0F0F) | ((value & 0x0F0F0F0F) << 4);
+	return __builtin_bswap32(value);
+}
+
+
+#ifdef __cplusplus
+}
+#endif
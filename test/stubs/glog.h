@@ -0,0 +1,11 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#pragma once
+
+
+#include <stdio.h>
+
+
+#define printTagLog(TAG, FORMAT, ...) printf("%s: " FORMAT "\n", TAG, ##__VA_ARGS__)
+#define printPretty(FORMAT, ...)      printf(FORMAT, ##__VA_ARGS__)
+#define gprint(FORMAT, ...)           printf(FORMAT, ##__VA_ARGS__)
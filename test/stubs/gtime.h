@@ -0,0 +1,26 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Host clock of the module tests: getMillis() and HAL_GetTick() return test_millis
+ */
+
+#pragma once
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdint.h>
+
+
+extern uint32_t test_millis;
+
+
+uint32_t getMillis(void);
+
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,22 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#pragma once
+
+
+#include <stdint.h>
+
+
+#define __min(A, B)     ((A) < (B) ? (A) : (B))
+#define __max(A, B)     ((A) > (B) ? (A) : (B))
+#define __abs(A)        ((A) < 0 ? -(A) : (A))
+#define __arr_len(ARR)  (sizeof(ARR) / sizeof(*(ARR)))
+#define __div_up(A, B)  (((A) + (B) - 1) / (B))
+
+
+static inline int32_t util_convert_range(int32_t val, int32_t rngl1, int32_t rngh1, int32_t rngl2, int32_t rngh2)
+{
+	if (rngh1 == rngl1) {
+		return rngl2;
+	}
+	return rngl2 + (val - rngl1) * (rngh2 - rngl2) / (rngh1 - rngl1);
+}
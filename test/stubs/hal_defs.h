@@ -0,0 +1,9 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#pragma once
+
+
+#include "main.h"
+
+
+#define SECOND_MS ((uint32_t)1000)
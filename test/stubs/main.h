@@ -0,0 +1,87 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Host stand-in of Core/Inc/main.h for the module tests:
+ * the button port, pins, the BEDUG_UART with its TX DMA channel
+ * and the error handler without the HAL
+ */
+
+#pragma once
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdint.h>
+
+#include "cmsis_gcc.h"
+
+
+typedef struct _GPIO_TypeDef {
+	volatile uint32_t IDR;
+} GPIO_TypeDef;
+
+
+typedef struct _USART_TypeDef {
+	volatile uint32_t SR;
+	volatile uint32_t DR;
+	volatile uint32_t CR3;
+} USART_TypeDef;
+
+typedef struct _UART_HandleTypeDef {
+	USART_TypeDef* Instance;
+} UART_HandleTypeDef;
+
+typedef struct _DMA_TypeDef {
+	volatile uint32_t ISR;
+	volatile uint32_t IFCR;
+} DMA_TypeDef;
+
+typedef struct _DMA_Channel_TypeDef {
+	volatile uint32_t CCR;
+	volatile uint32_t CNDTR;
+	volatile uint32_t CPAR;
+	volatile uint32_t CMAR;
+} DMA_Channel_TypeDef;
+
+
+extern UART_HandleTypeDef test_uart;
+extern DMA_TypeDef test_dma;
+extern DMA_Channel_TypeDef test_dma_channel4;
+
+
+#define BEDUG_UART     (test_uart)
+
+#define DMA1           (&test_dma)
+#define DMA1_Channel4  (&test_dma_channel4)
+
+#define UART_FLAG_RXNE ((uint32_t)0x00000020)
+#define USART_CR3_DMAT ((uint32_t)0x00000080)
+#define DMA_ISR_TCIF4  ((uint32_t)0x00002000)
+#define DMA_IFCR_CGIF4 ((uint32_t)0x00001000)
+#define DMA_CCR_EN     ((uint32_t)0x00000001)
+#define DMA_CCR_DIR    ((uint32_t)0x00000010)
+#define DMA_CCR_MINC   ((uint32_t)0x00000080)
+
+#define __HAL_UART_GET_FLAG(HANDLE, FLAG) (((HANDLE)->Instance->SR & (FLAG)) == (FLAG))
+
+
+#define BTN_F1_Pin      ((uint16_t)0x0001)
+#define BTN_F2_Pin      ((uint16_t)0x0002)
+#define BTN_F3_Pin      ((uint16_t)0x0004)
+#define BTN_UP_Pin      ((uint16_t)0x0008)
+#define BTN_DOWN_Pin    ((uint16_t)0x0010)
+#define BTN_ENTER_Pin   ((uint16_t)0x0020)
+#define BTN_MODE_Pin    ((uint16_t)0x0040)
+
+
+void Error_Handler(void);
+
+uint32_t HAL_GetTick(void);
+
+
+#ifdef __cplusplus
+}
+#endif
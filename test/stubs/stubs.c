@@ -0,0 +1,37 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "main.h"
+#include "gtime.h"
+
+
+uint32_t test_millis = 0;
+uint32_t test_primask = 0;
+DWT_Type test_dwt = {0};
+CoreDebug_Type test_core_debug = {0};
+uint32_t SystemCoreClock = 72000000;
+
+static USART_TypeDef test_usart = {0};
+UART_HandleTypeDef test_uart = {&test_usart};
+DMA_TypeDef test_dma = {0};
+DMA_Channel_TypeDef test_dma_channel4 = {0};
+unsigned test_failures = 0;
+
+
+uint32_t getMillis(void)
+{
+	return test_millis;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return test_millis;
+}
+
+void Error_Handler(void)
+{
+	fprintf(stderr, "Error_Handler\n");
+	abort();
+}
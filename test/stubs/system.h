@@ -0,0 +1,23 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Host stand-in of Modules/system/system.h for the display tests
+ */
+
+#pragma once
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdint.h>
+
+
+uint32_t system_micros(void);
+
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,26 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Checks of the module tests: a failed check is printed and counted,
+ * main() returns TEST_RESULT() to ctest
+ */
+
+#pragma once
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+extern unsigned test_failures;
+
+
+#define TEST_CHECK(CONDITION) \
+	do { \
+		if (!(CONDITION)) { \
+			test_failures++; \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #CONDITION); \
+		} \
+	} while (0)
+
+#define TEST_RESULT() (test_failures ? EXIT_FAILURE : EXIT_SUCCESS)
@@ -0,0 +1,11 @@
+/* Copyright © 2024 Georgy E. All rights reserved. */
+
+/*
+ * Host stand-in of Core/Inc/usart.h for the module tests:
+ * the BEDUG_UART is test_uart of main.h
+ */
+
+#pragma once
+
+
+#include "main.h"